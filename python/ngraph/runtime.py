@@ -15,11 +15,14 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
-from typing import List
+import multiprocessing
+import threading
+from concurrent.futures import Future, ThreadPoolExecutor
+from typing import List, Optional, Sequence, Union
 
 import numpy as np
 
-from ngraph.impl import Function, Node, serialize, TensorViewType, util
+from ngraph.impl import Function, Node, NodeVector, serialize, TensorViewType, util
 from ngraph.impl.runtime import Backend
 from ngraph.impl.op import Parameter
 
@@ -43,54 +46,123 @@ class Runtime:
     def __init__(self, backend_name):  # type: (str) -> None
         self.backend_name = backend_name
         self.backend = Backend.create(backend_name)
+        self._executor = None  # type: Optional[ThreadPoolExecutor]
+        self._executor_lock = threading.Lock()
+
+    @property
+    def executor(self):  # type: () -> ThreadPoolExecutor
+        """Return the thread pool that runs the asynchronous calls of this runtime's computations.
+
+        The backend releases the GIL while a computation runs, so computations called from
+        different threads run in parallel.
+        """
+        with self._executor_lock:
+            if self._executor is None:
+                self._executor = ThreadPoolExecutor(max_workers=multiprocessing.cpu_count())
+            return self._executor
 
     def __repr__(self):  # type: () -> str
         return '<Runtime: Backend=\'{}\'>'.format(self.backend_name)
 
-    def computation(self, node, *inputs):  # type: (Node, *Node) -> 'Computation'
-        """Return a callable Computation object."""
+    def computation(self, node, *inputs):
+        # type: (Union[Node, List[Node]], *Node) -> 'Computation'
+        """Return a callable Computation object.
+
+        :param node: The result node, or a list of result nodes.
+        :param inputs: The parameters of the computation, in the order of its arguments.
+        """
         return Computation(self, node, *inputs)
 
 
 class Computation:
-    """ngraph callable computation object."""
+    """ngraph callable computation object.
+
+    On backends whose tensors live in host memory, input arrays are bound as tensor storage
+    without copying and results are read through views of output tensors kept across calls.
 
-    def __init__(self, runtime, node, *parameters):  # type: (Runtime, Node, *Parameter) -> None
+    A computation may be called from several threads, calls of one computation run one at a
+    time while different computations run in parallel.
+    """
+
+    def __init__(self, runtime, node, *parameters):
+        # type: (Runtime, Union[Node, List[Node]], *Parameter) -> None
         self.runtime = runtime
         self.node = node
         self.parameters = parameters
+        self.backend = runtime.backend
+        if isinstance(node, (list, tuple)):
+            self.results = list(node)
+            self.function = Function(NodeVector(self.results), self.parameters,
+                                     'ngraph_computation')
+        else:
+            self.results = [node]
+            self.function = Function(node, self.parameters, 'ngraph_computation')
+
         self.tensor_views = []  # type: List[TensorViewType]
         for parameter in parameters:
             shape = parameter.get_shape()
             element_type = parameter.get_element_type()
-            self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
-        self.function = Function(self.node, self.parameters, 'ngraph_computation')
-        self.backend = runtime.backend
+            self.tensor_views.append(self.backend.create_tensor(element_type, shape))
+        self.result_views = []  # type: List[TensorViewType]
+        for result in self.results:
+            self.result_views.append(
+                self.backend.create_tensor(result.get_element_type(), result.get_shape()))
+
+        try:
+            self.result_arrays = [np.asarray(view) for view in self.result_views]
+            self.zero_copy = True
+        except (BufferError, RuntimeError, TypeError, ValueError):
+            self.result_arrays = []
+            self.zero_copy = False
+        # The arrays bound as input storage by the last call, so that their tensors are reused
+        self.bound_arrays = [None] * len(parameters)  # type: List[Optional[np.ndarray]]
+        # Guards the cached tensors, which each call rebinds and reads
+        self.lock = threading.Lock()
 
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
-        return '<Computation: {}({})>'.format(self.node.name, params_string)
+        result_string = ', '.join([result.name for result in self.results])
+        return '<Computation: {}({})>'.format(result_string, params_string)
 
-    def __call__(self, *input_values):  # type: (*NumericData) -> NumericData
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
+    def __call__(self, *input_values):
+        # type: (*NumericData) -> Union[NumericData, List[NumericData]]
+        """Run computation on input values and return result.
 
-        result_element_type = self.node.get_element_type()
-        result_shape = self.node.get_shape()
-        result_dtype = get_dtype(result_element_type)
+        A computation of several nodes returns a list with a result for each node.
+        """
+        with self.lock:
+            results = self._run(input_values)
 
-        result_view = self.runtime.backend.create_tensor(
-            result_element_type, result_shape)
-        result_arr = np.empty(result_shape, dtype=result_dtype)
+        if isinstance(self.node, (list, tuple)):
+            return results
+        return results[0]
 
-        self.backend.call(self.function, [result_view], self.tensor_views)
+    def call_async(self, *input_values):  # type: (*NumericData) -> Future
+        """Run computation on input values in the runtime's thread pool.
 
-        Computation._read_tensor_view_to_ndarray(result_view, result_arr)
-        result_arr = result_arr.reshape(result_shape)
-        return result_arr
+        Return a Future of the result. Input arrays may be used as tensor storage until the
+        future is done, so they must not be modified before.
+        """
+        return self.runtime.executor.submit(self, *input_values)
+
+    def _run(self, input_values):  # type: (Sequence[NumericData]) -> List[NumericData]
+        for index, value in enumerate(input_values[:len(self.tensor_views)]):
+            if self.zero_copy:
+                self._bind_input(index, value)
+            else:
+                Computation._write_ndarray_to_tensor_view(value, self.tensor_views[index])
+
+        self.backend.call(self.function, self.result_views, self.tensor_views)
+
+        if self.zero_copy:
+            results = [array.copy() for array in self.result_arrays]
+        else:
+            results = []
+            for result, view in zip(self.results, self.result_views):
+                array = np.empty(result.get_shape(), dtype=get_dtype(result.get_element_type()))
+                Computation._read_tensor_view_to_ndarray(view, array)
+                results.append(array)
+        return results
 
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
@@ -100,23 +172,51 @@ class Computation:
         """
         return serialize(self.function, indent)
 
+    def _bind_input(self, index, value):  # type: (int, NumericData) -> None
+        """Make value the storage of input tensor number index, copying it only if needed."""
+        if value is self.bound_arrays[index]:
+            return
+
+        parameter = self.parameters[index]
+        shape = list(parameter.get_shape())
+        dtype = get_dtype(parameter.get_element_type())
+        array = Computation._to_input_array(value, shape, dtype)
+        if not array.flags.c_contiguous or not array.flags.aligned or not array.flags.writeable:
+            array = np.array(array, dtype=dtype, order='C')
+
+        self.tensor_views[index] = self.backend.create_tensor(
+            parameter.get_element_type(), parameter.get_shape(), array)
+        # Only the caller's own array can be reused, a converted copy is new on every call
+        self.bound_arrays[index] = array if array is value else None
+
+    @staticmethod
+    def _to_input_array(value, shape, dtype):
+        # type: (NumericData, List[int], np.dtype) -> np.ndarray
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
+        if list(value.shape) != shape:
+            if len(value.shape) > 0:
+                raise UserInputError(
+                    'Provided tensor\'s shape: %s does not match the expected: %s.',
+                    list(value.shape), shape)
+            value = np.full(shape, value, dtype=dtype)
+        if value.dtype != dtype:
+            log.warning(
+                'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
+                value.dtype,
+                dtype)
+            value = value.astype(dtype)
+        return value
+
     @staticmethod
     def _get_buffer_size(element_type, element_count):  # type: (TensorViewType, int) -> int
         return int((element_type.bitwidth / 8.0) * element_count)
 
     @staticmethod
     def _write_ndarray_to_tensor_view(value, tensor_view):
-        # type: (np.ndarray, TensorViewType) -> None
+        # type: (NumericData, TensorViewType) -> None
         tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError('Provided tensor\'s shape: %s does not match the expected: %s.',
-                                 list(value.shape), list(tensor_view.shape))
-        if value.dtype != tensor_view_dtype:
-            log.warning(
-                'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
-                value.dtype,
-                tensor_view.element_type)
-            value = value.astype(tensor_view_dtype)
+        value = Computation._to_input_array(value, list(tensor_view.shape), tensor_view_dtype)
 
         buffer_size = Computation._get_buffer_size(
             tensor_view.element_type, tensor_view.element_count)
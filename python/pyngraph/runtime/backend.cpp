@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 //#include <string>
@@ -23,6 +24,40 @@
 
 namespace py = pybind11;
 
+// Wraps the memory of a C-contiguous array, which the tensor keeps alive, without copying it
+static std::shared_ptr<ngraph::runtime::TensorView>
+    create_tensor_on_array(ngraph::runtime::Backend& self,
+                           const ngraph::element::Type& element_type,
+                           const ngraph::Shape& shape,
+                           py::array array)
+{
+    if (!(array.flags() & py::array::c_style))
+    {
+        throw std::invalid_argument("Array must be C-contiguous");
+    }
+    if (static_cast<size_t>(array.nbytes()) != ngraph::shape_size(shape) * element_type.size())
+    {
+        throw std::invalid_argument("Array size does not match the tensor's");
+    }
+    return self.create_tensor(element_type, shape, array.mutable_data());
+}
+
+// compile and call don't touch Python objects, so other Python threads run while they do
+static bool compile(ngraph::runtime::Backend& self, std::shared_ptr<ngraph::Function> function)
+{
+    py::gil_scoped_release release;
+    return self.compile(function);
+}
+
+static bool call(ngraph::runtime::Backend& self,
+                 std::shared_ptr<ngraph::Function> function,
+                 const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>& outputs,
+                 const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>& inputs)
+{
+    py::gil_scoped_release release;
+    return self.call(function, outputs, inputs);
+}
+
 void regclass_pyngraph_runtime_Backend(py::module m)
 {
     py::class_<ngraph::runtime::Backend, std::shared_ptr<ngraph::runtime::Backend>> backend(
@@ -34,15 +69,9 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::TensorView>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
-    backend.def("compile",
-                (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
-                    ngraph::runtime::Backend::compile);
-    backend.def("call",
-                (void (ngraph::runtime::Backend::*)(
-                    std::shared_ptr<ngraph::Function>,
-                    const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>&,
-                    const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>&)) &
-                    ngraph::runtime::Backend::call);
+    backend.def("create_tensor", &create_tensor_on_array, py::keep_alive<0, 4>());
+    backend.def("compile", &compile);
+    backend.def("call", &call);
     backend.def("remove_compiled_function",
                 (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
                     ngraph::runtime::Backend::remove_compiled_function);
@@ -18,10 +18,39 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/type/element_type.hpp"
 #include "pyngraph/runtime/tensor_view.hpp"
 
 namespace py = pybind11;
 
+// Describes the storage of host-accessible tensors to numpy, so numpy.asarray(tensor_view) is a
+// view of it that keeps the tensor alive
+static py::dict array_interface(ngraph::runtime::TensorView& self)
+{
+    void* data = self.get_host_data_ptr();
+    if (data == nullptr)
+    {
+        throw std::runtime_error("TensorView storage is not host memory");
+    }
+
+    const ngraph::element::Type& type = self.get_tensor().get_element_type();
+    char kind = type.is_real() ? 'f' : type.is_signed() ? 'i' : 'u';
+    if (type == ngraph::element::boolean)
+    {
+        kind = 'b';
+    }
+    const uint16_t byte_order = 1;
+    bool little_endian = *reinterpret_cast<const uint8_t*>(&byte_order) == 1;
+    char order = type.size() == 1 ? '|' : little_endian ? '<' : '>';
+
+    py::dict interface;
+    interface["shape"] = py::tuple(py::cast(self.get_shape()));
+    interface["typestr"] = std::string{order, kind} + std::to_string(type.size());
+    interface["data"] = py::make_tuple(reinterpret_cast<uintptr_t>(data), false);
+    interface["version"] = 3;
+    return interface;
+}
+
 void regclass_pyngraph_runtime_TensorView(py::module m)
 {
     py::class_<ngraph::runtime::TensorView, std::shared_ptr<ngraph::runtime::TensorView>>
@@ -31,6 +60,7 @@ void regclass_pyngraph_runtime_TensorView(py::module m)
                    (void (ngraph::runtime::TensorView::*)(const void*, size_t, size_t)) &
                        ngraph::runtime::TensorView::write);
     tensorView.def("read", &ngraph::runtime::TensorView::read);
+    tensorView.def_property_readonly("__array_interface__", &array_interface);
 
     tensorView.def_property_readonly("shape", &ngraph::runtime::TensorView::get_shape);
     tensorView.def_property_readonly("element_count",
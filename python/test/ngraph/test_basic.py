@@ -19,7 +19,7 @@ import json
 
 import ngraph as ng
 from test.ngraph.util import get_runtime, run_op_node
-from ngraph.impl import Function, NodeVector
+from ngraph.impl import Function, NodeVector, Shape, Type, util
 from ngraph.exceptions import UserInputError
 
 
@@ -171,3 +171,79 @@ def test_bad_data_shape():
     value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
     with pytest.raises(UserInputError):
         computation(value_a, value_b)
+
+
+def test_computation_multiple_outputs():
+    runtime = get_runtime()
+    dtype = np.float32
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=dtype, name='A')
+    parameter_b = ng.parameter(shape, dtype=dtype, name='B')
+    computation = runtime.computation([parameter_a + parameter_b, parameter_a * parameter_b],
+                                      parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=dtype)
+    value_b = np.array([[5, 6], [7, 8]], dtype=dtype)
+    sum_result, product_result = computation(value_a, value_b)
+    assert np.allclose(sum_result, np.array([[6, 8], [10, 12]], dtype=dtype))
+    assert np.allclose(product_result, np.array([[5, 12], [21, 32]], dtype=dtype))
+
+
+@pytest.config.gpu_skip(reason='Not implemented')
+def test_computation_reuses_bound_inputs():
+    runtime = get_runtime()
+    dtype = np.float32
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=dtype, name='A')
+    parameter_b = ng.parameter(shape, dtype=dtype, name='B')
+    computation = runtime.computation(parameter_a + parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=dtype)
+    value_b = np.array([[5, 6], [7, 8]], dtype=dtype)
+    first = computation(value_a, value_b)
+
+    # The same arrays, updated in place, are read again; earlier results are not overwritten
+    value_a += 10
+    second = computation(value_a, value_b)
+    assert np.allclose(first, np.array([[6, 8], [10, 12]], dtype=dtype))
+    assert np.allclose(second, np.array([[16, 18], [20, 22]], dtype=dtype))
+
+    # Arrays that need a conversion are copied
+    third = computation(value_a.astype(np.float64), np.asfortranarray(value_b))
+    assert np.allclose(third, second)
+
+
+def test_computation_call_async():
+    runtime = get_runtime()
+    dtype = np.float32
+    shape = [16, 16]
+    parameter_a = ng.parameter(shape, dtype=dtype, name='A')
+    parameter_b = ng.parameter(shape, dtype=dtype, name='B')
+    add = runtime.computation(parameter_a + parameter_b, parameter_a, parameter_b)
+    multiply = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    values = [np.full(shape, index, dtype=dtype) for index in range(8)]
+    futures = [(add.call_async(value, value), multiply.call_async(value, value))
+               for value in values]
+    for value, (add_future, multiply_future) in zip(values, futures):
+        assert np.allclose(add_future.result(), value + value)
+        assert np.allclose(multiply_future.result(), value * value)
+
+
+@pytest.config.gpu_skip(reason='Not implemented')
+def test_tensor_view_buffer():
+    runtime = get_runtime()
+    tensor_view = runtime.backend.create_tensor(Type.f32, Shape([2, 3]))
+    array = np.asarray(tensor_view)
+    assert array.shape == (2, 3)
+    assert array.dtype == np.float32
+
+    array[:] = np.arange(6, dtype=np.float32).reshape(2, 3)
+    result = np.empty([2, 3], dtype=np.float32)
+    tensor_view.read(util.numpy_to_c(result), 0, result.nbytes)
+    assert np.array_equal(result, array)
+
+    data = np.ones([3], dtype=np.int32)
+    tensor_view = runtime.backend.create_tensor(Type.i32, Shape([3]), data)
+    data[1] = 7
+    assert np.array_equal(np.asarray(tensor_view), [1, 7, 1])
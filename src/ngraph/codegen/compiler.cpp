@@ -14,7 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <thread>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -32,14 +39,22 @@
 #include <clang/FrontendTool/Utils.h>
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
+#include <llvm/ADT/SmallString.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
+#include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
 #include <llvm/Option/Arg.h>
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/ManagedStatic.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
@@ -75,6 +90,11 @@ using namespace ngraph;
 static codegen::StaticCompiler s_static_compiler;
 static std::mutex m_mutex;
 
+// Compilers used by compile_modules. A clang CompilerInstance runs one action at a time so
+// each worker checks one out, along with the precompiled header it generated
+static std::vector<std::unique_ptr<codegen::StaticCompiler>> s_compiler_pool;
+static std::mutex s_compiler_pool_mutex;
+
 codegen::Module::Module(std::unique_ptr<llvm::Module> module)
     : m_module(move(module))
 {
@@ -90,7 +110,23 @@ std::unique_ptr<llvm::Module> codegen::Module::take_module()
 }
 
 codegen::Compiler::Compiler()
+    : m_context(new LLVMContext())
+    , m_cache_size_limit(1024 * 1024 * 1024)
+    , m_cache_hits(0)
+    , m_thread_count(std::max(1u, std::thread::hardware_concurrency()))
 {
+    if (const char* dir = std::getenv("NGRAPH_CODEGEN_CACHE_DIR"))
+    {
+        m_cache_dir = dir;
+    }
+    if (const char* size = std::getenv("NGRAPH_CODEGEN_CACHE_SIZE_MB"))
+    {
+        m_cache_size_limit = static_cast<size_t>(std::strtoull(size, nullptr, 10)) * 1024 * 1024;
+    }
+    if (const char* threads = std::getenv("NGRAPH_CODEGEN_THREADS"))
+    {
+        m_thread_count = std::max(1ul, std::strtoul(threads, nullptr, 10));
+    }
 }
 
 codegen::Compiler::~Compiler()
@@ -99,6 +135,7 @@ codegen::Compiler::~Compiler()
 
 void codegen::Compiler::set_precompiled_header_source(const std::string& source)
 {
+    lock_guard<mutex> lock(m_mutex);
     s_static_compiler.set_precompiled_header_source(source);
 }
 
@@ -110,7 +147,237 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
     lock_guard<mutex> lock(m_mutex);
-    return s_static_compiler.compile(m_compiler_action, source);
+    return compile_source(s_static_compiler, m_compiler_action, *m_context, source);
+}
+
+vector<unique_ptr<codegen::Module>>
+    codegen::Compiler::compile_modules(const vector<string>& sources)
+{
+    vector<unique_ptr<codegen::Module>> modules(sources.size());
+
+    string pch_source;
+    vector<string> search_paths;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        pch_source = s_static_compiler.get_precompiled_header_source();
+        search_paths = s_static_compiler.get_header_search_paths();
+    }
+
+    size_t first = m_module_actions.size();
+    m_module_actions.resize(first + sources.size());
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        m_module_contexts.emplace_back(new LLVMContext());
+    }
+
+    atomic<size_t> next_source{0};
+    exception_ptr error;
+    mutex error_mutex;
+    auto worker = [&]() {
+        unique_ptr<codegen::StaticCompiler> compiler;
+        {
+            lock_guard<mutex> lock(s_compiler_pool_mutex);
+            if (s_compiler_pool.empty())
+            {
+                compiler.reset(new codegen::StaticCompiler());
+            }
+            else
+            {
+                compiler = move(s_compiler_pool.back());
+                s_compiler_pool.pop_back();
+            }
+        }
+        compiler->set_precompiled_header_source(pch_source);
+        for (const string& path : search_paths)
+        {
+            if (!contains(compiler->get_header_search_paths(), path))
+            {
+                compiler->add_header_search_path(path);
+            }
+        }
+
+        try
+        {
+            for (size_t i = next_source++; i < sources.size(); i = next_source++)
+            {
+                modules[i] = compile_source(*compiler,
+                                            m_module_actions[first + i],
+                                            *m_module_contexts[first + i],
+                                            sources[i]);
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+
+        lock_guard<mutex> lock(s_compiler_pool_mutex);
+        s_compiler_pool.push_back(move(compiler));
+    };
+
+    size_t thread_count = std::min(std::max<size_t>(m_thread_count, 1), sources.size());
+    vector<thread> threads;
+    for (size_t i = 1; i < thread_count; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    if (thread_count > 0)
+    {
+        worker();
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+    return modules;
+}
+
+unique_ptr<codegen::Module>
+    codegen::Compiler::compile_source(codegen::StaticCompiler& compiler,
+                                      unique_ptr<clang::CodeGenAction>& compiler_action,
+                                      LLVMContext& context,
+                                      const string& source)
+{
+    string cache_file;
+    if (!m_cache_dir.empty())
+    {
+        file_util::make_directory(m_cache_dir);
+        cache_file = file_util::path_join(m_cache_dir, get_cache_key(compiler, source) + ".bc");
+        unique_ptr<codegen::Module> cached = load_cached_module(cache_file, context);
+        if (cached)
+        {
+            lock_guard<mutex> lock(m_cache_mutex);
+            m_cache_hits++;
+            return cached;
+        }
+    }
+
+    unique_ptr<codegen::Module> module = compiler.compile(compiler_action, source);
+    if (module && !cache_file.empty())
+    {
+        lock_guard<mutex> lock(m_cache_mutex);
+        store_cached_module(*module, cache_file);
+        trim_cache(cache_file);
+    }
+    return module;
+}
+
+string codegen::Compiler::get_cache_key(const codegen::StaticCompiler& compiler,
+                                        const std::string& source) const
+{
+    // Anything that changes the generated module must be part of the key; stale entries are
+    // never looked up again and eventually fall out of the cache through trim_cache
+    stringstream config;
+    config << "ngraph " << LIBRARY_VERSION << "\n";
+    config << "llvm " << LLVM_VERSION_STRING << "\n";
+    config << "cpu " << llvm::sys::getHostCPUName().str() << "\n";
+    config << "debuginfo " << compiler.is_debuginfo_enabled() << "\n";
+    config << compiler.get_precompiled_header_source() << "\n";
+
+    // 64-bit FNV-1a, which unlike std::hash is stable across processes and builds
+    uint64_t hash = 14695981039346656037ULL;
+    auto hash_text = [&hash](const string& text) {
+        for (unsigned char c : text)
+        {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+    };
+    hash_text(config.str());
+    hash_text(source);
+
+    stringstream key;
+    key << hex << setw(16) << setfill('0') << hash << "_" << dec << source.size();
+    return key.str();
+}
+
+unique_ptr<codegen::Module> codegen::Compiler::load_cached_module(const string& path,
+                                                                  LLVMContext& context)
+{
+    unique_ptr<codegen::Module> result;
+    if (!file_util::exists(path))
+    {
+        return result;
+    }
+
+    ErrorOr<unique_ptr<MemoryBuffer>> buffer = MemoryBuffer::getFile(path);
+    if (!buffer)
+    {
+        return result;
+    }
+    Expected<unique_ptr<llvm::Module>> module =
+        parseBitcodeFile((*buffer)->getMemBufferRef(), context);
+    if (!module)
+    {
+        // A truncated or foreign file; drop it so the next store replaces it
+        consumeError(module.takeError());
+        file_util::remove_file(path);
+        return result;
+    }
+
+    // Mark the entry as recently used for eviction
+    file_util::touch(path);
+    result.reset(new codegen::Module(move(*module)));
+    return result;
+}
+
+void codegen::Compiler::store_cached_module(codegen::Module& module, const string& path)
+{
+    // Write to a private file and rename it into place so concurrent writers sharing the
+    // cache never observe a partially written module. The file name is unique per call, as
+    // threads and Compilers of one process may store the same module at once.
+    int fd;
+    SmallString<128> tmp_path;
+    error_code ec = sys::fs::createUniqueFile(path + ".%%%%%%%%.tmp", fd, tmp_path);
+    if (ec)
+    {
+        NGRAPH_WARN << "Unable to write codegen cache file for " << path << ": " << ec.message();
+        return;
+    }
+    {
+        raw_fd_ostream out(fd, true);
+        WriteBitcodeToFile(module.get_module(), out);
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        file_util::remove_file(tmp_path.str());
+    }
+}
+
+void codegen::Compiler::trim_cache(const string& keep)
+{
+    vector<pair<time_t, string>> entries;
+    size_t total_size = 0;
+    file_util::iterate_files(m_cache_dir, [&](const string& file, bool is_dir) {
+        if (!is_dir && file_util::get_file_ext(file) == ".bc")
+        {
+            entries.push_back({file_util::get_timestamp(file), file});
+            total_size += file_util::get_file_size(file);
+        }
+    });
+
+    std::sort(entries.begin(), entries.end());
+    for (const pair<time_t, string>& entry : entries)
+    {
+        if (total_size <= m_cache_size_limit)
+        {
+            break;
+        }
+        if (entry.second != keep)
+        {
+            total_size -= file_util::get_file_size(entry.second);
+            file_util::remove_file(entry.second);
+        }
+    }
 }
 
 static std::string GetExecutablePath(const char* Argv0)
@@ -441,7 +708,14 @@ void codegen::StaticCompiler::load_headers_from_resource()
 
 void codegen::StaticCompiler::set_precompiled_header_source(const std::string& source)
 {
-    m_precomiled_header_source = source;
+    if (source != m_precomiled_header_source)
+    {
+        // Pooled compilers are handed the header of whichever caller uses them next, so a
+        // header built from different source must not be reused
+        m_precomiled_header_source = source;
+        m_precompiled_header_valid = false;
+        m_compiler->getInvocation().getPreprocessorOpts().ImplicitPCHInclude.clear();
+    }
 }
 
 string codegen::StaticCompiler::find_header_version(const string& path)
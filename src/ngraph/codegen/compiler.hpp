@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -40,6 +41,7 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
@@ -49,11 +51,22 @@ public:
     Module(std::unique_ptr<llvm::Module> module);
     ~Module();
     std::unique_ptr<llvm::Module> take_module();
-
+    llvm::Module* get_module() { return m_module.get(); }
 private:
     std::unique_ptr<llvm::Module> m_module;
 };
 
+/// \brief Compiles C++ source into an LLVM module.
+///
+/// When NGRAPH_CODEGEN_CACHE_DIR names a directory, compiled modules are stored there as
+/// bitcode keyed by a hash of the source and the compiler configuration, and later compiles
+/// of identical source load the bitcode instead of invoking clang. The cache is trimmed to
+/// NGRAPH_CODEGEN_CACHE_SIZE_MB (default 1024) by evicting the least recently used modules.
+///
+/// compile_modules() compiles independent sources concurrently on up to
+/// NGRAPH_CODEGEN_THREADS threads (default: the number of hardware threads), each with a
+/// clang instance of its own. The resulting modules may reference each other's symbols once
+/// they are added to the same ExecutionEngine.
 class ngraph::codegen::Compiler
 {
 public:
@@ -62,9 +75,43 @@ public:
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
+    /// \brief Compiles each source into a module of its own, in parallel. The modules are
+    /// returned in the order of their sources, with nullptr for any source that failed.
+    std::vector<std::unique_ptr<ngraph::codegen::Module>>
+        compile_modules(const std::vector<std::string>& sources);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
+    const std::string& get_cache_directory() const { return m_cache_dir; }
+    void set_cache_directory(const std::string& dir) { m_cache_dir = dir; }
+    size_t get_cache_size_limit() const { return m_cache_size_limit; }
+    void set_cache_size_limit(size_t bytes) { m_cache_size_limit = bytes; }
+    /// \brief Number of compiles served from the module cache by this compiler
+    size_t get_cache_hits() const { return m_cache_hits; }
+    size_t get_thread_count() const { return m_thread_count; }
+    void set_thread_count(size_t count) { m_thread_count = count; }
 private:
+    std::unique_ptr<ngraph::codegen::Module>
+        compile_source(ngraph::codegen::StaticCompiler& compiler,
+                       std::unique_ptr<clang::CodeGenAction>& compiler_action,
+                       llvm::LLVMContext& context,
+                       const std::string& source);
+    std::string get_cache_key(const ngraph::codegen::StaticCompiler& compiler,
+                              const std::string& source) const;
+    std::unique_ptr<ngraph::codegen::Module> load_cached_module(const std::string& path,
+                                                                llvm::LLVMContext& context);
+    void store_cached_module(ngraph::codegen::Module& module, const std::string& path);
+    void trim_cache(const std::string& keep);
+
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
+    // Owns the modules loaded from the cache; clang owns the ones it compiles
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    // Per-source equivalents of the two above for compile_modules
+    std::vector<std::unique_ptr<clang::CodeGenAction>> m_module_actions;
+    std::vector<std::unique_ptr<llvm::LLVMContext>> m_module_contexts;
+    std::string m_cache_dir;
+    size_t m_cache_size_limit;
+    size_t m_cache_hits;
+    std::mutex m_cache_mutex;
+    size_t m_thread_count;
 };
 
 class ngraph::codegen::StaticCompiler
@@ -74,14 +121,22 @@ public:
     ~StaticCompiler();
 
     void set_debuginfo_enabled(bool state) { m_debuginfo_enabled = state; }
-    bool is_debuginfo_enabled() { return m_debuginfo_enabled; }
+    bool is_debuginfo_enabled() const { return m_debuginfo_enabled; }
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
+    const std::vector<std::string>& get_header_search_paths() const
+    {
+        return m_extra_search_path_list;
+    }
 
     std::unique_ptr<ngraph::codegen::Module>
         compile(std::unique_ptr<clang::CodeGenAction>& compiler_action, const std::string& source);
     void generate_pch(const std::string& source);
     void initialize();
+    const std::string& get_precompiled_header_source() const
+    {
+        return m_precomiled_header_source;
+    }
 
 private:
     std::unique_ptr<clang::CompilerInstance> m_compiler;
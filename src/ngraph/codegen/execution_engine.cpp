@@ -52,6 +52,11 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
                 return false;
             }
         }
+        else
+        {
+            // MCJIT resolves symbols across all of its modules when the engine is finalized
+            m_execution_engine->addModule(module->take_module());
+        }
     }
     else
     {
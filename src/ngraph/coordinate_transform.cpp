@@ -167,6 +167,8 @@ CoordinateTransform::CoordinateTransform(const Shape& source_shape,
                                               source_start_corner[source_axis_order[axis]],
                                           source_strides[source_axis_order[axis]]));
     }
+
+    m_source_row_strides = row_major_strides(source_shape);
 }
 
 Strides CoordinateTransform::default_strides(size_t n_axes)
@@ -273,27 +275,32 @@ CoordinateTransform::CoordinateTransform(const Shape& source_shape)
 {
 }
 
-// Compute the index of a source-space coordinate in the buffer.
-size_t CoordinateTransform::index_source(const Coordinate& c) const
+// Compute the index of a target-space coordinate in the buffer. This is
+// index_source(to_source_coordinate(c)) without building the source coordinate.
+size_t CoordinateTransform::index(const Coordinate& c) const
 {
+    if (c.size() != m_n_axes)
+    {
+        throw std::domain_error(
+            "Target coordinate rank does not match the coordinate transform rank");
+    }
+
     size_t index = 0;
-    size_t stride = 1;
 
-    for (size_t axis = m_n_axes; axis-- > 0;)
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
     {
-        index += c[axis] * stride;
-        stride *= m_source_shape[axis];
+        size_t source_axis = m_source_axis_order[target_axis];
+
+        size_t pos_destrided = c[target_axis] * m_source_strides[source_axis];
+        size_t pos_deshifted = pos_destrided + m_source_start_corner[source_axis];
+        size_t pos_depadded = pos_deshifted - m_target_padding_below[target_axis];
+        size_t pos_dedilated = pos_depadded / m_target_dilation_strides[target_axis];
+        index += pos_dedilated * m_source_row_strides[source_axis];
     }
 
     return index;
 }
 
-// Compute the index of a target-space coordinate in thebuffer.
-size_t CoordinateTransform::index(const Coordinate& c) const
-{
-    return index_source(to_source_coordinate(c));
-}
-
 // Convert a target-space coordinate to a source-space coordinate.
 Coordinate CoordinateTransform::to_source_coordinate(const Coordinate& c_target) const
 {
@@ -376,6 +383,45 @@ const Shape& CoordinateTransform::get_target_shape() const
     return m_target_shape;
 }
 
+void CoordinateTransform::check_no_padding_or_dilation() const
+{
+    for (size_t axis = 0; axis < m_n_axes; axis++)
+    {
+        if (m_target_padding_below[axis] != 0 || m_target_padding_above[axis] != 0 ||
+            m_target_dilation_strides[axis] != 1)
+        {
+            throw std::domain_error(
+                "Linear source offsets are only defined for transforms without padding or "
+                "dilation");
+        }
+    }
+}
+
+std::ptrdiff_t CoordinateTransform::get_source_origin() const
+{
+    check_no_padding_or_dilation();
+
+    std::ptrdiff_t origin = 0;
+    for (size_t axis = 0; axis < m_n_axes; axis++)
+    {
+        origin += m_source_start_corner[axis] * m_source_row_strides[axis];
+    }
+    return origin;
+}
+
+std::vector<std::ptrdiff_t> CoordinateTransform::get_source_steps() const
+{
+    check_no_padding_or_dilation();
+
+    std::vector<std::ptrdiff_t> steps(m_n_axes);
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        size_t source_axis = m_source_axis_order[target_axis];
+        steps[target_axis] = m_source_strides[source_axis] * m_source_row_strides[source_axis];
+    }
+    return steps;
+}
+
 // The "is_end" parameter is true if we want the "end()" iterator.
 CoordinateTransform::Iterator::Iterator(const Shape& target_shape, bool is_end)
     : m_target_shape(target_shape)
@@ -66,6 +66,13 @@ namespace ngraph
         Coordinate to_source_coordinate(const Coordinate& c) const;
         const Shape& get_target_shape() const;
 
+        /// For a transform without padding or dilation, the source buffer offset of the
+        /// target coordinate (0,...,0) and the source offset step along each target axis.
+        /// Kernels pass these to a StridedWalk to visit the source without calling index()
+        /// for every element.
+        std::ptrdiff_t get_source_origin() const;
+        std::vector<std::ptrdiff_t> get_source_steps() const;
+
         const Shape& get_source_shape() const { return m_source_shape; }
         const Coordinate& get_source_start_corner() const { return m_source_start_corner; }
         const Coordinate& get_source_end_corner() const { return m_source_end_corner; }
@@ -95,7 +102,7 @@ namespace ngraph
         Iterator begin() noexcept { return Iterator(m_target_shape); }
         Iterator end() noexcept { return Iterator(m_target_shape, true); }
     private:
-        size_t index_source(const Coordinate& c) const;
+        void check_no_padding_or_dilation() const;
         static Strides default_strides(size_t n_axes);
         static CoordinateDiff default_padding(size_t n_axes);
         static AxisVector default_axis_order(size_t n_axes);
@@ -112,6 +119,7 @@ namespace ngraph
         Strides m_target_dilation_strides;
 
         Shape m_target_shape;
+        Strides m_source_row_strides;
         size_t m_n_axes;
     };
 }
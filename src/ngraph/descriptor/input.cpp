@@ -22,6 +22,8 @@
 using namespace ngraph;
 using namespace descriptor;
 
+std::atomic<size_t> Input::s_graph_version(0);
+
 Input::Input(Node* node, size_t index, Output& output)
     : m_node(node)
     , m_index(index)
@@ -37,6 +39,7 @@ void Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    s_graph_version++;
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "ngraph/descriptor/tensor.hpp"
@@ -58,6 +59,10 @@ namespace ngraph
             void replace_output(std::shared_ptr<Node> node, size_t i);
             void replace_output(Output& output);
 
+            /// @return a counter that changes whenever an input of any node is reconnected, so
+            ///         anything derived from graph edges can tell when it is out of date
+            static size_t get_graph_version() { return s_graph_version; }
+
         protected:
             /// @return the tensor view for the connected output
             std::shared_ptr<const TensorView> get_tensor_view() const;
@@ -83,6 +88,8 @@ namespace ngraph
             Output* m_output;
 
         private:
+            static std::atomic<size_t> s_graph_version;
+
             Input(const Input&) = delete;
             Input(Input&&) = delete;
             Input& operator=(const Input&) = delete;
@@ -35,3 +35,8 @@ const Shape& descriptor::layout::TensorViewLayout::get_shape() const
 {
     return m_tensor_view_type->get_shape();
 }
+
+size_t descriptor::layout::TensorViewLayout::get_allocated_size()
+{
+    return get_size() * get_element_type().size();
+}
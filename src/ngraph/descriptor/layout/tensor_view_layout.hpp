@@ -51,6 +51,10 @@ namespace ngraph
                 /// When we support non-linear buffers, this will need to be something other than size_t.
                 virtual size_t get_size() = 0;
 
+                /// Bytes needed to hold this view. Layouts that pad the data, such as blocked
+                /// formats, need more than the shape alone implies.
+                virtual size_t get_allocated_size();
+
                 /// Offset of an index; useful for slice implementation.
                 ///
                 /// With non-linear buffers, this will need to be something other than size_t.
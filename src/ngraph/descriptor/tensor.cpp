@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/descriptor/layout/tensor_view_layout.hpp"
 #include "ngraph/descriptor/primary_tensor_view.hpp"
 #include "ngraph/node.hpp"
 
@@ -52,6 +55,12 @@ size_t descriptor::Tensor::size() const
     return m_size;
 }
 
+size_t descriptor::Tensor::get_allocated_size() const
+{
+    auto& layout = m_primary_tensor_view->get_tensor_view_layout();
+    return layout ? max(m_size, layout->get_allocated_size()) : m_size;
+}
+
 void descriptor::Tensor::set_pool_offset(size_t offset)
 {
     m_pool_offset = offset;
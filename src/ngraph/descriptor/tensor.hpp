@@ -55,6 +55,9 @@ private:
 public:
     const std::string& get_name() const { return m_name; }
     size_t size() const;
+    /// Bytes to reserve for the tensor's buffer. This is size() unless the layout of the
+    /// tensor view pads the data.
+    size_t get_allocated_size() const;
     void set_pool_offset(size_t);
     size_t get_pool_offset() const;
     const element::Type& get_element_type() const { return m_element_type; }
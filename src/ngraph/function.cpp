@@ -35,6 +35,7 @@ Function::Function(const ResultVector& results,
     , m_parameters(parameters)
     , m_temporary_pool_size(0)
     , m_instance_id(m_next_instance_id.fetch_add(1))
+    , m_ordered_ops_version(0)
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
 {
@@ -48,6 +49,7 @@ Function::Function(const NodeVector& results,
     , m_parameters(parameters)
     , m_temporary_pool_size(0)
     , m_instance_id(m_next_instance_id.fetch_add(1))
+    , m_ordered_ops_version(0)
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
 {
@@ -91,7 +93,30 @@ void Function::init()
 
 std::list<shared_ptr<Node>> Function::get_ordered_ops()
 {
-    return topological_sort(get_ops());
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    size_t version = descriptor::Input::get_graph_version();
+    if (!m_ordered_ops.empty() && version == m_ordered_ops_version)
+    {
+        std::list<shared_ptr<Node>> ordered_ops;
+        for (const weak_ptr<Node>& weak_op : m_ordered_ops)
+        {
+            shared_ptr<Node> op = weak_op.lock();
+            if (op == nullptr)
+            {
+                break;
+            }
+            ordered_ops.push_back(op);
+        }
+        if (ordered_ops.size() == m_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
+    std::list<shared_ptr<Node>> ordered_ops = topological_sort(get_ops());
+    m_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    m_ordered_ops_version = version;
+    return ordered_ops;
 }
 
 const std::string& Function::get_friendly_name() const
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -75,6 +76,7 @@ namespace ngraph
         //  an XLA or regular function
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops() const;
+        /// The topological order is cached until the graph is next rewired.
         std::list<std::shared_ptr<Node>> get_ordered_ops();
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
@@ -94,6 +96,10 @@ namespace ngraph
 
         static std::atomic<size_t> m_next_instance_id;
         size_t m_instance_id;
+        // Weak, so that ops replaced since the last sort are not kept alive by the cache
+        std::vector<std::weak_ptr<Node>> m_ordered_ops;
+        size_t m_ordered_ops_version;
+        std::mutex m_ordered_ops_mutex;
         std::string m_name;
         const std::string m_unique_name;
     };
@@ -133,33 +133,29 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
 std::list<std::shared_ptr<ngraph::Node>>
     ngraph::topological_sort(const std::list<std::shared_ptr<Node>>& nodes)
 {
-    deque<ngraph::Node*> independent_nodes;
+    deque<shared_ptr<ngraph::Node>> independent_nodes;
     unordered_map<const ngraph::Node*, size_t> node_dependency_count;
-    unordered_map<ngraph::Node*, shared_ptr<ngraph::Node>> node_map;
+    node_dependency_count.reserve(nodes.size());
 
-    for (auto node : nodes)
+    for (auto& node : nodes)
     {
-        node_map[node.get()] = node;
-        node_dependency_count[node.get()] = node->get_arguments().size();
-        if (node->get_arguments().size() == 0)
+        size_t count = node->get_input_size();
+        node_dependency_count[node.get()] = count;
+        if (count == 0)
         {
-            independent_nodes.push_back(node.get());
+            independent_nodes.push_back(node);
         }
     }
 
     list<shared_ptr<ngraph::Node>> result_list;
     while (independent_nodes.size() > 0)
     {
-        auto independent_node = independent_nodes.front();
-        result_list.push_back(node_map[independent_node]);
+        result_list.push_back(move(independent_nodes.front()));
         independent_nodes.pop_front();
 
-        for (auto user_sp : independent_node->get_users())
+        for (auto& user : result_list.back()->get_users())
         {
-            Node* user = user_sp.get();
-            node_dependency_count[user] -= 1;
-            size_t count = node_dependency_count[user];
-            if (count == 0)
+            if (--node_dependency_count[user.get()] == 0)
             {
                 independent_nodes.push_back(user);
             }
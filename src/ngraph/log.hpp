@@ -119,6 +119,9 @@ namespace ngraph
                        __PRETTY_FUNCTION__)                                                        \
         .stream()
 #else
-#define NGRAPH_DEBUG ngraph::get_nil_stream()
+// The loop never runs, so the streamed arguments are not even evaluated
+#define NGRAPH_DEBUG                                                                               \
+    while (false)                                                                                  \
+    ngraph::get_nil_stream()
 #endif
 }
@@ -54,7 +54,7 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
+    if (m_data && !m_data_owner)
     {
         aligned_free(m_data);
     }
@@ -155,6 +155,10 @@ shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) co
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
+    if (m_data_owner)
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_data, m_data_owner);
+    }
     return make_shared<Constant>(m_element_type, m_shape, m_data);
 }
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstring>
+#include <memory>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -104,6 +105,28 @@ namespace ngraph
                 set_value_type_checked(vt);
             }
 
+            /// \brief Constructs a tensor constant that uses existing data in place instead of
+            ///        copying it, for instance data inside a memory mapped model file.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data A pointer to the constant data, which must stay valid as long as owner.
+            /// \param owner Whatever keeps data alive. The constant holds on to it until it is
+            ///        destroyed.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const void* data,
+                     const std::shared_ptr<void>& owner)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(const_cast<void*>(data))
+                , m_data_owner(owner)
+            {
+                auto vt = std::make_shared<TensorViewType>(type, shape);
+                set_value_type_checked(vt);
+            }
+
             virtual ~Constant() override;
 
             /// \brief Wrapper around constructing a shared_ptr of a Constant
@@ -242,6 +265,7 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape;
             void* m_data;
+            std::shared_ptr<void> m_data_owner;
         };
     }
 }
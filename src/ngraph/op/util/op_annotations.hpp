@@ -16,15 +16,54 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 namespace ngraph
 {
     namespace op
     {
         namespace util
         {
-            /// \brief Abstract base class for annotations added to graph ops
+            /// \brief An output of an op that may be written into the buffer of one of its inputs.
+            ///        A destructive pair overwrites the input, so it needs the op to be the last
+            ///        use of a temporary. A non-destructive pair leaves the data in place, like a
+            ///        reshape without transpose, and may also view a parameter or constant.
+            struct oi_pair
+            {
+                size_t output;
+                size_t input;
+                bool destructive;
+            };
+
+            /// \brief Base class for annotations added to graph ops
             class OpAnnotations
             {
+            public:
+                virtual ~OpAnnotations() {}
+                /// \brief Allows output oi.output to reuse the buffer of input oi.input when
+                ///        this op is the last use of that input. The op's kernel has to be safe
+                ///        to run with the two aliased. Pairs for the same output are alternatives,
+                ///        tried in the order they were added.
+                void add_in_place_oi_pair(const oi_pair& oi)
+                {
+                    for (const auto& existing : m_in_place_oi_pairs)
+                    {
+                        if (existing.output == oi.output && existing.input == oi.input)
+                        {
+                            return;
+                        }
+                    }
+                    m_in_place_oi_pairs.push_back(oi);
+                }
+
+                const std::vector<oi_pair>& get_in_place_oi_pairs() const
+                {
+                    return m_in_place_oi_pairs;
+                }
+
+            private:
+                std::vector<oi_pair> m_in_place_oi_pairs;
             };
         }
     }
@@ -0,0 +1,308 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "constant_folding.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/pad.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/maximum.hpp"
+#include "ngraph/runtime/reference/minimum.hpp"
+#include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/pad.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) std::type_index(typeid(x))
+
+using Arguments = vector<const void*>;
+
+// Each folder is instantiated for the C++ type T of the op's (first) input and writes the
+// result of node applied to args into out. It returns false if the op can't be folded.
+#define FOLDER_DECL(x)                                                                             \
+    template <typename T>                                                                          \
+    struct x                                                                                       \
+    {                                                                                              \
+        static bool fold(const Node& node, const Arguments& args, void* out);                      \
+    };                                                                                             \
+    template <typename T>                                                                          \
+    bool x<T>::fold(const Node& node, const Arguments& args, void* out)
+
+#define FOLD_BINARY_ELEMENTWISE(x, kernel)                                                         \
+    FOLDER_DECL(x)                                                                                 \
+    {                                                                                              \
+        runtime::reference::kernel<T>(static_cast<const T*>(args[0]),                              \
+                                      static_cast<const T*>(args[1]),                              \
+                                      static_cast<T*>(out),                                        \
+                                      shape_size(node.get_shape()));                               \
+        return true;                                                                               \
+    }
+
+FOLD_BINARY_ELEMENTWISE(FoldAdd, add)
+FOLD_BINARY_ELEMENTWISE(FoldSubtract, subtract)
+FOLD_BINARY_ELEMENTWISE(FoldMultiply, multiply)
+FOLD_BINARY_ELEMENTWISE(FoldMaximum, maximum)
+FOLD_BINARY_ELEMENTWISE(FoldMinimum, minimum)
+
+FOLDER_DECL(FoldDivide)
+{
+    size_t count = shape_size(node.get_shape());
+    const T* divisor = static_cast<const T*>(args[1]);
+    // Leave integer division by zero to fail at run time, as it would without folding
+    if (is_integral<T>::value && find(divisor, divisor + count, T(0)) != divisor + count)
+    {
+        return false;
+    }
+    runtime::reference::divide<T>(
+        static_cast<const T*>(args[0]), divisor, static_cast<T*>(out), count);
+    return true;
+}
+
+FOLDER_DECL(FoldNegative)
+{
+    runtime::reference::negate<T>(
+        static_cast<const T*>(args[0]), static_cast<T*>(out), shape_size(node.get_shape()));
+    return true;
+}
+
+FOLDER_DECL(FoldReshape)
+{
+    auto& reshape = static_cast<const op::Reshape&>(node);
+    runtime::reference::reshape<T>(static_cast<const T*>(args[0]),
+                                   static_cast<T*>(out),
+                                   reshape.get_input_shape(0),
+                                   reshape.get_input_order(),
+                                   node.get_shape());
+    return true;
+}
+
+FOLDER_DECL(FoldBroadcast)
+{
+    auto& broadcast = static_cast<const op::Broadcast&>(node);
+    runtime::reference::broadcast<T>(static_cast<const T*>(args[0]),
+                                     static_cast<T*>(out),
+                                     broadcast.get_input_shape(0),
+                                     node.get_shape(),
+                                     broadcast.get_broadcast_axes());
+    return true;
+}
+
+FOLDER_DECL(FoldSlice)
+{
+    auto& slice = static_cast<const op::Slice&>(node);
+    runtime::reference::slice<T>(static_cast<const T*>(args[0]),
+                                 static_cast<T*>(out),
+                                 slice.get_input_shape(0),
+                                 slice.get_lower_bounds(),
+                                 slice.get_upper_bounds(),
+                                 slice.get_strides(),
+                                 node.get_shape());
+    return true;
+}
+
+FOLDER_DECL(FoldPad)
+{
+    auto& pad = static_cast<const op::Pad&>(node);
+    runtime::reference::pad<T>(static_cast<const T*>(args[0]),
+                               static_cast<const T*>(args[1]),
+                               static_cast<T*>(out),
+                               pad.get_input_shape(0),
+                               node.get_shape(),
+                               pad.get_padding_below(),
+                               pad.get_padding_above(),
+                               pad.get_padding_interior());
+    return true;
+}
+
+// Calls F<T>::fold with T the C++ type of element type et
+template <template <typename> class F>
+static bool fold_as(const element::Type& et, const Node& node, const Arguments& args, void* out)
+{
+    if (et == element::boolean)
+    {
+        return F<char>::fold(node, args, out);
+    }
+    else if (et == element::f32)
+    {
+        return F<float>::fold(node, args, out);
+    }
+    else if (et == element::f64)
+    {
+        return F<double>::fold(node, args, out);
+    }
+    else if (et == element::i8)
+    {
+        return F<int8_t>::fold(node, args, out);
+    }
+    else if (et == element::i16)
+    {
+        return F<int16_t>::fold(node, args, out);
+    }
+    else if (et == element::i32)
+    {
+        return F<int32_t>::fold(node, args, out);
+    }
+    else if (et == element::i64)
+    {
+        return F<int64_t>::fold(node, args, out);
+    }
+    else if (et == element::u8)
+    {
+        return F<uint8_t>::fold(node, args, out);
+    }
+    else if (et == element::u16)
+    {
+        return F<uint16_t>::fold(node, args, out);
+    }
+    else if (et == element::u32)
+    {
+        return F<uint32_t>::fold(node, args, out);
+    }
+    else if (et == element::u64)
+    {
+        return F<uint64_t>::fold(node, args, out);
+    }
+    return false;
+}
+
+template <template <typename> class F>
+static bool fold(const Node& node, const Arguments& args, void* out)
+{
+    return fold_as<F>(node.get_input_element_type(0), node, args, out);
+}
+
+// Convert is instantiated for its input type first and then for its output type
+template <typename TI>
+struct ConvertFrom
+{
+    template <typename TO>
+    struct To
+    {
+        static bool fold(const Node& node, const Arguments& args, void* out)
+        {
+            runtime::reference::convert<TI, TO>(static_cast<const TI*>(args[0]),
+                                                static_cast<TO*>(out),
+                                                shape_size(node.get_shape()));
+            return true;
+        }
+    };
+};
+
+FOLDER_DECL(FoldConvert)
+{
+    auto& convert = static_cast<const op::Convert&>(node);
+    return fold_as<ConvertFrom<T>::template To>(
+        convert.get_convert_element_type(), node, args, out);
+}
+
+static const unordered_map<type_index, function<bool(const Node&, const Arguments&, void*)>>
+    dispatcher{{TI(op::Add), &fold<FoldAdd>},
+               {TI(op::Subtract), &fold<FoldSubtract>},
+               {TI(op::Multiply), &fold<FoldMultiply>},
+               {TI(op::Divide), &fold<FoldDivide>},
+               {TI(op::Maximum), &fold<FoldMaximum>},
+               {TI(op::Minimum), &fold<FoldMinimum>},
+               {TI(op::Negative), &fold<FoldNegative>},
+               {TI(op::Reshape), &fold<FoldReshape>},
+               {TI(op::Broadcast), &fold<FoldBroadcast>},
+               {TI(op::Convert), &fold<FoldConvert>},
+               {TI(op::Slice), &fold<FoldSlice>},
+               {TI(op::Pad), &fold<FoldPad>}};
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+
+    // Ops come in topological order and replace_node rewires the users, so a chain of
+    // foldable ops collapses in a single pass.
+    for (const auto& n : function->get_ordered_ops())
+    {
+        // Work around a warning [-Wpotentially-evaluated-expression]
+        const Node& node = *n;
+        auto handler = dispatcher.find(TI(node));
+        if (handler == dispatcher.end())
+        {
+            continue;
+        }
+
+        Arguments args;
+        size_t argument_bytes = 0;
+        for (const auto& arg : n->get_arguments())
+        {
+            auto constant = dynamic_pointer_cast<op::Constant>(arg);
+            if (!constant)
+            {
+                break;
+            }
+            args.push_back(constant->get_data_ptr());
+            argument_bytes +=
+                shape_size(constant->get_shape()) * constant->get_element_type().size();
+        }
+        if (args.size() != n->get_input_size())
+        {
+            continue;
+        }
+
+        const element::Type& et = n->get_element_type();
+        size_t bytes = shape_size(n->get_shape()) * et.size();
+        if (bytes == 0 || bytes > argument_bytes + m_max_expansion)
+        {
+            continue;
+        }
+
+        shared_ptr<void> data(ngraph::aligned_alloc(et.size(), bytes), ngraph::aligned_free);
+        if (!handler->second(node, args, data.get()))
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "Folding " << n->get_name() << " into a constant of " << bytes
+                     << " bytes";
+        ngraph::replace_node(n, make_shared<op::Constant>(et, n->get_shape(), data.get(), data));
+        replaced = true;
+    }
+
+    return replaced;
+}
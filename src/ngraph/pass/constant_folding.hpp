@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Replaces ops whose arguments are all constants by a constant holding the
+        ///        result, computed with the reference kernels.
+        ///
+        /// Handles Reshape, Broadcast, Convert, Slice, Pad and the elementwise arithmetic ops.
+        /// An op is only folded when its result is at most max_expansion bytes larger than the
+        /// constants it consumes, so a Broadcast of a scalar does not turn into a large
+        /// constant in the model.
+        class ConstantFolding : public FunctionPass
+        {
+        public:
+            ConstantFolding(size_t max_expansion = 0)
+                : m_max_expansion(max_expansion)
+            {
+            }
+
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+        private:
+            size_t m_max_expansion;
+        };
+    }
+}
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
 #include <memory>
 #include <set>
 #include <typeinfo>
@@ -31,14 +32,19 @@
 #include "ngraph/op/atan.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
 #include "ngraph/op/maximum.hpp"
+#include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/multiply.hpp"
@@ -47,9 +53,11 @@
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/remainder.hpp"
+#include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
 #include "ngraph/op/sinh.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
@@ -74,7 +82,90 @@ static bool cse_binarywise(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
     NGRAPH_DEBUG << "In cse_binary for " << a->get_name() << " and " << b->get_name();
 
     return (a->get_argument(0) == b->get_argument(0) && a->get_argument(1) == b->get_argument(1)) ||
-           (a->get_argument(1) == b->get_argument(0) && a->get_argument(0) == b->get_argument(1));
+           (a->is_commutative() && a->get_argument(1) == b->get_argument(0) &&
+            a->get_argument(0) == b->get_argument(1));
+}
+
+static bool cse_constant(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_constant for " << a->get_name() << " and " << b->get_name();
+
+    auto ca = std::static_pointer_cast<op::Constant>(a);
+    auto cb = std::static_pointer_cast<op::Constant>(b);
+    return ca->get_element_type() == cb->get_element_type() && ca->get_shape() == cb->get_shape() &&
+           std::memcmp(ca->get_data_ptr(),
+                       cb->get_data_ptr(),
+                       shape_size(ca->get_shape()) * ca->get_element_type().size()) == 0;
+}
+
+static bool cse_reshape(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_reshape for " << a->get_name() << " and " << b->get_name();
+
+    auto ra = std::static_pointer_cast<op::Reshape>(a);
+    auto rb = std::static_pointer_cast<op::Reshape>(b);
+    return ra->get_argument(0) == rb->get_argument(0) &&
+           ra->get_input_order() == rb->get_input_order() &&
+           ra->get_output_shape() == rb->get_output_shape();
+}
+
+static bool cse_broadcast(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_broadcast for " << a->get_name() << " and " << b->get_name();
+
+    auto ba = std::static_pointer_cast<op::Broadcast>(a);
+    auto bb = std::static_pointer_cast<op::Broadcast>(b);
+    return ba->get_argument(0) == bb->get_argument(0) &&
+           ba->get_broadcast_axes() == bb->get_broadcast_axes() &&
+           ba->get_broadcast_shape() == bb->get_broadcast_shape();
+}
+
+static bool cse_slice(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_slice for " << a->get_name() << " and " << b->get_name();
+
+    auto sa = std::static_pointer_cast<op::Slice>(a);
+    auto sb = std::static_pointer_cast<op::Slice>(b);
+    return sa->get_argument(0) == sb->get_argument(0) &&
+           sa->get_lower_bounds() == sb->get_lower_bounds() &&
+           sa->get_upper_bounds() == sb->get_upper_bounds() &&
+           sa->get_strides() == sb->get_strides();
+}
+
+static bool cse_convert(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_convert for " << a->get_name() << " and " << b->get_name();
+
+    return a->get_argument(0) == b->get_argument(0) &&
+           std::static_pointer_cast<op::Convert>(a)->get_convert_element_type() ==
+               std::static_pointer_cast<op::Convert>(b)->get_convert_element_type();
+}
+
+static bool cse_dot(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_dot for " << a->get_name() << " and " << b->get_name();
+
+    return a->get_argument(0) == b->get_argument(0) && a->get_argument(1) == b->get_argument(1) &&
+           std::static_pointer_cast<op::Dot>(a)->get_reduction_axes_count() ==
+               std::static_pointer_cast<op::Dot>(b)->get_reduction_axes_count();
+}
+
+static bool cse_concat(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_concat for " << a->get_name() << " and " << b->get_name();
+
+    return a->get_arguments() == b->get_arguments() &&
+           std::static_pointer_cast<op::Concat>(a)->get_concatenation_axis() ==
+               std::static_pointer_cast<op::Concat>(b)->get_concatenation_axis();
+}
+
+static bool cse_reduction(std::shared_ptr<Node> a, std::shared_ptr<Node> b)
+{
+    NGRAPH_DEBUG << "In cse_reduction for " << a->get_name() << " and " << b->get_name();
+
+    return a->get_argument(0) == b->get_argument(0) &&
+           std::static_pointer_cast<op::util::ArithmeticReduction>(a)->get_reduction_axes() ==
+               std::static_pointer_cast<op::util::ArithmeticReduction>(b)->get_reduction_axes();
 }
 
 static std::unordered_map<std::type_index,
@@ -110,6 +201,17 @@ static std::unordered_map<std::type_index,
         {TI(op::Power), cse_binarywise},
         //{TI(op::Remainder), cse_binarywise},
         {TI(op::Subtract), cse_binarywise},
+        {TI(op::Constant), cse_constant},
+        {TI(op::Reshape), cse_reshape},
+        {TI(op::Broadcast), cse_broadcast},
+        {TI(op::Slice), cse_slice},
+        {TI(op::Convert), cse_convert},
+        {TI(op::Dot), cse_dot},
+        {TI(op::Concat), cse_concat},
+        {TI(op::Sum), cse_reduction},
+        {TI(op::Product), cse_reduction},
+        {TI(op::Max), cse_reduction},
+        {TI(op::Min), cse_reduction},
     });
 }
 
@@ -117,15 +219,82 @@ static std::unordered_map<std::type_index,
                           std::function<bool(std::shared_ptr<Node>, std::shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+static size_t hash_data(const void* data, size_t size)
+{
+    // FNV-1a over 8 byte words
+    const char* bytes = static_cast<const char*>(data);
+    uint64_t hash = 14695981039346656037ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 1099511628211ULL;
+    }
+    for (; i < size; i++)
+    {
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
+static size_t hash_node(const std::shared_ptr<Node>& node)
+{
+    Node& p_this = *node.get();
+    auto ti = TI(p_this);
+
+    std::hash<std::type_index> type_hash_compute{};
+    auto type_hash = type_hash_compute(ti);
+
+    std::vector<size_t> arg_ids;
+
+    arg_ids.push_back(type_hash);
+
+    auto cargs = node->get_arguments();
+
+    //TODO: Do we need another map, so we could
+    //specify how to compute hash for each op?
+    if (p_this.is_commutative())
+    {
+        std::sort(begin(cargs), end(cargs));
+    }
+
+    for (auto arg : cargs)
+    {
+        arg_ids.push_back(arg->get_instance_id());
+    }
+
+    // Nodes of the same type on the same arguments mostly differ in their attributes, which
+    // show in the result shape
+    if (node->get_output_size() == 1)
+    {
+        for (auto d : node->get_shape())
+        {
+            arg_ids.push_back(d);
+        }
+    }
+
+    if (auto constant = std::dynamic_pointer_cast<op::Constant>(node))
+    {
+        arg_ids.push_back(hash_data(
+            constant->get_data_ptr(),
+            shape_size(constant->get_shape()) * constant->get_element_type().size()));
+    }
+
+    return ngraph::hash_combine(arg_ids);
+}
+
 class NodeKey
 {
 public:
     NodeKey(std::shared_ptr<Node> n)
         : m_node(n)
+        , m_hash(hash_node(n))
     {
     }
 
     std::shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
     bool operator==(const NodeKey& other) const
     {
         Node& p_this = *m_node.get();
@@ -147,6 +316,8 @@ public:
 
 private:
     std::shared_ptr<Node> m_node;
+    // Hashing a constant reads all of its data, so it is done once per node
+    size_t m_hash;
 };
 
 namespace std
@@ -154,35 +325,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        std::size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            std::hash<std::type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            std::vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            auto cargs = k.get_node()->get_arguments();
-
-            //TODO: Do we need another map, so we could
-            //specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                std::sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg->get_instance_id());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        std::size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -194,16 +337,18 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
 
     for (auto n : f->get_ordered_ops())
     {
-        if (n->is_output() || n->is_parameter() ||
-            n->is_constant() /*we could CSE constants as well*/)
+        // Work around a warning [-Wpotentially-evaluated-expression]
+        const Node& node = *n;
+        if (n->is_output() || n->is_parameter() || ops_to_cse_handlers.count(TI(node)) == 0)
         {
             continue;
         }
 
         NodeKey n_key{n};
-        if (expressions.count(n_key))
+        auto expression = expressions.find(n_key);
+        if (expression != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            ngraph::replace_node(n, expression->second);
             replaced = true;
         }
         else
@@ -16,11 +16,130 @@
 
 #include <algorithm>
 #include <iostream>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+
+#define TI(x) std::type_index(typeid(x))
+
+namespace
+{
+    // Picks the matchers worth trying on a node. A pattern rooted at a regular op can only
+    // match nodes of exactly that type, while one rooted at a Label, Skip or Any can match
+    // anything. The candidates keep the order the matchers were added in.
+    template <typename M>
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const std::vector<std::shared_ptr<M>>& matchers)
+            : m_matchers(matchers)
+        {
+        }
+
+        const std::vector<std::shared_ptr<M>>& candidates(const ngraph::Node& node)
+        {
+            auto type = TI(node);
+            auto it = m_candidates.find(type);
+            if (it == m_candidates.end())
+            {
+                std::vector<std::shared_ptr<M>> candidates;
+                for (auto& matcher : m_matchers)
+                {
+                    auto pattern = matcher->get_pattern();
+                    const ngraph::Node& root = *pattern;
+                    if (std::dynamic_pointer_cast<ngraph::pattern::op::Pattern>(pattern) ||
+                        TI(root) == type)
+                    {
+                        candidates.push_back(matcher);
+                    }
+                }
+                it = m_candidates.emplace(type, std::move(candidates)).first;
+            }
+            return it->second;
+        }
+
+    private:
+        const std::vector<std::shared_ptr<M>>& m_matchers;
+        std::unordered_map<std::type_index, std::vector<std::shared_ptr<M>>> m_candidates;
+    };
+
+    // A node that an earlier rewrite in the same sweep replaced has no users left
+    bool is_replaced(const std::shared_ptr<ngraph::Node>& node)
+    {
+        return !node->is_output() && !node->is_parameter() && node->get_users().empty();
+    }
+
+    // Tells whether a node still leads to a result. Unlike is_replaced this also catches nodes
+    // only used by replaced nodes, which stay wired to them. Answers are kept until the graph
+    // is rewired again.
+    class LiveNodes
+    {
+    public:
+        bool is_live(const std::shared_ptr<ngraph::Node>& node)
+        {
+            size_t version = ngraph::descriptor::Input::get_graph_version();
+            if (version != m_version)
+            {
+                m_live.clear();
+                m_version = version;
+            }
+
+            // Search up through the users for a result or a node known to be live. If one is
+            // found, every node on the way from node to it is live, otherwise all visited
+            // nodes are dead.
+            std::unordered_map<ngraph::Node*, ngraph::Node*> parent{{node.get(), nullptr}};
+            std::vector<std::shared_ptr<ngraph::Node>> stack{node};
+            ngraph::Node* found = nullptr;
+            while (!stack.empty() && !found)
+            {
+                auto n = stack.back();
+                stack.pop_back();
+                auto known = m_live.find(n.get());
+                if ((known != m_live.end() && known->second) || n->is_output() ||
+                    n->is_parameter())
+                {
+                    found = n.get();
+                }
+                else if (known == m_live.end())
+                {
+                    for (auto& user : n->get_users())
+                    {
+                        if (parent.emplace(user.get(), n.get()).second)
+                        {
+                            stack.push_back(user);
+                        }
+                    }
+                }
+            }
+
+            if (found)
+            {
+                for (ngraph::Node* n = found; n; n = parent.at(n))
+                {
+                    m_live[n] = true;
+                }
+            }
+            else
+            {
+                for (auto& visited : parent)
+                {
+                    m_live[visited.first] = false;
+                }
+            }
+            return found != nullptr;
+        }
+
+    private:
+        size_t m_version = 0;
+        std::unordered_map<ngraph::Node*, bool> m_live;
+    };
+}
 
 bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     const std::list<std::shared_ptr<ngraph::Node>>& nodes,
@@ -28,9 +147,14 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
+    MatcherIndex<pattern::Matcher> index(matchers);
     for (auto node : nodes)
     {
-        for (auto matcher : matchers)
+        if (is_replaced(node))
+        {
+            continue;
+        }
+        for (auto matcher : index.candidates(*node))
         {
             NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node << " , "
                          << node->get_name() << " , is_output = " << node->is_output();
@@ -57,12 +181,24 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool changed = false;
-    size_t i = 0;
-    do
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
+
+    // The first sweep visits every node. Later sweeps only visit the nodes a fusion created
+    // and their users, since nothing else can start matching after a rewrite.
+    std::list<std::shared_ptr<Node>> nodes = f->get_ops();
+    std::unordered_set<size_t> visited;
+    LiveNodes live_nodes;
+    for (size_t i = 0; i < m_num_iters && !nodes.empty(); i++)
     {
-        for (auto node : f->get_ops())
+        bool fused = false;
+        for (auto node : nodes)
         {
-            for (auto matcher : m_matchers)
+            visited.insert(node->get_instance_id());
+            if (!live_nodes.is_live(node))
+            {
+                continue;
+            }
+            for (auto matcher : index.candidates(*node))
             {
                 NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node << " , "
                              << node->get_name() << " , is_output = " << node->is_output();
@@ -72,14 +208,39 @@ bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph
                                  << node->get_name();
                     if (matcher->process_match())
                     {
-                        changed = true;
-                        goto next_fusion;
+                        fused = true;
+                        break;
                     }
                 }
             }
         }
-    next_fusion:
-        i++;
-    } while (changed && i < m_num_iters);
+        if (!fused)
+        {
+            break;
+        }
+        changed = true;
+
+        auto ops = f->get_ops();
+        std::unordered_set<Node*> affected;
+        for (auto node : ops)
+        {
+            if (visited.count(node->get_instance_id()) == 0)
+            {
+                affected.insert(node.get());
+                for (auto user : node->get_users())
+                {
+                    affected.insert(user.get());
+                }
+            }
+        }
+        nodes.clear();
+        for (auto node : ops)
+        {
+            if (affected.count(node.get()) != 0)
+            {
+                nodes.push_back(node);
+            }
+        }
+    }
     return changed;
 }
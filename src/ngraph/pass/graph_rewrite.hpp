@@ -43,6 +43,8 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// A matcher is only tried on nodes of the same op type as its pattern's root, unless the root
+/// is a Label, Skip or Any
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
@@ -65,6 +67,10 @@ private:
     std::vector<std::shared_ptr<pattern::Matcher>> m_matchers;
 };
 
+/// \brief RecurrentGraphRewrite runs \sa RecurrentMatcher callbacks until no more cells fuse
+///
+/// The first sweep visits every node. Each later sweep only revisits the nodes created by the
+/// previous sweep's rewrites and their users. \p num_iters bounds the number of sweeps.
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
 {
 public:
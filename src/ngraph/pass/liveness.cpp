@@ -25,6 +25,7 @@
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/op.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pass/liveness.hpp"
@@ -55,6 +56,11 @@ bool pass::Liveness::run_on_function(shared_ptr<ngraph::Function> function)
             persistent_tensors.insert(&tensor);
             output_tensors.insert(&tensor);
         }
+        // A result without a copy has its argument computed straight into the output
+        if (!node->needs_copy())
+        {
+            persistent_tensors.insert(&node->get_inputs().at(0).get_tensor());
+        }
     }
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
@@ -68,6 +74,24 @@ bool pass::Liveness::run_on_function(shared_ptr<ngraph::Function> function)
         }
     }
 
+    // A non-destructive in-place output of a persistent tensor is a view of its storage
+    for (shared_ptr<Node> node : ops)
+    {
+        auto op = dynamic_pointer_cast<op::Op>(node);
+        if (!op || !op->get_op_annotations())
+        {
+            continue;
+        }
+        for (const op::util::oi_pair& oi : op->get_op_annotations()->get_in_place_oi_pairs())
+        {
+            descriptor::Tensor* input = &node->get_inputs().at(oi.input).get_tensor();
+            if (!oi.destructive && contains(persistent_tensors, input))
+            {
+                persistent_tensors.insert(&node->get_output_tensor(oi.output));
+            }
+        }
+    }
+
     unordered_set<descriptor::Tensor*> currently_live;
     for (auto it = ops.rbegin(); it != ops.rend(); it++)
     {
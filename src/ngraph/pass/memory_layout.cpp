@@ -14,11 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <exception>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
-#include "ngraph/log.hpp"
+#include "ngraph/op/op.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
@@ -27,27 +30,50 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 planning_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(scheme)
 {
 }
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
+    if (m_scheme == planning_scheme::OFFLINE)
+    {
+        plan_offline(function);
+        return false;
+    }
+
     MemoryManager mm(m_alignment);
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
+        map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        set<const descriptor::Tensor*> reused_inputs;
+        if (!m_disable_memory_sharing)
+        {
+            find_in_place_outputs(node, in_place_outputs, reused_inputs);
+        }
+
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = mm.allocate(tensor->size());
+            auto it = in_place_outputs.find(tensor);
+            size_t offset = it != in_place_outputs.end()
+                                ? it->second->get_pool_offset()
+                                : mm.allocate(tensor->get_allocated_size());
             tensor->set_pool_offset(offset);
         }
         if (!m_disable_memory_sharing)
         {
             for (const descriptor::Tensor* tensor : node->liveness_free_list)
             {
-                mm.free(tensor->get_pool_offset());
+                // The buffer of a reused input lives on in the output that took it over
+                if (reused_inputs.count(tensor) == 0)
+                {
+                    mm.free(tensor->get_pool_offset());
+                }
             }
         }
     }
@@ -56,6 +82,81 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
     return false;
 }
 
+void pass::MemoryLayout::plan_offline(const shared_ptr<ngraph::Function>& function)
+{
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    size_t last_step = ops.empty() ? 0 : ops.size() - 1;
+
+    // Step i allocates the new tensors of the i-th op and then frees its dead ones, so a
+    // tensor freed at step i is live at step i. An in-place output continues its input's buffer.
+    MemoryPlanner planner(m_alignment);
+    unordered_map<descriptor::Tensor*, size_t> buffers;
+    size_t step = 0;
+    for (shared_ptr<Node> node : ops)
+    {
+        map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        set<const descriptor::Tensor*> reused_inputs;
+        if (!m_disable_memory_sharing)
+        {
+            find_in_place_outputs(node, in_place_outputs, reused_inputs);
+        }
+
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            auto it = in_place_outputs.find(tensor);
+            buffers[tensor] = it != in_place_outputs.end()
+                                  ? buffers.at(it->second)
+                                  : planner.add_buffer(tensor->get_allocated_size(), step, last_step);
+        }
+        if (!m_disable_memory_sharing)
+        {
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
+            {
+                if (reused_inputs.count(tensor) == 0)
+                {
+                    planner.set_end(buffers.at(tensor), step);
+                }
+            }
+        }
+        step++;
+    }
+
+    planner.plan();
+    for (const auto& p : buffers)
+    {
+        p.first->set_pool_offset(planner.get_offset(p.second));
+    }
+    function->set_temporary_pool_size(planner.max_allocated());
+}
+
+void pass::MemoryLayout::find_in_place_outputs(
+    const shared_ptr<Node>& node,
+    map<descriptor::Tensor*, descriptor::Tensor*>& in_place_outputs,
+    set<const descriptor::Tensor*>& reused_inputs)
+{
+    auto op = dynamic_pointer_cast<op::Op>(node);
+    if (!op || !op->get_op_annotations())
+    {
+        return;
+    }
+    for (const op::util::oi_pair& oi : op->get_op_annotations()->get_in_place_oi_pairs())
+    {
+        descriptor::Tensor* output = &node->get_output_tensor(oi.output);
+        descriptor::Tensor* input = &node->get_inputs().at(oi.input).get_tensor();
+
+        // The input must be a temporary that dies here and the output a temporary born here.
+        // Parameters, constants and results are never in these lists.
+        if (node->liveness_free_list.count(input) != 0 &&
+            node->liveness_new_list.count(output) != 0 && in_place_outputs.count(output) == 0 &&
+            reused_inputs.count(input) == 0 &&
+            output->get_allocated_size() <= input->get_allocated_size())
+        {
+            in_place_outputs.insert({output, input});
+            reused_inputs.insert(input);
+        }
+    }
+}
+
 pass::MemoryManager::node::node(size_t size, block_state state)
     : m_size{size}
     , m_state{state}
@@ -226,3 +327,219 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+pass::MemoryPlanner::MemoryPlanner(size_t alignment)
+    : m_alignment{alignment}
+    , m_max_allocated{0}
+{
+}
+
+size_t pass::MemoryPlanner::add_buffer(size_t size, size_t begin, size_t end)
+{
+    m_buffers.push_back({MemoryManager::align(size, m_alignment), begin, end, 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPlanner::set_end(size_t id, size_t end)
+{
+    m_buffers.at(id).end = end;
+}
+
+namespace
+{
+    size_t steps_of(const vector<size_t>& ends)
+    {
+        return 1 + *max_element(ends.begin(), ends.end());
+    }
+
+    // Finds the lifetimes overlapping a given one. Two lifetimes overlap when one of them
+    // contains the begin step of the other. The lifetimes containing a step come from a segment
+    // tree in which each lifetime is stored at the nodes tiling it, and the ones beginning inside
+    // a lifetime are a run of the lifetimes sorted by begin.
+    class LifetimeIndex
+    {
+    public:
+        LifetimeIndex(const vector<size_t>& begins, const vector<size_t>& ends)
+            : m_begins(begins)
+            , m_ends(ends)
+            , m_leaves(1)
+            , m_by_begin(begins.size())
+        {
+            size_t steps = steps_of(ends);
+            while (m_leaves < steps)
+            {
+                m_leaves <<= 1;
+            }
+            m_tree.resize(2 * m_leaves);
+            for (size_t id = 0; id < begins.size(); id++)
+            {
+                for (size_t l = begins[id] + m_leaves, r = ends[id] + m_leaves + 1; l < r;
+                     l >>= 1, r >>= 1)
+                {
+                    if (l & 1)
+                    {
+                        m_tree[l++].push_back(id);
+                    }
+                    if (r & 1)
+                    {
+                        m_tree[--r].push_back(id);
+                    }
+                }
+            }
+
+            iota(m_by_begin.begin(), m_by_begin.end(), 0);
+            sort(m_by_begin.begin(), m_by_begin.end(), [&](size_t a, size_t b) {
+                return begins[a] < begins[b];
+            });
+            for (size_t id : m_by_begin)
+            {
+                m_sorted_begins.push_back(begins[id]);
+            }
+        }
+
+        // Calls f for every lifetime overlapping lifetime id, including id itself
+        template <typename F>
+        void for_each_overlap(size_t id, const F& f) const
+        {
+            for (size_t node = m_begins[id] + m_leaves; node >= 1; node >>= 1)
+            {
+                for (size_t other : m_tree[node])
+                {
+                    f(other);
+                }
+            }
+            auto first = upper_bound(m_sorted_begins.begin(), m_sorted_begins.end(), m_begins[id]);
+            auto last = upper_bound(first, m_sorted_begins.end(), m_ends[id]);
+            for (auto it = first; it != last; ++it)
+            {
+                f(m_by_begin[it - m_sorted_begins.begin()]);
+            }
+        }
+
+    private:
+        const vector<size_t>& m_begins;
+        const vector<size_t>& m_ends;
+        size_t m_leaves;
+        vector<vector<size_t>> m_tree;
+        vector<size_t> m_by_begin;
+        vector<size_t> m_sorted_begins;
+    };
+
+    // Places the buffers in the given order, each in the tightest gap between the placed
+    // buffers it overlaps or above them, and returns the peak
+    size_t place(const vector<size_t>& order,
+                 const vector<size_t>& sizes,
+                 const LifetimeIndex& index,
+                 vector<size_t>& offsets)
+    {
+        // Offset and end of each buffer side by side, so an overlap costs one lookup
+        const size_t unplaced = numeric_limits<size_t>::max();
+        vector<pair<size_t, size_t>> ranges(sizes.size(), {unplaced, unplaced});
+        vector<pair<size_t, size_t>> taken;
+        size_t peak = 0;
+        for (size_t id : order)
+        {
+            taken.clear();
+            index.for_each_overlap(id, [&](size_t other) {
+                if (ranges[other].first != unplaced)
+                {
+                    taken.push_back(ranges[other]);
+                }
+            });
+            sort(taken.begin(),
+                 taken.end(),
+                 [](const pair<size_t, size_t>& a, const pair<size_t, size_t>& b) {
+                     return a.first < b.first;
+                 });
+
+            size_t size = sizes[id];
+            size_t best_offset = unplaced;
+            size_t best_gap = unplaced;
+            size_t top = 0;
+            for (const auto& range : taken)
+            {
+                if (range.first >= top + size && range.first - top < best_gap)
+                {
+                    best_offset = top;
+                    best_gap = range.first - top;
+                }
+                top = max(top, range.second);
+            }
+            size_t offset = best_offset != unplaced ? best_offset : top;
+            ranges[id] = {offset, offset + size};
+            offsets[id] = offset;
+            peak = max(peak, offset + size);
+        }
+        return peak;
+    }
+}
+
+void pass::MemoryPlanner::plan()
+{
+    m_max_allocated = 0;
+    size_t count = m_buffers.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    vector<size_t> sizes(count);
+    vector<size_t> begins(count);
+    vector<size_t> ends(count);
+    for (size_t id = 0; id < count; id++)
+    {
+        sizes[id] = m_buffers[id].size;
+        begins[id] = m_buffers[id].begin;
+        ends[id] = m_buffers[id].end;
+    }
+    LifetimeIndex index(begins, ends);
+
+    // Largest first, longer lifetimes breaking ties since they constrain more buffers
+    vector<size_t> by_size(count);
+    iota(by_size.begin(), by_size.end(), 0);
+    sort(by_size.begin(), by_size.end(), [&](size_t a, size_t b) {
+        if (sizes[a] != sizes[b])
+        {
+            return sizes[a] > sizes[b];
+        }
+        if (ends[a] - begins[a] != ends[b] - begins[b])
+        {
+            return ends[a] - begins[a] > ends[b] - begins[b];
+        }
+        return a < b;
+    });
+    vector<size_t> by_size_offsets(count);
+    size_t by_size_peak = place(by_size, sizes, index, by_size_offsets);
+
+    // Size order does badly when many large buffers have short, scattered lifetimes. Placing
+    // in creation order covers that case, and that is what MemoryManager does online.
+    vector<vector<size_t>> created(steps_of(ends));
+    vector<vector<size_t>> freed(created.size());
+    for (size_t id = 0; id < count; id++)
+    {
+        created[begins[id]].push_back(id);
+        freed[ends[id]].push_back(id);
+    }
+    MemoryManager mm(m_alignment);
+    vector<size_t> by_begin_offsets(count);
+    for (size_t step = 0; step < created.size(); step++)
+    {
+        for (size_t id : created[step])
+        {
+            by_begin_offsets[id] = mm.allocate(sizes[id]);
+        }
+        for (size_t id : freed[step])
+        {
+            mm.free(by_begin_offsets[id]);
+        }
+    }
+    size_t by_begin_peak = mm.max_allocated();
+
+    const vector<size_t>& offsets =
+        by_size_peak <= by_begin_peak ? by_size_offsets : by_begin_offsets;
+    for (size_t id = 0; id < count; id++)
+    {
+        m_buffers[id].offset = offsets[id];
+    }
+    m_max_allocated = min(by_size_peak, by_begin_peak);
+}
@@ -18,7 +18,10 @@
 
 #include <limits>
 #include <list>
+#include <map>
+#include <set>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +32,39 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPlanner;
     }
 }
 
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    enum class planning_scheme
+    {
+        // Place each tensor when it is created, MemoryManager best fit
+        ONLINE,
+        // Collect every lifetime first and place them with MemoryPlanner
+        OFFLINE
+    };
+
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 planning_scheme scheme = planning_scheme::ONLINE);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
+    void plan_offline(const std::shared_ptr<ngraph::Function>& function);
+
+    /// Pairs each output that takes over an input buffer, per the op's in-place annotations,
+    /// with that input
+    static void
+        find_in_place_outputs(const std::shared_ptr<Node>& node,
+                              std::map<descriptor::Tensor*, descriptor::Tensor*>& in_place_outputs,
+                              std::set<const descriptor::Tensor*>& reused_inputs);
+
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    planning_scheme m_scheme;
 };
 
 class ngraph::pass::MemoryManager
@@ -93,3 +117,37 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Static placement of buffers whose lifetimes are all known up front
+///
+/// Each buffer goes in the tightest gap between the buffers already placed that are live at
+/// the same time, or above them all. Buffers are placed largest first and again in creation
+/// order, and the smaller of the two layouts is kept. Finding the overlapping buffers is a
+/// segment tree stabbing query plus a binary search, so planning scales with the number of
+/// overlapping lifetimes rather than with the square of the buffer count.
+class ngraph::pass::MemoryPlanner
+{
+public:
+    MemoryPlanner(size_t alignment = 1);
+
+    /// Adds a buffer live from step begin through step end, both inclusive, and returns its id
+    size_t add_buffer(size_t size, size_t begin, size_t end);
+    void set_end(size_t id, size_t end);
+
+    void plan();
+
+    size_t get_offset(size_t id) const { return m_buffers.at(id).offset; }
+    size_t max_allocated() const { return m_max_allocated; }
+private:
+    struct buffer
+    {
+        size_t size;
+        size_t begin;
+        size_t end;
+        size_t offset;
+    };
+
+    std::vector<buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_max_allocated;
+};
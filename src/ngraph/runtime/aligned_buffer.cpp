@@ -27,6 +27,8 @@ runtime::AlignedBuffer::AlignedBuffer()
 }
 
 runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment)
+    : m_allocated_buffer(nullptr)
+    , m_aligned_buffer(nullptr)
 {
     initialize(byte_size, alignment);
 }
@@ -14,8 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <condition_variable>
+#include <deque>
 #include <dlfcn.h>
 #include <sstream>
+#include <thread>
 
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
@@ -24,6 +27,99 @@
 using namespace std;
 using namespace ngraph;
 
+// The calls of a function started by call_async. Each call in flight has a thread to run it.
+// A thread exits as soon as no calls are queued, so an idle function keeps no threads. Threads
+// hold the queue, so it outlives the backend's handle to it.
+class runtime::Backend::AsyncQueue : public enable_shared_from_this<AsyncQueue>
+{
+public:
+    AsyncQueue(size_t max_in_flight)
+        : m_max_in_flight(max_in_flight)
+        , m_in_flight(0)
+        , m_threads(0)
+    {
+    }
+
+    future<bool> submit(function<bool()> call)
+    {
+        packaged_task<bool()> task(move(call));
+        future<bool> result = task.get_future();
+        bool start_thread = false;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_space.wait(lock, [this]() { return m_in_flight < m_max_in_flight; });
+            m_in_flight++;
+            m_pending.push_back(move(task));
+            if (m_threads < m_in_flight)
+            {
+                m_threads++;
+                start_thread = true;
+            }
+        }
+        if (start_thread)
+        {
+            thread(&AsyncQueue::run, shared_from_this()).detach();
+        }
+        return result;
+    }
+
+    // Waits until every call submitted so far has finished
+    void wait()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_idle.wait(lock, [this]() { return m_in_flight == 0; });
+    }
+
+    void set_max_in_flight(size_t count)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_max_in_flight = count;
+        }
+        m_space.notify_all();
+    }
+
+    size_t get_max_in_flight() const
+    {
+        lock_guard<mutex> lock(m_mutex);
+        return m_max_in_flight;
+    }
+
+private:
+    void run()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        while (!m_pending.empty())
+        {
+            {
+                // The call's arguments are released before it counts as finished
+                packaged_task<bool()> task = move(m_pending.front());
+                m_pending.pop_front();
+                lock.unlock();
+                task();
+            }
+            lock.lock();
+            m_in_flight--;
+            m_space.notify_one();
+            if (m_in_flight == 0)
+            {
+                m_idle.notify_all();
+            }
+        }
+        m_threads--;
+    }
+
+    size_t m_max_in_flight;
+    // Calls submitted and not finished
+    size_t m_in_flight;
+    // Threads started and not exited
+    size_t m_threads;
+    deque<packaged_task<bool()>> m_pending;
+    mutable mutex m_mutex;
+    condition_variable m_space;
+    condition_variable m_idle;
+};
+
 bool runtime::Backend::register_backend(const string& name, shared_ptr<Backend> backend)
 {
     get_backend_map().insert({name, backend});
@@ -101,8 +197,95 @@ vector<string> runtime::Backend::get_registered_devices()
     return rc;
 }
 
+shared_ptr<runtime::Backend::AsyncQueue>
+    runtime::Backend::get_async_queue(shared_ptr<Function> func)
+{
+    lock_guard<mutex> lock(m_async_queues_mutex);
+    // A function that is gone has no calls in flight, since each call holds its function
+    for (auto it = m_async_queues.begin(); it != m_async_queues.end();)
+    {
+        if (it->first.expired())
+        {
+            it = m_async_queues.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    shared_ptr<AsyncQueue>& queue = m_async_queues[func];
+    if (queue == nullptr)
+    {
+        queue = make_shared<AsyncQueue>(get_default_max_in_flight_calls());
+    }
+    return queue;
+}
+
+size_t runtime::Backend::get_default_max_in_flight_calls() const
+{
+    return supports_concurrent_calls() ? 2 : 1;
+}
+
+future<bool> runtime::Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    // The call holds func and the tensors until it has run
+    return get_async_queue(func)->submit(
+        [this, func, outputs, inputs]() { return call(func, outputs, inputs); });
+}
+
+void runtime::Backend::set_max_in_flight_calls(shared_ptr<Function> func, size_t count)
+{
+    if (count == 0)
+    {
+        throw runtime_error("A function needs at least one call in flight");
+    }
+    if (count > 1 && !supports_concurrent_calls())
+    {
+        throw runtime_error("This backend runs one call of a function at a time");
+    }
+    get_async_queue(func)->set_max_in_flight(count);
+}
+
+size_t runtime::Backend::get_max_in_flight_calls(shared_ptr<Function> func) const
+{
+    lock_guard<mutex> lock(m_async_queues_mutex);
+    auto it = m_async_queues.find(func);
+    return it == m_async_queues.end() ? get_default_max_in_flight_calls()
+                                      : it->second->get_max_in_flight();
+}
+
 void runtime::Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    shared_ptr<AsyncQueue> queue;
+    {
+        lock_guard<mutex> lock(m_async_queues_mutex);
+        auto it = m_async_queues.find(func);
+        if (it == m_async_queues.end())
+        {
+            return;
+        }
+        queue = it->second;
+        m_async_queues.erase(it);
+    }
+    queue->wait();
+}
+
+void runtime::Backend::wait_for_async_calls()
+{
+    vector<shared_ptr<AsyncQueue>> queues;
+    {
+        lock_guard<mutex> lock(m_async_queues_mutex);
+        for (auto& entry : m_async_queues)
+        {
+            queues.push_back(entry.second);
+        }
+    }
+    for (auto& queue : queues)
+    {
+        queue->wait();
+    }
 }
 
 vector<ngraph::runtime::PerformanceCounter>
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -69,6 +72,31 @@ namespace ngraph
                               const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                               const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) = 0;
 
+            /// @brief Start a call of func and return without waiting for it to finish.
+            ///
+            /// The future returns what call returns, or throws what it throws. The outputs and
+            /// inputs must not be accessed until it is ready. Blocks while func has
+            /// get_max_in_flight_calls(func) calls started by call_async that haven't finished,
+            /// so that a producer can't run arbitrarily far ahead of the backend.
+            virtual std::future<bool>
+                call_async(std::shared_ptr<Function> func,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
+            /// @brief Whether call may run for the same function on several threads at once.
+            ///   Backends that guard their per-function state against concurrent calls
+            ///   override this to return true.
+            virtual bool supports_concurrent_calls() const { return false; }
+
+            /// @brief Set how many calls of func call_async may have in flight. Defaults to 2
+            ///   when the backend supports concurrent calls, so that the inputs of the next call
+            ///   can be staged while one runs, and to 1 otherwise. Only backends that support
+            ///   concurrent calls accept more than 1.
+            void set_max_in_flight_calls(std::shared_ptr<Function> func, size_t count);
+            size_t get_max_in_flight_calls(std::shared_ptr<Function> func) const;
+
+            /// @brief Waits for the calls of func started by call_async, then releases
+            ///   everything the backend keeps for it. Overrides must call this first.
             virtual void remove_compiled_function(std::shared_ptr<Function> func);
 
             virtual void enable_performance_data(std::shared_ptr<Function> func, bool enable) {}
@@ -78,13 +106,28 @@ namespace ngraph
             static bool register_backend(const std::string& name, std::shared_ptr<Backend>);
 
         protected:
+            /// @brief Waits for every call started by call_async. The queued calls run on this
+            ///   backend's call, so derived backends must call this first in their destructor.
+            void wait_for_async_calls();
+
             void validate_call(std::shared_ptr<const Function> func,
                                const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                                const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
         private:
+            class AsyncQueue;
+
             static void* open_shared_library(std::string type);
             static std::unordered_map<std::string, std::shared_ptr<Backend>>& get_backend_map();
+            std::shared_ptr<AsyncQueue> get_async_queue(std::shared_ptr<Function> func);
+            size_t get_default_max_in_flight_calls() const;
+
+            // Keyed weakly, so that a Function is not kept alive by its queue
+            std::map<std::weak_ptr<Function>,
+                     std::shared_ptr<AsyncQueue>,
+                     std::owner_less<std::weak_ptr<Function>>>
+                m_async_queues;
+            mutable std::mutex m_async_queues_mutex;
         };
     }
 }
@@ -0,0 +1,315 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The shape of a sample of a batched shape
+static Shape get_sample_shape(const Shape& shape)
+{
+    return Shape(shape.begin() + 1, shape.end());
+}
+
+static size_t get_sample_size(const runtime::TensorView& batched)
+{
+    const Shape& shape = batched.get_shape();
+    return shape_size(get_sample_shape(shape)) *
+           batched.get_tensor().get_element_type().size();
+}
+
+// Whether the rows of two sets of batched tensors have the same element types and shapes
+static bool have_same_samples(const vector<shared_ptr<runtime::TensorView>>& a,
+                              const vector<shared_ptr<runtime::TensorView>>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (a[i]->get_tensor().get_element_type() != b[i]->get_tensor().get_element_type() ||
+            get_sample_shape(a[i]->get_shape()) != get_sample_shape(b[i]->get_shape()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Checks that samples have the element types and shapes of the rows of the batched tensors
+static void validate_samples(const vector<shared_ptr<runtime::TensorView>>& samples,
+                             const vector<shared_ptr<runtime::TensorView>>& batched,
+                             const string& kind)
+{
+    if (samples.size() != batched.size())
+    {
+        stringstream ss;
+        ss << "Request " << kind << " count " << samples.size() << " does not match "
+           << batched.size();
+        throw runtime_error(ss.str());
+    }
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        const element::Type& type = batched[i]->get_tensor().get_element_type();
+        Shape shape = get_sample_shape(batched[i]->get_shape());
+        if (samples[i]->get_tensor().get_element_type() != type ||
+            samples[i]->get_shape() != shape)
+        {
+            stringstream ss;
+            ss << "Request " << kind << " " << i << " must be " << type << " of shape {"
+               << join(shape) << "}";
+            throw runtime_error(ss.str());
+        }
+    }
+}
+
+runtime::BatchingExecutor::BatchingExecutor(
+    const shared_ptr<Backend>& backend,
+    const function<shared_ptr<Function>(size_t)>& make_function,
+    const vector<size_t>& batch_sizes,
+    chrono::microseconds timeout)
+    : m_backend(backend)
+    , m_timeout(timeout)
+    , m_batch_count(0)
+    , m_stop(false)
+{
+    vector<size_t> sizes = batch_sizes;
+    sort(sizes.begin(), sizes.end());
+    sizes.erase(unique(sizes.begin(), sizes.end()), sizes.end());
+    if (sizes.empty() || sizes.front() == 0)
+    {
+        throw runtime_error("Batch sizes must be positive and at least one is needed");
+    }
+
+    size_t staging_size = 0;
+    try
+    {
+        for (size_t batch_size : sizes)
+        {
+            shared_ptr<Function> function = make_function(batch_size);
+            Batch batch;
+            batch.m_batch_size = batch_size;
+            batch.m_function = function;
+            for (const auto& parameter : function->get_parameters())
+            {
+                batch.m_inputs.push_back(
+                    backend->create_tensor(parameter->get_element_type(), parameter->get_shape()));
+            }
+            for (size_t i = 0; i < function->get_output_size(); i++)
+            {
+                batch.m_outputs.push_back(backend->create_tensor(
+                    function->get_output_element_type(i), function->get_output_shape(i)));
+            }
+
+            for (const auto& tensors : {batch.m_inputs, batch.m_outputs})
+            {
+                for (size_t i = 0; i < tensors.size(); i++)
+                {
+                    const Shape& shape = tensors[i]->get_shape();
+                    if (shape.empty() || shape[0] != batch_size)
+                    {
+                        stringstream ss;
+                        ss << "The function for batch size " << batch_size
+                           << " has a parameter or result of shape {" << join(shape)
+                           << "}, without the batch on axis 0";
+                        throw runtime_error(ss.str());
+                    }
+                    staging_size = max(staging_size, get_sample_size(*tensors[i]));
+                }
+            }
+            if (!m_batches.empty() && !(have_same_samples(batch.m_inputs, m_batches[0].m_inputs) &&
+                                        have_same_samples(batch.m_outputs, m_batches[0].m_outputs)))
+            {
+                stringstream ss;
+                ss << "The functions for batch sizes " << m_batches[0].m_batch_size << " and "
+                   << batch_size << " have different samples";
+                throw runtime_error(ss.str());
+            }
+
+            m_batches.push_back(move(batch));
+            backend->compile(m_batches.back().m_function);
+        }
+    }
+    catch (...)
+    {
+        // The backend outlives this executor, so it must not keep the functions compiled so far
+        for (const Batch& batch : m_batches)
+        {
+            m_backend->remove_compiled_function(batch.m_function);
+        }
+        throw;
+    }
+    m_staging.resize(staging_size);
+
+    m_dispatcher = thread(&BatchingExecutor::dispatch, this);
+}
+
+runtime::BatchingExecutor::~BatchingExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_request_available.notify_all();
+    m_dispatcher.join();
+    for (const Batch& batch : m_batches)
+    {
+        m_backend->remove_compiled_function(batch.m_function);
+    }
+}
+
+future<void> runtime::BatchingExecutor::submit(const vector<shared_ptr<TensorView>>& outputs,
+                                               const vector<shared_ptr<TensorView>>& inputs)
+{
+    validate_samples(outputs, m_batches[0].m_outputs, "output");
+    validate_samples(inputs, m_batches[0].m_inputs, "input");
+
+    Request request;
+    request.m_outputs = outputs;
+    request.m_inputs = inputs;
+    request.m_arrival = chrono::steady_clock::now();
+    future<void> done = request.m_done.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queue.push_back(move(request));
+    }
+    m_request_available.notify_one();
+    return done;
+}
+
+size_t runtime::BatchingExecutor::get_batch_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_batch_count;
+}
+
+void runtime::BatchingExecutor::dispatch()
+{
+    size_t max_batch_size = get_max_batch_size();
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_request_available.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        // Wait for a full batch until the oldest request's budget runs out
+        m_request_available.wait_until(
+            lock, m_queue.front().m_arrival + m_timeout, [this, max_batch_size]() {
+                return m_stop || m_queue.size() >= max_batch_size;
+            });
+        size_t count = min(m_queue.size(), max_batch_size);
+        vector<Request> requests;
+        for (size_t i = 0; i < count; i++)
+        {
+            requests.push_back(move(m_queue.front()));
+            m_queue.pop_front();
+        }
+        m_batch_count++;
+        lock.unlock();
+        run_batch(requests);
+        lock.lock();
+    }
+}
+
+void runtime::BatchingExecutor::run_batch(vector<Request>& requests)
+{
+    Batch& batch = *find_if(m_batches.begin(), m_batches.end(), [&requests](const Batch& b) {
+        return b.m_batch_size >= requests.size();
+    });
+    try
+    {
+        for (size_t i = 0; i < batch.m_inputs.size(); i++)
+        {
+            for (size_t row = 0; row < requests.size(); row++)
+            {
+                copy_row(*requests[row].m_inputs[i], *batch.m_inputs[i], row, true);
+            }
+        }
+        m_backend->call(batch.m_function, batch.m_outputs, batch.m_inputs);
+        for (size_t i = 0; i < batch.m_outputs.size(); i++)
+        {
+            for (size_t row = 0; row < requests.size(); row++)
+            {
+                copy_row(*requests[row].m_outputs[i], *batch.m_outputs[i], row, false);
+            }
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : requests)
+        {
+            request.m_done.set_exception(current_exception());
+        }
+        return;
+    }
+    for (Request& request : requests)
+    {
+        request.m_done.set_value();
+    }
+}
+
+void runtime::BatchingExecutor::copy_row(TensorView& sample,
+                                         TensorView& batched,
+                                         size_t row,
+                                         bool to_batch)
+{
+    size_t size = get_sample_size(batched);
+    size_t offset = row * size;
+    char* sample_data = static_cast<char*>(sample.get_host_data_ptr());
+    char* batched_data = static_cast<char*>(batched.get_host_data_ptr());
+    if (to_batch)
+    {
+        if (batched_data != nullptr)
+        {
+            sample.read(batched_data + offset, 0, size);
+        }
+        else if (sample_data != nullptr)
+        {
+            batched.write(sample_data, offset, size);
+        }
+        else
+        {
+            sample.read(m_staging.data(), 0, size);
+            batched.write(m_staging.data(), offset, size);
+        }
+    }
+    else
+    {
+        if (batched_data != nullptr)
+        {
+            sample.write(batched_data + offset, 0, size);
+        }
+        else if (sample_data != nullptr)
+        {
+            batched.read(sample_data, offset, size);
+        }
+        else
+        {
+            batched.read(m_staging.data(), offset, size);
+            sample.write(m_staging.data(), 0, size);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class BatchingExecutor;
+    }
+}
+
+/// @brief Serves single-sample requests by running them in batches on a backend.
+///
+/// Requests that arrive while the oldest waiting request is within its latency budget are
+/// gathered along axis 0 of every parameter into one call of a function compiled for a batch
+/// size, and the results are scattered back along axis 0 of every result. A batch runs with
+/// the smallest batch size that holds it, so the functions must compute the rows of a batch
+/// independently: the rows past the requests hold stale data.
+class ngraph::runtime::BatchingExecutor
+{
+public:
+    /// @param backend The backend that compiles and calls the functions.
+    /// @param make_function Returns the function for a batch size. Its parameters and results
+    /// have the batch on axis 0.
+    /// @param batch_sizes The batch sizes to compile a function for.
+    /// @param timeout How long a request may wait for others to share its batch.
+    BatchingExecutor(const std::shared_ptr<Backend>& backend,
+                     const std::function<std::shared_ptr<Function>(size_t)>& make_function,
+                     const std::vector<size_t>& batch_sizes,
+                     std::chrono::microseconds timeout);
+    /// @brief Runs the requests still queued and releases the compiled functions.
+    ~BatchingExecutor();
+
+    BatchingExecutor(const BatchingExecutor&) = delete;
+    BatchingExecutor& operator=(const BatchingExecutor&) = delete;
+
+    /// @brief Queues a request and returns without waiting for it to run.
+    ///
+    /// The outputs and inputs hold one sample each, shaped as the results and parameters
+    /// without axis 0, and must not be accessed until the future is ready. The future throws
+    /// what the batch's call threw.
+    std::future<void> submit(const std::vector<std::shared_ptr<TensorView>>& outputs,
+                             const std::vector<std::shared_ptr<TensorView>>& inputs);
+
+    size_t get_max_batch_size() const { return m_batches.back().m_batch_size; }
+    /// @brief The number of batched calls made so far.
+    size_t get_batch_count() const;
+
+private:
+    /// A compiled function with the tensors its batches are gathered into
+    struct Batch
+    {
+        size_t m_batch_size;
+        std::shared_ptr<Function> m_function;
+        std::vector<std::shared_ptr<TensorView>> m_outputs;
+        std::vector<std::shared_ptr<TensorView>> m_inputs;
+    };
+
+    struct Request
+    {
+        std::vector<std::shared_ptr<TensorView>> m_outputs;
+        std::vector<std::shared_ptr<TensorView>> m_inputs;
+        std::promise<void> m_done;
+        std::chrono::steady_clock::time_point m_arrival;
+    };
+
+    void dispatch();
+    void run_batch(std::vector<Request>& requests);
+    // Copies a sample to or from row `row` of a batched tensor
+    void copy_row(TensorView& sample, TensorView& batched, size_t row, bool to_batch);
+
+    std::shared_ptr<Backend> m_backend;
+    std::chrono::microseconds m_timeout;
+    // In increasing batch size
+    std::vector<Batch> m_batches;
+    std::vector<char> m_staging;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_request_available;
+    std::deque<Request> m_queue;
+    size_t m_batch_count;
+    bool m_stop;
+    std::thread m_dispatcher;
+};
@@ -0,0 +1,315 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <array>
+#include <cstring>
+
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/batchnorm.hpp"
+#include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            void Builder::buildBatchNorm(CPU_ExternalFunction* external_function,
+                                         const ngraph::Node* node,
+                                         const std::vector<TensorViewWrapper>& args,
+                                         const std::vector<TensorViewWrapper>& out,
+                                         bool append_relu)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& arg2_tensor = tensor_data[args[2].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                const ngraph::op::BatchNorm* batchnorm =
+                    static_cast<const ngraph::op::BatchNorm*>(node);
+
+                // gamma and beta are packed into one weights tensor for MKLDNN
+                auto weight_sizes = std::array<size_t, 2>{
+                    {args[0].get_size() * args[0].get_element_type().size(),
+                     args[1].get_size() * args[1].get_element_type().size()}};
+
+                const float ops_scale = 1.f;
+                const float ops_alpha = -0.f; // relu negative slope
+                const float ops_beta = 0.f;
+
+                mkldnn::post_ops ops;
+                if (append_relu)
+                {
+                    ops.append_eltwise(
+                        ops_scale, mkldnn::algorithm::eltwise_relu, ops_alpha, ops_beta);
+                }
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto weights_shape = Shape{2, args[0].get_size()};
+                auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[2], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2));
+                auto weights_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
+                auto results_desc = mkldnn_emitter->build_memory_descriptor(
+                    out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                if (batchnorm->get_training_flag() && args.size() == 3)
+                {
+                    auto& out1_tensor = tensor_data[out[1].get_name()];
+                    auto& out2_tensor = tensor_data[out[2].get_name()];
+
+                    auto mean_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[1], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 1));
+                    auto variance_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[2], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 2));
+
+                    auto batchnorm_index =
+                        mkldnn_emitter->build_batchnorm_forward(input_desc,
+                                                                weights_desc,
+                                                                results_desc,
+                                                                mean_desc,
+                                                                variance_desc,
+                                                                batchnorm->get_eps_value(),
+                                                                false,
+                                                                batchnorm->get_training_flag(),
+                                                                ops);
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+                    auto functor = [&, batchnorm_index, deps, weight_sizes](
+                        CPURuntimeContext* ctx) {
+                        std::vector<char> bn_weights(weight_sizes[0] + weight_sizes[1]);
+                        memcpy(&bn_weights[0], arg0_tensor, weight_sizes[0]);
+                        memcpy(&bn_weights[0] + weight_sizes[0], arg1_tensor, weight_sizes[1]);
+
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg2_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], bn_weights.data());
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out0_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], out1_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[4], out2_tensor);
+                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    auto& arg3_tensor = tensor_data[args[3].get_name()];
+                    auto& arg4_tensor = tensor_data[args[4].get_name()];
+
+                    auto mean_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[3], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 3));
+                    auto variance_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[4], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 4));
+
+                    auto batchnorm_index =
+                        mkldnn_emitter->build_batchnorm_forward(input_desc,
+                                                                weights_desc,
+                                                                results_desc,
+                                                                mean_desc,
+                                                                variance_desc,
+                                                                batchnorm->get_eps_value(),
+                                                                true,
+                                                                batchnorm->get_training_flag(),
+                                                                ops);
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+                    auto functor = [&, batchnorm_index, deps, weight_sizes](
+                        CPURuntimeContext* ctx) {
+                        std::vector<char> bn_weights(weight_sizes[0] + weight_sizes[1]);
+                        memcpy(&bn_weights[0], arg0_tensor, weight_sizes[0]);
+                        memcpy(&bn_weights[0] + weight_sizes[0], arg1_tensor, weight_sizes[1]);
+
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg2_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg3_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg4_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], bn_weights.data());
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[4], out0_tensor);
+                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
+                    };
+                    functors.emplace_back(functor);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNorm)
+            {
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    buildBatchNorm(external_function, node, args, out, false);
+                    return;
+                }
+
+                const ngraph::op::BatchNorm* batchnorm =
+                    static_cast<const ngraph::op::BatchNorm*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& arg2_tensor = tensor_data[args[2].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                auto eps = batchnorm->get_eps_value();
+                auto arg2_shape = args[2].get_shape();
+
+                if (batchnorm->get_training_flag() && args.size() == 3)
+                {
+                    std::function<decltype(runtime::cpu::kernel::batch_norm_three_outputs<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::batch_norm_three_outputs);
+
+                    auto& out1_tensor = tensor_data[out[1].get_name()];
+                    auto& out2_tensor = tensor_data[out[2].get_name()];
+
+                    auto functor = [&, kernel, eps, arg2_shape](CPURuntimeContext* ctx) {
+                        kernel(eps,
+                               arg0_tensor,
+                               arg1_tensor,
+                               arg2_tensor,
+                               out0_tensor,
+                               out1_tensor,
+                               out2_tensor,
+                               arg2_shape);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    std::function<decltype(runtime::cpu::kernel::batch_norm_one_output<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::batch_norm_one_output);
+
+                    auto& arg3_tensor = tensor_data[args[3].get_name()];
+                    auto& arg4_tensor = tensor_data[args[4].get_name()];
+
+                    auto functor = [&, kernel, eps, arg2_shape](CPURuntimeContext* ctx) {
+                        kernel(eps,
+                               arg0_tensor,
+                               arg1_tensor,
+                               arg2_tensor,
+                               arg3_tensor,
+                               arg4_tensor,
+                               out0_tensor,
+                               arg2_shape);
+                    };
+                    functors.emplace_back(functor);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNormRelu)
+            {
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("BatchNormRelu is only supported with 4-D MKLDNN kernel.");
+                }
+                buildBatchNorm(external_function, node, args, out, true);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNormBackprop)
+            {
+                const ngraph::op::BatchNormBackprop* batchnorm =
+                    static_cast<const ngraph::op::BatchNormBackprop*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& arg2_tensor = tensor_data[args[2].get_name()];
+                auto& arg3_tensor = tensor_data[args[3].get_name()];
+                auto& arg4_tensor = tensor_data[args[4].get_name()];
+                auto& arg5_tensor = tensor_data[args[5].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+                auto& out1_tensor = tensor_data[out[1].get_name()];
+                auto& out2_tensor = tensor_data[out[2].get_name()];
+
+                auto weight_sizes = std::array<size_t, 2>{
+                    {args[0].get_size() * args[0].get_element_type().size(),
+                     args[1].get_size() * args[1].get_element_type().size()}};
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto weights_shape = Shape{2, args[0].get_size()};
+                auto weights_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
+                auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[2], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2));
+                auto mean_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[3], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 3));
+                auto variance_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[4], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 4));
+                auto delta_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[5], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 5));
+                auto dinput_desc = mkldnn_emitter->build_memory_descriptor(
+                    out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+                auto dweights_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
+
+                auto batchnorm_index =
+                    mkldnn_emitter->build_batchnorm_backward(weights_desc,
+                                                             input_desc,
+                                                             mean_desc,
+                                                             variance_desc,
+                                                             delta_desc,
+                                                             dinput_desc,
+                                                             dweights_desc,
+                                                             batchnorm->get_eps_value());
+
+                auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+                auto functor = [&, batchnorm_index, deps, weight_sizes](CPURuntimeContext* ctx) {
+                    std::vector<char> bn_weights(weight_sizes[0] + weight_sizes[1]);
+                    std::vector<char> bn_dweights(weight_sizes[0] + weight_sizes[1]);
+                    memcpy(&bn_weights[0], arg0_tensor, weight_sizes[0]);
+                    memcpy(&bn_weights[0] + weight_sizes[0], arg1_tensor, weight_sizes[1]);
+
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], bn_weights.data());
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg2_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg3_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], arg4_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[4], arg5_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[5], out0_tensor);
+                    cpu::mkldnn_utils::set_memory_ptr(ctx, deps[6], bn_dweights.data());
+                    cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
+
+                    memcpy(out1_tensor, &bn_dweights[0], weight_sizes[0]);
+                    memcpy(out2_tensor, &bn_dweights[0] + weight_sizes[0], weight_sizes[1]);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(BatchNorm);
+            REGISTER_OP_BUILDER(BatchNormRelu);
+            REGISTER_OP_BUILDER(BatchNormBackprop);
+        }
+    }
+}
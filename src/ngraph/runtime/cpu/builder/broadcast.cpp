@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/broadcast.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Broadcast)
+            {
+                auto broadcast = static_cast<const ngraph::op::Broadcast*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg_tensor = tensor_data[args[0].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+
+                auto arg_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto broadcast_axes = broadcast->get_broadcast_axes();
+
+                // Nothing to broadcast
+                if (broadcast_axes.empty())
+                {
+                    size_t size = out[0].get_size() * out[0].get_element_type().size();
+                    auto functor = [&, size](CPURuntimeContext* ctx) {
+                        memcpy(out_tensor, arg_tensor, size);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                std::function<decltype(runtime::cpu::kernel::broadcast<float, 1>)> kernel;
+
+                if (out_shape.size() <= MAX_EIGEN_KERNEL_RANK)
+                {
+                    SELECT_KERNEL_BY_RANK(kernel,
+                                          out[0].get_element_type(),
+                                          out_shape.size(),
+                                          runtime::cpu::kernel::broadcast);
+                }
+                else
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::ref_broadcast);
+                }
+
+                auto functor =
+                    [&, kernel, arg_shape, out_shape, broadcast_axes](CPURuntimeContext* ctx) {
+                        kernel(arg_tensor, out_tensor, arg_shape, out_shape, broadcast_axes);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Broadcast);
+        }
+    }
+}
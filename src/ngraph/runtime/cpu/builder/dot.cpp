@@ -0,0 +1,174 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/dot.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dot)
+            {
+                auto dot = static_cast<const ngraph::op::Dot*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+                auto result_shape = out[0].get_shape();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+
+                auto reduction_axes_count = dot->get_reduction_axes_count();
+
+                if (arg0_shape.empty() || arg1_shape.empty())
+                {
+                    // Scalar times tensor
+                    auto first = (arg0_shape.empty() ? args[0] : args[1]);
+                    auto second = (arg0_shape.empty() ? args[1] : args[0]);
+
+                    auto& first_tensor = tensor_data[first.get_name()];
+                    auto& second_tensor = tensor_data[second.get_name()];
+
+                    std::function<decltype(runtime::cpu::kernel::dot_scalar<float>)> kernel;
+
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_scalar);
+
+                    auto element_count = shape_size(second.get_shape());
+
+                    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
+                        kernel(first_tensor, second_tensor, out_tensor, element_count);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                if ((arg0_shape.size() == 2) && (arg1_shape.size() == 2) &&
+                    reduction_axes_count == 1 && args[0].get_element_type() == element::f32)
+                {
+                    // Hand plain matrix products to MKL
+                    int64_t m = arg0_shape[0];
+                    int64_t n = arg1_shape[1];
+                    int64_t k = arg0_shape[1];
+                    int64_t lda = max(1UL, arg0_shape[1]);
+                    int64_t ldb = max(1UL, arg1_shape[1]);
+                    int64_t ldc = max(1UL, arg1_shape[1]);
+
+                    auto functor = [&, m, n, k, lda, ldb, ldc](CPURuntimeContext* ctx) {
+                        cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                           cblas::Transpose::None,
+                                           cblas::Transpose::None,
+                                           m,
+                                           n,
+                                           k,
+                                           1.0f,
+                                           static_cast<float*>(arg0_tensor),
+                                           lda,
+                                           static_cast<float*>(arg1_tensor),
+                                           ldb,
+                                           0.0f,
+                                           static_cast<float*>(out_tensor),
+                                           ldc);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                std::function<decltype(runtime::cpu::kernel::dot_2d_2d_1rd<float>)> kernel;
+
+                if (reduction_axes_count == 1 && arg0_shape.size() == 1 && arg1_shape.size() == 1)
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_1d_1d_1rd);
+                }
+                else if (reduction_axes_count == 1 && arg0_shape.size() == 2 &&
+                         arg1_shape.size() == 1)
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_2d_1d_1rd);
+                }
+                else if (reduction_axes_count == 1 && arg0_shape.size() == 1 &&
+                         arg1_shape.size() == 2)
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_1d_2d_1rd);
+                }
+                else if (reduction_axes_count == 1 && arg0_shape.size() == 2 &&
+                         arg1_shape.size() == 2)
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_2d_2d_1rd);
+                }
+                else if (reduction_axes_count == 1 && arg0_shape.size() == 3 &&
+                         arg1_shape.size() == 2)
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::dot_3d_2d_1rd);
+                }
+                else
+                {
+                    std::function<decltype(runtime::cpu::kernel::ref_dot<float>)> ref_kernel;
+
+                    SELECT_KERNEL(
+                        ref_kernel, out[0].get_element_type(), runtime::cpu::kernel::ref_dot);
+
+                    auto functor = [&,
+                                    ref_kernel,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    reduction_axes_count](CPURuntimeContext* ctx) {
+                        ref_kernel(arg0_tensor,
+                                   arg1_tensor,
+                                   out_tensor,
+                                   arg0_shape,
+                                   arg1_shape,
+                                   result_shape,
+                                   reduction_axes_count);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto functor =
+                    [&, kernel, arg0_shape, arg1_shape, result_shape](CPURuntimeContext* ctx) {
+                        kernel(arg0_tensor,
+                               arg1_tensor,
+                               out_tensor,
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Dot);
+        }
+    }
+}
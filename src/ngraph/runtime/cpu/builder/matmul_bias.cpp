@@ -0,0 +1,270 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/op/batch_dot.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MatmulBias)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                const ngraph::op::MatmulBias* mm = static_cast<const ngraph::op::MatmulBias*>(node);
+
+                const auto& arg0_shape = mm->get_arg0_shape();
+                const auto& arg1_shape = mm->get_arg1_shape();
+                const auto& arg2_shape = node->get_shape();
+
+                auto m = arg0_shape[0];
+                auto n = arg1_shape[1];
+                auto k = arg0_shape[1];
+
+                bool transpose_A = false, transpose_B = false;
+                auto lda = arg0_shape[1];
+                auto ldb = arg1_shape[1];
+
+                if (mm->get_is_arg0_transposed())
+                {
+                    transpose_A = true;
+                    m = arg0_shape[1];
+                    k = arg0_shape[0];
+                }
+
+                if (mm->get_is_arg1_transposed())
+                {
+                    transpose_B = true;
+                    n = arg1_shape[0];
+                }
+
+                const float beta = 0.0f;
+
+                auto mm_functor =
+                    [&, transpose_A, transpose_B, m, n, k, lda, ldb, beta, arg2_shape](
+                        CPURuntimeContext* ctx) {
+                        cblas::cblas_sgemm(
+                            cblas::Layout::RowMajor,
+                            transpose_A ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                            transpose_B ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                            m,
+                            n,
+                            k,
+                            1.0f,
+                            static_cast<float*>(arg0_tensor),
+                            max(1UL, lda),
+                            static_cast<float*>(arg1_tensor),
+                            max(1UL, ldb),
+                            beta,
+                            static_cast<float*>(out0_tensor),
+                            max(1UL, arg2_shape[1]));
+                    };
+
+                function<void(CPURuntimeContext*)> bias_functor = [](CPURuntimeContext* ctx) {};
+
+                if (args.size() > 2)
+                {
+                    auto& arg2_tensor = tensor_data[args[2].get_name()];
+
+                    auto axes = mm->get_broadcast_axes();
+                    if (axes.size() == 1)
+                    {
+                        if (*(axes.begin()) == 0)
+                        {
+                            vector<float> ones_row(arg2_shape[0], 1.0f);
+                            bias_functor = [&, ones_row, arg2_shape](CPURuntimeContext* ctx) {
+                                cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                                   cblas::Transpose::None,
+                                                   cblas::Transpose::None,
+                                                   arg2_shape[0],
+                                                   arg2_shape[1],
+                                                   1,
+                                                   1.0f,
+                                                   ones_row.data(),
+                                                   1UL,
+                                                   static_cast<float*>(arg2_tensor),
+                                                   max(1UL, arg2_shape[1]),
+                                                   1.0f,
+                                                   static_cast<float*>(out0_tensor),
+                                                   max(1UL, arg2_shape[1]));
+                            };
+                        }
+                        else
+                        {
+                            vector<float> ones_col(arg2_shape[1], 1.0f);
+                            bias_functor = [&, ones_col, arg2_shape](CPURuntimeContext* ctx) {
+                                cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                                   cblas::Transpose::None,
+                                                   cblas::Transpose::None,
+                                                   arg2_shape[0],
+                                                   arg2_shape[1],
+                                                   1,
+                                                   1.0f,
+                                                   static_cast<float*>(arg2_tensor),
+                                                   1UL,
+                                                   ones_col.data(),
+                                                   max(1UL, arg2_shape[1]),
+                                                   1.0f,
+                                                   static_cast<float*>(out0_tensor),
+                                                   max(1UL, arg2_shape[1]));
+                            };
+                        }
+                    }
+                    else
+                    {
+                        if (axes.size() != 2)
+                        {
+                            throw ngraph_error("unexpected broadcast rank");
+                        }
+
+                        vector<float> ones_scalar(arg2_shape[0], 1.0f);
+
+                        bias_functor = [&, ones_scalar, arg2_shape](CPURuntimeContext* ctx) {
+                            vector<float> bias(arg2_shape[1], *static_cast<float*>(arg2_tensor));
+                            cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                               cblas::Transpose::None,
+                                               cblas::Transpose::None,
+                                               arg2_shape[0],
+                                               arg2_shape[1],
+                                               1,
+                                               1.0f,
+                                               ones_scalar.data(),
+                                               1UL,
+                                               bias.data(),
+                                               max(1UL, arg2_shape[1]),
+                                               1.0f,
+                                               static_cast<float*>(out0_tensor),
+                                               max(1UL, arg2_shape[1]));
+                        };
+                    }
+                }
+
+                auto functor = [&, mm_functor, bias_functor](CPURuntimeContext* ctx) {
+                    mm_functor(ctx);
+                    bias_functor(ctx);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchDot)
+            {
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& mat_a = tensor_data[args[0].get_name()];
+                auto& mat_b = tensor_data[args[1].get_name()];
+                auto& mat_c = tensor_data[out[0].get_name()];
+
+                const auto* batch_dot = static_cast<const ngraph::op::BatchDot*>(node);
+
+                const auto& shape_a = args[0].get_shape();
+                const auto& shape_b = args[1].get_shape();
+
+                int64_t m = shape_a[1];
+                int64_t k = shape_a[2];
+                int64_t n = shape_b[2];
+                int64_t lda = std::max(1L, k);
+                int64_t ldb = std::max(1L, n);
+                cblas::Transpose transpose_a = cblas::Transpose::None;
+                cblas::Transpose transpose_b = cblas::Transpose::None;
+                if (batch_dot->get_is_a_transposed())
+                {
+                    transpose_a = cblas::Transpose::Transpose;
+                    m = shape_a[2];
+                    k = shape_a[1];
+                    lda = std::max(1L, m);
+                }
+                if (batch_dot->get_is_b_transposed())
+                {
+                    transpose_b = cblas::Transpose::Transpose;
+                    n = shape_b[1];
+                    ldb = std::max(1L, k);
+                }
+                int64_t ldc = std::max(1L, n);
+                const size_t offset_a = m * k;
+                const size_t offset_b = k * n;
+                const size_t offset_c = m * n;
+
+                const int64_t group_count = 1;
+                const int64_t group_size = shape_a[0];
+
+                auto functor = [&,
+                                transpose_a,
+                                transpose_b,
+                                m,
+                                n,
+                                k,
+                                lda,
+                                ldb,
+                                ldc,
+                                offset_a,
+                                offset_b,
+                                offset_c,
+                                group_count,
+                                group_size](CPURuntimeContext* ctx) {
+                    const float alpha = 1.0f;
+                    const float beta = 0.0f;
+
+                    std::vector<const float*> a(group_size);
+                    std::vector<const float*> b(group_size);
+                    std::vector<float*> c(group_size);
+                    for (int64_t i = 0; i < group_size; ++i)
+                    {
+                        a[i] = static_cast<const float*>(mat_a) + i * offset_a;
+                        b[i] = static_cast<const float*>(mat_b) + i * offset_b;
+                        c[i] = static_cast<float*>(mat_c) + i * offset_c;
+                    }
+
+                    cblas::cblas_sgemm_batch(cblas::Layout::RowMajor,
+                                             &transpose_a,
+                                             &transpose_b,
+                                             &m,
+                                             &n,
+                                             &k,
+                                             &alpha,
+                                             a.data(),
+                                             &lda,
+                                             b.data(),
+                                             &ldb,
+                                             &beta,
+                                             c.data(),
+                                             &ldc,
+                                             group_count,
+                                             &group_size);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(MatmulBias);
+            REGISTER_OP_BUILDER(BatchDot);
+        }
+    }
+}
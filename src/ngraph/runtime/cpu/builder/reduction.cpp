@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/product.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_max.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_min.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_product.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Reductions share their dispatch logic: a plain copy when no axes are reduced, Eigen
+// full and single-axis reductions up to MAX_EIGEN_KERNEL_RANK, and the reference kernel
+// for everything else.
+#define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
+    auto reduce = static_cast<const ngraph::op::OP*>(node);                                        \
+                                                                                                   \
+    auto& functors = external_function->get_functors();                                            \
+    auto& tensor_data = external_function->get_tensor_data();                                      \
+                                                                                                   \
+    auto& arg_tensor = tensor_data[args[0].get_name()];                                            \
+    auto& out_tensor = tensor_data[out[0].get_name()];                                             \
+                                                                                                   \
+    auto arg_shape = args[0].get_shape();                                                          \
+    auto arg_rank = arg_shape.size();                                                              \
+    auto result_shape = out[0].get_shape();                                                        \
+    auto& result_element_type = out[0].get_element_type();                                         \
+                                                                                                   \
+    auto reduction_axes = reduce->get_reduction_axes();                                            \
+                                                                                                   \
+    if (reduction_axes.empty())                                                                    \
+    {                                                                                              \
+        size_t size = out[0].get_size() * out[0].get_element_type().size();                        \
+        auto functor = [&, size](CPURuntimeContext* ctx) {                                         \
+            memcpy(out_tensor, arg_tensor, size);                                                  \
+        };                                                                                         \
+        functors.emplace_back(functor);                                                            \
+        return;                                                                                    \
+    }                                                                                              \
+                                                                                                   \
+    if (reduction_axes.size() == arg_rank && arg_rank <= MAX_EIGEN_KERNEL_RANK)                    \
+    {                                                                                              \
+        std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 1>)> kernel;          \
+                                                                                                   \
+        SELECT_KERNEL_BY_RANK(                                                                     \
+            kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_all);        \
+                                                                                                   \
+        auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx) {              \
+            kernel(arg_tensor, out_tensor, arg_shape, result_shape);                               \
+        };                                                                                         \
+        functors.emplace_back(functor);                                                            \
+        return;                                                                                    \
+    }                                                                                              \
+                                                                                                   \
+    std::function<decltype(runtime::cpu::kernel::ref_##K<float>)> kernel;                          \
+                                                                                                   \
+    if (reduction_axes.size() == 1 && arg_rank <= MAX_EIGEN_KERNEL_RANK)                           \
+    {                                                                                              \
+        SELECT_KERNEL_BY_RANK(                                                                     \
+            kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::ref_##K);                 \
+    }                                                                                              \
+                                                                                                   \
+    auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](CPURuntimeContext* ctx) {  \
+        kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);                   \
+    };                                                                                             \
+    functors.emplace_back(functor)
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sum)
+            {
+                BUILD_REDUCTION_FUNCTOR(Sum, sum);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Max)
+            {
+                BUILD_REDUCTION_FUNCTOR(Max, max);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Min)
+            {
+                BUILD_REDUCTION_FUNCTOR(Min, min);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Product)
+            {
+                BUILD_REDUCTION_FUNCTOR(Product, product);
+            }
+
+            REGISTER_OP_BUILDER(Sum);
+            REGISTER_OP_BUILDER(Max);
+            REGISTER_OP_BUILDER(Min);
+            REGISTER_OP_BUILDER(Product);
+        }
+    }
+}
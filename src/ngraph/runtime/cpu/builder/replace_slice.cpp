@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/replace_slice.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/replace_slice.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ReplaceSlice)
+            {
+                auto replace_slice = static_cast<const ngraph::op::ReplaceSlice*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+
+                auto arg1_shape = args[1].get_shape();
+                auto out_shape = out[0].get_shape();
+
+                auto lower_bounds = replace_slice->get_lower_bounds();
+                auto upper_bounds = replace_slice->get_upper_bounds();
+                auto strides = replace_slice->get_strides();
+
+                std::function<decltype(runtime::cpu::kernel::replace_slice<float, 1>)> kernel;
+
+                if (!out_shape.empty() && out_shape.size() <= MAX_EIGEN_KERNEL_RANK)
+                {
+                    SELECT_KERNEL_BY_RANK(kernel,
+                                          out[0].get_element_type(),
+                                          out_shape.size(),
+                                          runtime::cpu::kernel::replace_slice);
+                }
+                else
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::ref_replace_slice);
+                }
+
+                auto functor = [&,
+                                kernel,
+                                arg1_shape,
+                                lower_bounds,
+                                upper_bounds,
+                                strides,
+                                out_shape](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor,
+                           arg1_tensor,
+                           out_tensor,
+                           arg1_shape,
+                           lower_bounds,
+                           upper_bounds,
+                           strides,
+                           out_shape);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(ReplaceSlice);
+        }
+    }
+}
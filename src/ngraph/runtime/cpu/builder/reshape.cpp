@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reshape.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Reshape)
+            {
+                auto reshape = static_cast<const ngraph::op::Reshape*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg_tensor = tensor_data[args[0].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+
+                auto arg_shape = args[0].get_shape();
+                auto arg_rank = arg_shape.size();
+                auto result_shape = out[0].get_shape();
+                auto input_order = reshape->get_input_order();
+
+                bool same_layout = is_sorted(input_order.begin(), input_order.end());
+
+                // If there is no layout change or we are just going from 1^n to 1^m or a
+                // zero-size tensor, we can just copy.
+                if (same_layout || shape_size(result_shape) < 2)
+                {
+                    size_t size = out[0].get_size() * out[0].get_element_type().size();
+                    auto functor = [&, size](CPURuntimeContext* ctx) {
+                        // An in-place reshape shares the argument's buffer
+                        if (out_tensor != arg_tensor)
+                        {
+                            memcpy(out_tensor, arg_tensor, size);
+                        }
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                std::function<decltype(runtime::cpu::kernel::reshape_same_rank<float, 1>)> kernel;
+
+                if (arg_rank == result_shape.size() && arg_rank <= MAX_EIGEN_KERNEL_RANK)
+                {
+                    SELECT_KERNEL_BY_RANK(kernel,
+                                          out[0].get_element_type(),
+                                          arg_rank,
+                                          runtime::cpu::kernel::reshape_same_rank);
+                }
+                else
+                {
+                    SELECT_KERNEL(
+                        kernel, out[0].get_element_type(), runtime::cpu::kernel::ref_reshape);
+                }
+
+                auto functor =
+                    [&, kernel, arg_shape, input_order, result_shape](CPURuntimeContext* ctx) {
+                        kernel(arg_tensor, out_tensor, arg_shape, input_order, result_shape);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Reshape);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Softmax)
+            {
+                auto softmax = static_cast<const ngraph::op::Softmax*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg_tensor = tensor_data[args[0].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+
+                auto arg_shape = args[0].get_shape();
+                auto axes = softmax->get_axes();
+                auto& element_type = out[0].get_element_type();
+
+                if (element_type != element::f32 && element_type != element::f64)
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() + " for Softmax");
+                }
+
+                if (axes.size() == 1 && arg_shape.size() <= MAX_EIGEN_KERNEL_RANK)
+                {
+                    std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)> kernel;
+
+                    if (element_type == element::f32)
+                    {
+                        SELECT_RANK(
+                            kernel, float, arg_shape.size(), runtime::cpu::kernel::softmax_1rd);
+                    }
+                    else
+                    {
+                        SELECT_RANK(
+                            kernel, double, arg_shape.size(), runtime::cpu::kernel::softmax_1rd);
+                    }
+
+                    auto axis = *axes.begin();
+                    auto functor = [&, kernel, arg_shape, axis](CPURuntimeContext* ctx) {
+                        kernel(arg_tensor, out_tensor, arg_shape, axis);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    std::function<decltype(runtime::cpu::kernel::ref_softmax<float>)> kernel;
+
+                    if (element_type == element::f32)
+                    {
+                        kernel = runtime::cpu::kernel::ref_softmax<float>;
+                    }
+                    else
+                    {
+                        kernel = runtime::cpu::kernel::ref_softmax<double>;
+                    }
+
+                    auto functor = [&, kernel, arg_shape, axes](CPURuntimeContext* ctx) {
+                        kernel(arg_tensor, out_tensor, arg_shape, axes);
+                    };
+                    functors.emplace_back(functor);
+                }
+            }
+
+            REGISTER_OP_BUILDER(Softmax);
+        }
+    }
+}
@@ -14,12 +14,20 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstdlib>
+
 #include <tbb/tbb_stddef.h>
 
+#include "ngraph/except.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
 
@@ -33,6 +41,11 @@ extern "C" void create_backend()
     runtime::Backend::register_backend("CPU", make_shared<runtime::cpu::CPU_Backend>());
 };
 
+runtime::cpu::CPU_Backend::~CPU_Backend()
+{
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
     const shared_ptr<runtime::cpu::CPU_ExternalFunction>& external_function)
 {
@@ -51,19 +64,122 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
     return make_shared<runtime::cpu::CPUTensorView>(element_type, shape, memory_pointer);
 }
 
-bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
+shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor_on_node(
+    const element::Type& element_type, const Shape& shape, size_t node_id)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    // Throws for a node that doesn't exist, which bind_memory would only ignore
+    numa::get_node(node_id);
+    auto tensor = make_shared<runtime::cpu::CPUTensorView>(element_type, shape);
+    if (!numa::bind_memory(
+            tensor->get_data_ptr(), shape_size(shape) * element_type.size(), node_id))
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-        instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        throw ngraph_error("Unable to place tensor memory on NUMA node " + to_string(node_id));
     }
+    return tensor;
+}
+
+bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
+{
+    compile_instance(func);
     return true;
 }
 
+const shared_ptr<runtime::cpu::CPU_Backend::FunctionInstance>&
+    runtime::cpu::CPU_Backend::get_instance(shared_ptr<Function> func)
+{
+    shared_ptr<FunctionInstance>& instance = m_function_map[func];
+    if (instance == nullptr)
+    {
+        instance = make_shared<FunctionInstance>();
+    }
+    return instance;
+}
+
+shared_ptr<runtime::cpu::CPU_CallFrame>
+    runtime::cpu::CPU_Backend::compile_instance(shared_ptr<Function> func)
+{
+    shared_ptr<FunctionInstance> instance;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance = get_instance(func);
+        if (instance->m_call_frame != nullptr)
+        {
+            return instance->m_call_frame;
+        }
+    }
+
+    // Compiling takes long, so it only holds this function's lock and calls of the functions
+    // already compiled go on meanwhile
+    lock_guard<mutex> compile_lock(instance->m_compile_mutex);
+    size_t max_concurrent_calls;
+    bool performance_counters_enabled;
+    shared_ptr<CPUExecutor> executor;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        if (instance->m_call_frame != nullptr)
+        {
+            return instance->m_call_frame;
+        }
+        max_concurrent_calls = instance->m_max_concurrent_calls;
+        performance_counters_enabled = instance->m_performance_counters_enabled;
+        executor = (instance->m_executor ? instance->m_executor : m_executor);
+        // Settings changed from here on would be ignored, so the setters refuse them until
+        // the compile has failed
+        instance->m_compiling = true;
+    }
+
+    shared_ptr<CPU_ExternalFunction> external_function;
+    shared_ptr<CPU_CallFrame> call_frame;
+    try
+    {
+        if (max_concurrent_calls == 0)
+        {
+            const char* env = std::getenv("NGRAPH_CPU_CONCURRENCY");
+            max_concurrent_calls = (env != nullptr ? std::max(std::atoi(env), 1) : 1);
+        }
+        external_function = make_shared<CPU_ExternalFunction>(func);
+        external_function->m_emit_timing = performance_counters_enabled;
+        call_frame = dynamic_pointer_cast<CPU_CallFrame>(
+            external_function->make_call_frame(max_concurrent_calls));
+        call_frame->set_executor(executor);
+        if (executor && executor->get_numa_node() >= 0)
+        {
+            // Compilation has folded the graph, so these are the constants the code reads
+            size_t unplaced = 0;
+            for (auto node : func->get_ordered_ops())
+            {
+                if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+                {
+                    if (!numa::bind_memory(const_cast<void*>(constant->get_data_ptr()),
+                                           shape_size(constant->get_shape()) *
+                                               constant->get_element_type().size(),
+                                           executor->get_numa_node()))
+                    {
+                        unplaced++;
+                    }
+                }
+            }
+            if (unplaced > 0)
+            {
+                NGRAPH_WARN << "Unable to place " << unplaced << " constants of "
+                            << func->get_name() << " on NUMA node "
+                            << executor->get_numa_node();
+            }
+        }
+    }
+    catch (...)
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance->m_compiling = false;
+        throw;
+    }
+
+    lock_guard<mutex> lock(m_function_map_mutex);
+    instance->m_external_function = external_function;
+    instance->m_call_frame = call_frame;
+    return call_frame;
+}
+
 bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
                                      const vector<shared_ptr<runtime::TensorView>>& outputs,
                                      const vector<shared_ptr<runtime::TensorView>>& inputs)
@@ -72,40 +188,74 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 
     validate_call(func, outputs, inputs);
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
-    {
-        rc = compile(func);
-    }
+    // Only the lookup is serialized, the call frame handles concurrent calls itself
+    shared_ptr<CPU_CallFrame> call_frame = compile_instance(func);
 
-    instance.m_call_frame->call(outputs, inputs);
+    call_frame->call(outputs, inputs);
 
     return rc;
 }
 
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    Backend::remove_compiled_function(func);
+    lock_guard<mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function != nullptr)
+    lock_guard<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = *get_instance(func);
+    if (instance.m_compiling || instance.m_external_function != nullptr)
     {
         throw runtime_error("Performance data collection must be enabled prior to compiling.");
     }
     instance.m_performance_counters_enabled = enable;
 }
 
+void runtime::cpu::CPU_Backend::set_max_concurrent_calls(shared_ptr<Function> func, size_t count)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = *get_instance(func);
+    if (instance.m_compiling || instance.m_external_function != nullptr)
+    {
+        throw runtime_error("Concurrency must be set prior to compiling.");
+    }
+    if (count == 0)
+    {
+        throw runtime_error("At least one concurrent call is required.");
+    }
+    instance.m_max_concurrent_calls = count;
+}
+
+void runtime::cpu::CPU_Backend::set_executor(shared_ptr<CPUExecutor> executor)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    m_executor = executor;
+}
+
+void runtime::cpu::CPU_Backend::set_executor(shared_ptr<Function> func,
+                                             shared_ptr<CPUExecutor> executor)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = *get_instance(func);
+    if (instance.m_compiling || instance.m_external_function != nullptr)
+    {
+        throw runtime_error("The executor must be set prior to compiling.");
+    }
+    instance.m_executor = executor;
+}
+
 vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<mutex> lock(m_function_map_mutex);
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
     {
-        const FunctionInstance& instance = it->second;
+        const FunctionInstance& instance = *it->second;
         if (instance.m_external_function != nullptr)
         {
             auto* engine = instance.m_external_function->m_execution_engine.get();
@@ -120,10 +270,15 @@ vector<runtime::PerformanceCounter>
 
                 if (get_count && get_name && get_microseconds && get_call_count)
                 {
+                    // The generated source names the nodes in the order they are emitted
+                    const auto& original_names = instance.m_external_function->m_original_names;
                     size_t count = get_count();
                     for (size_t i = 0; i < count; i++)
                     {
-                        rc.push_back({get_name(i), get_microseconds(i), get_call_count(i)});
+                        auto it = original_names.find(get_name(i));
+                        rc.push_back({it != original_names.end() ? it->second.c_str() : get_name(i),
+                                      get_microseconds(i),
+                                      get_call_count(i)});
                     }
                 }
             }
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/runtime/backend.hpp"
 
@@ -29,10 +30,13 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPUExecutor;
 
             class CPU_Backend : public runtime::Backend
             {
             public:
+                ~CPU_Backend() override;
+
                 std::shared_ptr<CPU_CallFrame>
                     make_call_frame(const std::shared_ptr<CPU_ExternalFunction>& external_function);
 
@@ -45,27 +49,70 @@ namespace ngraph
                     create_tensor(const ngraph::element::Type& element_type,
                                   const Shape& shape) override;
 
+                /// @brief Create a tensor whose memory is on NUMA node node_id, for the
+                ///   functions run by CPUExecutor::create_for_numa_node(node_id).
+                std::shared_ptr<ngraph::runtime::TensorView>
+                    create_tensor_on_node(const ngraph::element::Type& element_type,
+                                          const Shape& shape,
+                                          size_t node_id);
+
                 bool compile(std::shared_ptr<Function> func) override;
 
                 bool call(std::shared_ptr<Function> func,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) override;
+                // Each concurrent call checks out a runtime context of its own
+                bool supports_concurrent_calls() const override { return true; }
 
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
                     get_performance_data(std::shared_ptr<Function> func) const override;
 
+                /// @brief Set how many calls of a function may execute at the same time.
+                ///   Each concurrent call gets its own runtime context and temporary memory
+                ///   pool while sharing the compiled code and constants. Must be set before
+                ///   the function is compiled. Defaults to NGRAPH_CPU_CONCURRENCY or 1. Calls
+                ///   started by call_async beyond this count wait for a context.
+                void set_max_concurrent_calls(std::shared_ptr<Function> func, size_t count);
+
+                /// @brief Set the executor whose threads run the functions compiled from now
+                ///   on, unless they have their own. Defaults to CPUExecutor::get_default().
+                void set_executor(std::shared_ptr<CPUExecutor> executor);
+
+                /// @brief Set the executor whose threads run func. Must be set before the
+                ///   function is compiled. If the executor has a NUMA node, the function's
+                ///   constants and temporary memory are moved to it; functions that share
+                ///   constants should not be placed on different nodes.
+                void set_executor(std::shared_ptr<Function> func,
+                                  std::shared_ptr<CPUExecutor> executor);
+
             private:
                 class FunctionInstance
                 {
                 public:
+                    /// Serializes compiles of this function, which run without the map lock
+                    std::mutex m_compile_mutex;
+                    /// Set once a compile has read the settings below, which are fixed from then
+                    bool m_compiling = false;
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    size_t m_max_concurrent_calls = 0;
+                    std::shared_ptr<CPUExecutor> m_executor;
                 };
 
-                std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                /// The instance of func, created if there is none. The caller holds the map
+                /// lock.
+                const std::shared_ptr<FunctionInstance>&
+                    get_instance(std::shared_ptr<Function> func);
+                /// Compiles func if it isn't yet and returns its call frame
+                std::shared_ptr<CPU_CallFrame> compile_instance(std::shared_ptr<Function> func);
+
+                std::map<std::shared_ptr<Function>, std::shared_ptr<FunctionInstance>>
+                    m_function_map;
+                mutable std::mutex m_function_map_mutex;
+                std::shared_ptr<CPUExecutor> m_executor;
             };
         }
     }
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -27,84 +28,81 @@
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
-#include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/asin.hpp"
 #include "ngraph/op/atan.hpp"
-#include "ngraph/op/avg_pool.hpp"
-#include "ngraph/op/batch_norm.hpp"
-#include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/ceiling.hpp"
-#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
-#include "ngraph/op/convert.hpp"
-#include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
 #include "ngraph/op/divide.hpp"
-#include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/floor.hpp"
-#include "ngraph/op/function_call.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_eq.hpp"
 #include "ngraph/op/less.hpp"
 #include "ngraph/op/less_eq.hpp"
 #include "ngraph/op/log.hpp"
-#include "ngraph/op/max.hpp"
-#include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
-#include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/not.hpp"
 #include "ngraph/op/not_equal.hpp"
-#include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/op.hpp"
 #include "ngraph/op/or.hpp"
-#include "ngraph/op/pad.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
-#include "ngraph/op/product.hpp"
-#include "ngraph/op/reduce.hpp"
-#include "ngraph/op/reduce_window.hpp"
-#include "ngraph/op/relu.hpp"
-#include "ngraph/op/remainder.hpp"
-#include "ngraph/op/replace_slice.hpp"
-#include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
-#include "ngraph/op/reverse.hpp"
-#include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/select.hpp"
-#include "ngraph/op/select_and_scatter.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
 #include "ngraph/op/sinh.hpp"
-#include "ngraph/op/slice.hpp"
-#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
-#include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/kernel/abs.hpp"
+#include "ngraph/runtime/cpu/kernel/acos.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/asin.hpp"
+#include "ngraph/runtime/cpu/kernel/atan.hpp"
+#include "ngraph/runtime/cpu/kernel/ceil.hpp"
+#include "ngraph/runtime/cpu/kernel/cos.hpp"
+#include "ngraph/runtime/cpu/kernel/cosh.hpp"
+#include "ngraph/runtime/cpu/kernel/divide.hpp"
+#include "ngraph/runtime/cpu/kernel/equal.hpp"
+#include "ngraph/runtime/cpu/kernel/exp.hpp"
+#include "ngraph/runtime/cpu/kernel/floor.hpp"
+#include "ngraph/runtime/cpu/kernel/greater.hpp"
+#include "ngraph/runtime/cpu/kernel/greater_eq.hpp"
+#include "ngraph/runtime/cpu/kernel/less.hpp"
+#include "ngraph/runtime/cpu/kernel/less_eq.hpp"
+#include "ngraph/runtime/cpu/kernel/log.hpp"
+#include "ngraph/runtime/cpu/kernel/logical_and.hpp"
+#include "ngraph/runtime/cpu/kernel/logical_not.hpp"
+#include "ngraph/runtime/cpu/kernel/logical_or.hpp"
+#include "ngraph/runtime/cpu/kernel/maximum.hpp"
+#include "ngraph/runtime/cpu/kernel/minimum.hpp"
 #include "ngraph/runtime/cpu/kernel/multiply.hpp"
+#include "ngraph/runtime/cpu/kernel/negative.hpp"
+#include "ngraph/runtime/cpu/kernel/not_equal.hpp"
+#include "ngraph/runtime/cpu/kernel/power.hpp"
 #include "ngraph/runtime/cpu/kernel/result.hpp"
+#include "ngraph/runtime/cpu/kernel/select.hpp"
+#include "ngraph/runtime/cpu/kernel/sign.hpp"
+#include "ngraph/runtime/cpu/kernel/sin.hpp"
+#include "ngraph/runtime/cpu/kernel/sinh.hpp"
+#include "ngraph/runtime/cpu/kernel/sqrt.hpp"
+#include "ngraph/runtime/cpu/kernel/subtract.hpp"
+#include "ngraph/runtime/cpu/kernel/tan.hpp"
+#include "ngraph/runtime/cpu/kernel/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
-#include "ngraph/runtime/cpu/op/conv_bias.hpp"
-#include "ngraph/runtime/cpu/op/conv_relu.hpp"
-#include "ngraph/runtime/cpu/op/convert_layout.hpp"
-#include "ngraph/runtime/cpu/op/lstm.hpp"
-#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
-#include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
-#include "ngraph/runtime/cpu/op/rnn.hpp"
-#include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -116,53 +114,6 @@
 using namespace std;
 using namespace ngraph;
 
-// Per-type kernel macro
-#define SELECT_KERNEL(KV, ET, K)                                                                   \
-    if (ET == element::boolean)                                                                    \
-    {                                                                                              \
-        KV = K<char>;                                                                              \
-    }                                                                                              \
-    else if (ET == element::f32)                                                                   \
-    {                                                                                              \
-        KV = K<float>;                                                                             \
-    }                                                                                              \
-    else if (ET == element::f64)                                                                   \
-    {                                                                                              \
-        KV = K<double>;                                                                            \
-    }                                                                                              \
-    else if (ET == element::i8)                                                                    \
-    {                                                                                              \
-        KV = K<int8_t>;                                                                            \
-    }                                                                                              \
-    else if (ET == element::i16)                                                                   \
-    {                                                                                              \
-        KV = K<int16_t>;                                                                           \
-    }                                                                                              \
-    else if (ET == element::i32)                                                                   \
-    {                                                                                              \
-        KV = K<int32_t>;                                                                           \
-    }                                                                                              \
-    else if (ET == element::i64)                                                                   \
-    {                                                                                              \
-        KV = K<int64_t>;                                                                           \
-    }                                                                                              \
-    else if (ET == element::u8)                                                                    \
-    {                                                                                              \
-        KV = K<uint8_t>;                                                                           \
-    }                                                                                              \
-    else if (ET == element::u16)                                                                   \
-    {                                                                                              \
-        KV = K<uint16_t>;                                                                          \
-    }                                                                                              \
-    else if (ET == element::u32)                                                                   \
-    {                                                                                              \
-        KV = K<uint32_t>;                                                                          \
-    }                                                                                              \
-    else if (ET == element::u64)                                                                   \
-    {                                                                                              \
-        KV = K<uint64_t>;                                                                          \
-    }
-
 namespace ngraph
 {
     namespace runtime
@@ -174,14 +125,53 @@ namespace ngraph
             {
                 auto& functors = external_function->get_functors();
                 auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& out0_tensor = tensor_data[out[0].get_name()];
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    std::vector<float> scale_vector(2, 1);
+                    std::vector<mkldnn::memory::primitive_desc> inputs_pd;
+
+                    auto input0_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    auto input1_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                    auto result_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input0_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], input0_format);
+                    auto input1_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[1], input1_format);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], result_format);
+                    inputs_pd.push_back(mkldnn::memory::primitive_desc(
+                        input0_data_desc, runtime::cpu::mkldnn_utils::global_cpu_engine));
+                    inputs_pd.push_back(mkldnn::memory::primitive_desc(
+                        input1_data_desc, runtime::cpu::mkldnn_utils::global_cpu_engine));
+
+                    size_t add_index = mkldnn_emitter->build_elementwise_add(
+                        input0_data_desc, input1_data_desc, result_desc, scale_vector, inputs_pd);
+                    auto& deps = mkldnn_emitter->get_primitive_deps(add_index);
+
+                    auto functor = [&, add_index, deps](CPURuntimeContext* ctx) {
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
+                        cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out0_tensor);
+                        cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, add_index);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 std::function<void(void*, void*, void*, size_t)> kernel;
 
                 SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::add);
 
                 auto element_count = out[0].get_size();
-                auto& arg0_tensor = tensor_data[args[0].get_name()];
-                auto& arg1_tensor = tensor_data[args[1].get_name()];
-                auto& out0_tensor = tensor_data[out[0].get_name()];
 
                 auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
                     kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count);
@@ -189,41 +179,259 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
+#ifdef NGRAPH_DISTRIBUTED
             template <>
-            void Builder::BUILDER_DECL(ngraph::op::Multiply)
+            void Builder::BUILDER_DECL(ngraph::op::AllReduce)
             {
                 auto& functors = external_function->get_functors();
                 auto& tensor_data = external_function->get_tensor_data();
-                std::function<void(void*, void*, void*, size_t)> kernel;
 
-                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::multiply);
+                auto& arg_tensor = tensor_data[args[0].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+                auto count = static_cast<int>(out[0].get_size());
 
-                auto element_count = out[0].get_size();
-                auto& arg0_tensor = tensor_data[args[0].get_name()];
-                auto& arg1_tensor = tensor_data[args[1].get_name()];
-                auto& out0_tensor = tensor_data[out[0].get_name()];
+                auto& element_type = args[0].get_element_type();
+                auto data_type = MPI_FLOAT;
+                if (element_type == element::f64)
+                {
+                    data_type = MPI_DOUBLE;
+                }
 
-                auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
-                    kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count);
+                auto functor = [&, count, data_type](CPURuntimeContext* ctx) {
+                    MPI_Allreduce(
+                        arg_tensor, out_tensor, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+                };
+                functors.emplace_back(functor);
+            }
+#endif
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GetOutputElement)
+            {
+                auto goe = static_cast<const ngraph::op::GetOutputElement*>(node);
+
+                auto& functors = external_function->get_functors();
+                auto& tensor_data = external_function->get_tensor_data();
+
+                auto& arg_tensor = tensor_data[args[goe->get_n()].get_name()];
+                auto& out_tensor = tensor_data[out[0].get_name()];
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+
+                auto functor = [&, size](CPURuntimeContext* ctx) {
+                    memcpy(out_tensor, arg_tensor, size);
                 };
                 functors.emplace_back(functor);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Multiply)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::multiply);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Subtract)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Divide)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::divide);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Maximum)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Minimum)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Power)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::power);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Equal)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::equal);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::NotEqual)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::not_equal);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Greater)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::greater);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GreaterEq)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::greater_eq);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Less)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::less);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LessEq)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::less_eq);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::And)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::logical_and);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Or)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::logical_or);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Not)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::logical_not);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Abs)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::abs);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Negative)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sign)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sign);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Ceiling)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::ceil);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Floor)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::floor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sqrt)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sqrt);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Exp)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::exp);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Log)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::log);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sin)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sin);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Cos)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::cos);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Tan)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tan);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Asin)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::asin);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Acos)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::acos);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Atan)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::atan);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sinh)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sinh);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Cosh)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::cosh);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Tanh)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tanh);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Select)
             {
                 auto& functors = external_function->get_functors();
                 auto& tensor_data = external_function->get_tensor_data();
-                std::function<void(void*, void*, size_t)> kernel;
+                std::function<void(void*, void*, void*, void*, size_t)> kernel;
 
-                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::abs);
+                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::select);
 
                 auto element_count = out[0].get_size();
                 auto& arg0_tensor = tensor_data[args[0].get_name()];
+                auto& arg1_tensor = tensor_data[args[1].get_name()];
+                auto& arg2_tensor = tensor_data[args[2].get_name()];
                 auto& out0_tensor = tensor_data[out[0].get_name()];
 
                 auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {
-                    kernel(arg0_tensor, out0_tensor, element_count);
+                    kernel(arg0_tensor, arg1_tensor, arg2_tensor, out0_tensor, element_count);
                 };
                 functors.emplace_back(functor);
             }
@@ -274,13 +482,56 @@ namespace ngraph
 
 #define TI(x) type_index(typeid(x))
 
-            const BuildOpMap build_dispatcher{
-                {TI(ngraph::op::Add), &runtime::cpu::Builder::build<ngraph::op::Add>},
-                {TI(ngraph::op::Multiply), &runtime::cpu::Builder::build<ngraph::op::Multiply>},
-                {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
-                {TI(ngraph::op::Abs), &runtime::cpu::Builder::build<ngraph::op::Abs>},
-                {TI(ngraph::op::Result), &runtime::cpu::Builder::build<ngraph::op::Result>},
-                {TI(ngraph::op::Constant), &runtime::cpu::Builder::build<ngraph::op::Constant>}};
+            BuildOpMap& get_global_build_dispatcher()
+            {
+                static BuildOpMap build_dispatcher{
+                    {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
+                    {TI(ngraph::op::Add), &runtime::cpu::Builder::build<ngraph::op::Add>},
+#ifdef NGRAPH_DISTRIBUTED
+                    {TI(ngraph::op::AllReduce),
+                     &runtime::cpu::Builder::build<ngraph::op::AllReduce>},
+#endif
+                    {TI(ngraph::op::GetOutputElement),
+                     &runtime::cpu::Builder::build<ngraph::op::GetOutputElement>},
+                    {TI(ngraph::op::Multiply), &runtime::cpu::Builder::build<ngraph::op::Multiply>},
+                    {TI(ngraph::op::Subtract), &runtime::cpu::Builder::build<ngraph::op::Subtract>},
+                    {TI(ngraph::op::Divide), &runtime::cpu::Builder::build<ngraph::op::Divide>},
+                    {TI(ngraph::op::Maximum), &runtime::cpu::Builder::build<ngraph::op::Maximum>},
+                    {TI(ngraph::op::Minimum), &runtime::cpu::Builder::build<ngraph::op::Minimum>},
+                    {TI(ngraph::op::Power), &runtime::cpu::Builder::build<ngraph::op::Power>},
+                    {TI(ngraph::op::Equal), &runtime::cpu::Builder::build<ngraph::op::Equal>},
+                    {TI(ngraph::op::NotEqual), &runtime::cpu::Builder::build<ngraph::op::NotEqual>},
+                    {TI(ngraph::op::Greater), &runtime::cpu::Builder::build<ngraph::op::Greater>},
+                    {TI(ngraph::op::GreaterEq),
+                     &runtime::cpu::Builder::build<ngraph::op::GreaterEq>},
+                    {TI(ngraph::op::Less), &runtime::cpu::Builder::build<ngraph::op::Less>},
+                    {TI(ngraph::op::LessEq), &runtime::cpu::Builder::build<ngraph::op::LessEq>},
+                    {TI(ngraph::op::And), &runtime::cpu::Builder::build<ngraph::op::And>},
+                    {TI(ngraph::op::Or), &runtime::cpu::Builder::build<ngraph::op::Or>},
+                    {TI(ngraph::op::Not), &runtime::cpu::Builder::build<ngraph::op::Not>},
+                    {TI(ngraph::op::Abs), &runtime::cpu::Builder::build<ngraph::op::Abs>},
+                    {TI(ngraph::op::Negative), &runtime::cpu::Builder::build<ngraph::op::Negative>},
+                    {TI(ngraph::op::Sign), &runtime::cpu::Builder::build<ngraph::op::Sign>},
+                    {TI(ngraph::op::Ceiling), &runtime::cpu::Builder::build<ngraph::op::Ceiling>},
+                    {TI(ngraph::op::Floor), &runtime::cpu::Builder::build<ngraph::op::Floor>},
+                    {TI(ngraph::op::Sqrt), &runtime::cpu::Builder::build<ngraph::op::Sqrt>},
+                    {TI(ngraph::op::Exp), &runtime::cpu::Builder::build<ngraph::op::Exp>},
+                    {TI(ngraph::op::Log), &runtime::cpu::Builder::build<ngraph::op::Log>},
+                    {TI(ngraph::op::Sin), &runtime::cpu::Builder::build<ngraph::op::Sin>},
+                    {TI(ngraph::op::Cos), &runtime::cpu::Builder::build<ngraph::op::Cos>},
+                    {TI(ngraph::op::Tan), &runtime::cpu::Builder::build<ngraph::op::Tan>},
+                    {TI(ngraph::op::Asin), &runtime::cpu::Builder::build<ngraph::op::Asin>},
+                    {TI(ngraph::op::Acos), &runtime::cpu::Builder::build<ngraph::op::Acos>},
+                    {TI(ngraph::op::Atan), &runtime::cpu::Builder::build<ngraph::op::Atan>},
+                    {TI(ngraph::op::Sinh), &runtime::cpu::Builder::build<ngraph::op::Sinh>},
+                    {TI(ngraph::op::Cosh), &runtime::cpu::Builder::build<ngraph::op::Cosh>},
+                    {TI(ngraph::op::Tanh), &runtime::cpu::Builder::build<ngraph::op::Tanh>},
+                    {TI(ngraph::op::Select), &runtime::cpu::Builder::build<ngraph::op::Select>},
+                    {TI(ngraph::op::Result), &runtime::cpu::Builder::build<ngraph::op::Result>},
+                    {TI(ngraph::op::Constant),
+                     &runtime::cpu::Builder::build<ngraph::op::Constant>}};
+                return build_dispatcher;
+            }
         }
     }
 }
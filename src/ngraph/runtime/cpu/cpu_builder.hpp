@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
+#include "ngraph/except.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
@@ -29,6 +33,187 @@
                    const std::vector<TensorViewWrapper>& args,                                     \
                    const std::vector<TensorViewWrapper>& out)
 
+// Per-type kernel macro
+#define SELECT_KERNEL(KV, ET, K)                                                                   \
+    if (ET == element::boolean)                                                                    \
+    {                                                                                              \
+        KV = K<char>;                                                                              \
+    }                                                                                              \
+    else if (ET == element::f32)                                                                   \
+    {                                                                                              \
+        KV = K<float>;                                                                             \
+    }                                                                                              \
+    else if (ET == element::f64)                                                                   \
+    {                                                                                              \
+        KV = K<double>;                                                                            \
+    }                                                                                              \
+    else if (ET == element::i8)                                                                    \
+    {                                                                                              \
+        KV = K<int8_t>;                                                                            \
+    }                                                                                              \
+    else if (ET == element::i16)                                                                   \
+    {                                                                                              \
+        KV = K<int16_t>;                                                                           \
+    }                                                                                              \
+    else if (ET == element::i32)                                                                   \
+    {                                                                                              \
+        KV = K<int32_t>;                                                                           \
+    }                                                                                              \
+    else if (ET == element::i64)                                                                   \
+    {                                                                                              \
+        KV = K<int64_t>;                                                                           \
+    }                                                                                              \
+    else if (ET == element::u8)                                                                    \
+    {                                                                                              \
+        KV = K<uint8_t>;                                                                           \
+    }                                                                                              \
+    else if (ET == element::u16)                                                                   \
+    {                                                                                              \
+        KV = K<uint16_t>;                                                                          \
+    }                                                                                              \
+    else if (ET == element::u32)                                                                   \
+    {                                                                                              \
+        KV = K<uint32_t>;                                                                          \
+    }                                                                                              \
+    else if (ET == element::u64)                                                                   \
+    {                                                                                              \
+        KV = K<uint64_t>;                                                                          \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);  \
+    }
+
+// Per-rank kernel macro for the Eigen kernels, which need the rank at compile time
+#define SELECT_RANK(KV, T, R, K)                                                                   \
+    if (R == 1)                                                                                    \
+    {                                                                                              \
+        KV = K<T, 1>;                                                                              \
+    }                                                                                              \
+    else if (R == 2)                                                                               \
+    {                                                                                              \
+        KV = K<T, 2>;                                                                              \
+    }                                                                                              \
+    else if (R == 3)                                                                               \
+    {                                                                                              \
+        KV = K<T, 3>;                                                                              \
+    }                                                                                              \
+    else if (R == 4)                                                                               \
+    {                                                                                              \
+        KV = K<T, 4>;                                                                              \
+    }                                                                                              \
+    else if (R == 5)                                                                               \
+    {                                                                                              \
+        KV = K<T, 5>;                                                                              \
+    }                                                                                              \
+    else if (R == 6)                                                                               \
+    {                                                                                              \
+        KV = K<T, 6>;                                                                              \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported rank " + std::to_string(R) + " for kernel " #K);           \
+    }
+
+// Per-type and per-rank kernel macro
+#define SELECT_KERNEL_BY_RANK(KV, ET, R, K)                                                        \
+    if (ET == element::boolean)                                                                    \
+    {                                                                                              \
+        SELECT_RANK(KV, char, R, K);                                                               \
+    }                                                                                              \
+    else if (ET == element::f32)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, float, R, K);                                                              \
+    }                                                                                              \
+    else if (ET == element::f64)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, double, R, K);                                                             \
+    }                                                                                              \
+    else if (ET == element::i8)                                                                    \
+    {                                                                                              \
+        SELECT_RANK(KV, int8_t, R, K);                                                             \
+    }                                                                                              \
+    else if (ET == element::i16)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, int16_t, R, K);                                                            \
+    }                                                                                              \
+    else if (ET == element::i32)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, int32_t, R, K);                                                            \
+    }                                                                                              \
+    else if (ET == element::i64)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, int64_t, R, K);                                                            \
+    }                                                                                              \
+    else if (ET == element::u8)                                                                    \
+    {                                                                                              \
+        SELECT_RANK(KV, uint8_t, R, K);                                                            \
+    }                                                                                              \
+    else if (ET == element::u16)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, uint16_t, R, K);                                                           \
+    }                                                                                              \
+    else if (ET == element::u32)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, uint32_t, R, K);                                                           \
+    }                                                                                              \
+    else if (ET == element::u64)                                                                   \
+    {                                                                                              \
+        SELECT_RANK(KV, uint64_t, R, K);                                                           \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K);  \
+    }
+
+// Highest rank handled by SELECT_RANK; builders fall back to reference kernels above it
+#define MAX_EIGEN_KERNEL_RANK 6
+
+#define BUILD_UNARY_ELEMWISE_FUNCTOR(OP)                                                           \
+    auto& functors = external_function->get_functors();                                            \
+    auto& tensor_data = external_function->get_tensor_data();                                      \
+    std::function<void(void*, void*, size_t)> kernel;                                              \
+                                                                                                   \
+    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+                                                                                                   \
+    auto element_count = out[0].get_size();                                                        \
+    auto& arg0_tensor = tensor_data[args[0].get_name()];                                           \
+    auto& out0_tensor = tensor_data[out[0].get_name()];                                            \
+                                                                                                   \
+    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
+        kernel(arg0_tensor, out0_tensor, element_count);                                           \
+    };                                                                                             \
+    functors.emplace_back(functor)
+
+#define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
+    auto& functors = external_function->get_functors();                                            \
+    auto& tensor_data = external_function->get_tensor_data();                                      \
+    std::function<void(void*, void*, void*, size_t)> kernel;                                       \
+                                                                                                   \
+    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
+                                                                                                   \
+    auto element_count = out[0].get_size();                                                        \
+    auto& arg0_tensor = tensor_data[args[0].get_name()];                                           \
+    auto& arg1_tensor = tensor_data[args[1].get_name()];                                           \
+    auto& out0_tensor = tensor_data[out[0].get_name()];                                            \
+                                                                                                   \
+    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
+        kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count);                              \
+    };                                                                                             \
+    functors.emplace_back(functor)
+
+// Registers a builder for an op from a builder/ translation unit
+#define REGISTER_OP_BUILDER(OP)                                                                    \
+    static struct register_##OP##_builder                                                          \
+    {                                                                                              \
+        register_##OP##_builder()                                                                  \
+        {                                                                                          \
+            get_global_build_dispatcher().insert(                                                  \
+                {type_index(typeid(ngraph::op::OP)),                                               \
+                 &runtime::cpu::Builder::build<ngraph::op::OP>});                                  \
+        }                                                                                          \
+    } register_##OP##_builder_instance
+
 namespace ngraph
 {
     namespace runtime
@@ -43,7 +228,9 @@ namespace ngraph
 
             using BuildOpMap = std::unordered_map<std::type_index, BuildOpFunction>;
 
-            extern const BuildOpMap build_dispatcher;
+            /// \brief Builders for every op supported in direct execution mode. Builders that
+            ///        live outside cpu_builder.cpp add themselves with REGISTER_OP_BUILDER.
+            BuildOpMap& get_global_build_dispatcher();
 
             class Builder
             {
@@ -15,10 +15,13 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
 
+#include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 
@@ -26,16 +29,36 @@ using namespace std;
 using namespace ngraph;
 
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                                           EntryPoint compiled_function)
+                                           EntryPoint compiled_function,
+                                           size_t max_concurrent_calls)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_max_contexts(max_concurrent_calls)
+    , m_call_count(0)
 {
-    setup_runtime_context();
+    if (m_max_contexts == 0)
+    {
+        throw ngraph_error("CPU call frame needs at least one runtime context");
+    }
+    // The direct execution functors read their tensors from slots owned by the external
+    // function, so only one call can be in flight at a time
+    if (m_external_function->is_direct_execution())
+    {
+        m_max_contexts = 1;
+    }
+    m_free_contexts.push_back(setup_runtime_context(true));
+    m_contexts.push_back(m_free_contexts.back());
 }
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
-    cleanup_runtime_context();
+    for (auto ctx : m_contexts)
+    {
+        if (ctx != nullptr)
+        {
+            cleanup_runtime_context(ctx);
+        }
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::call(
@@ -48,11 +71,16 @@ void runtime::cpu::CPU_CallFrame::call(
     propagate_layouts(input_tvs, m_external_function->get_parameter_layout_descriptors());
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
 
+    size_t call_id;
+    bool ran_previous_call;
+    CPURuntimeContext* ctx = acquire_context(call_id, ran_previous_call);
+
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        ctx->p_en[i] = tv->get_stale();
+        // Unchanged inputs only let us skip work if this context also ran the previous call
+        ctx->p_en[i] = tv->get_stale() || !ran_previous_call;
         inputs.push_back(tv->get_data_ptr());
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
@@ -62,14 +90,28 @@ void runtime::cpu::CPU_CallFrame::call(
         outputs.push_back(tv->get_data_ptr());
     }
 
-    // Invoke compiled computation
-    if (!m_external_function->is_direct_execution())
+    CPUExecutor& executor = m_executor ? *m_executor : CPUExecutor::get_default();
+    ctx->executor = &executor;
+    try
     {
-        m_compiled_function(inputs.data(), outputs.data(), ctx);
+        // Invoke compiled computation
+        if (!m_external_function->is_direct_execution())
+        {
+            executor.execute([&]() { m_compiled_function(inputs.data(), outputs.data(), ctx); },
+                             m_external_function->uses_tbb());
+        }
+        else
+        {
+            executor.execute(
+                [&]() { m_external_function->get_executor()(ctx, inputs, outputs); });
+        }
     }
-    else
+    catch (...)
     {
-        m_external_function->get_executor()(ctx, inputs, outputs);
+        // The temporaries of a failed call are unusable for skipping work later
+        ctx->first_iteration = true;
+        release_context(ctx, call_id);
+        throw;
     }
 
     if (runtime::cpu::IsTracingEnabled())
@@ -78,6 +120,104 @@ void runtime::cpu::CPU_CallFrame::call(
                          ctx->op_durations,
                          m_external_function->get_function_name() + ".timeline.json");
     }
+
+    release_context(ctx, call_id);
+}
+
+runtime::cpu::CPURuntimeContext*
+    runtime::cpu::CPU_CallFrame::acquire_context(size_t& call_id, bool& ran_previous_call)
+{
+    CPURuntimeContext* ctx = nullptr;
+    bool create = false;
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_context_available.wait(lock, [this]() {
+            return !m_free_contexts.empty() || m_contexts.size() < m_max_contexts;
+        });
+        call_id = ++m_call_count;
+        ran_previous_call = false;
+        if (!m_free_contexts.empty())
+        {
+            ctx = m_free_contexts.back();
+            m_free_contexts.pop_back();
+            ran_previous_call = (m_last_call_ids[ctx] + 1 == call_id);
+        }
+        else
+        {
+            // Reserve the slot so other callers don't exceed the limit while we allocate
+            m_contexts.push_back(nullptr);
+            create = true;
+        }
+    }
+
+    if (create)
+    {
+        try
+        {
+            ctx = setup_runtime_context(false);
+        }
+        catch (...)
+        {
+            // Give the reserved slot back so the pool keeps its capacity
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_contexts.erase(find(m_contexts.begin(), m_contexts.end(), nullptr));
+            }
+            m_context_available.notify_one();
+            throw;
+        }
+        lock_guard<mutex> lock(m_mutex);
+        *find(m_contexts.begin(), m_contexts.end(), nullptr) = ctx;
+    }
+    return ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(CPURuntimeContext* ctx, size_t call_id)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_last_call_ids[ctx] = call_id;
+        m_free_contexts.push_back(ctx);
+    }
+    m_context_available.notify_one();
+}
+
+void runtime::cpu::CPU_CallFrame::set_executor(shared_ptr<CPUExecutor> executor)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_executor = executor;
+    for (auto ctx : m_contexts)
+    {
+        if (ctx != nullptr)
+        {
+            bind_to_numa_node(ctx);
+        }
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::bind_to_numa_node(CPURuntimeContext* ctx)
+{
+    if (!m_executor || m_executor->get_numa_node() < 0)
+    {
+        return;
+    }
+    size_t node = m_executor->get_numa_node();
+    bool placed = true;
+    for (auto buffer : ctx->memory_buffers)
+    {
+        placed &= numa::bind_memory(buffer->get_ptr(), buffer->size(), node);
+    }
+    const auto& workspace_sizes =
+        m_external_function->get_mkldnn_emitter()->get_mkldnn_workspace_sizes();
+    for (size_t i = 0; i < workspace_sizes.size(); i++)
+    {
+        placed &= numa::bind_memory(ctx->mkldnn_workspaces[i], workspace_sizes[i], node);
+    }
+    if (!placed)
+    {
+        NGRAPH_WARN << "Unable to place the temporary memory of "
+                    << m_external_function->get_function_name() << " on NUMA node " << node;
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -100,9 +240,10 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+runtime::cpu::CPURuntimeContext*
+    runtime::cpu::CPU_CallFrame::setup_runtime_context(bool use_emitter_primitives)
 {
-    ctx = new CPURuntimeContext;
+    auto ctx = new CPURuntimeContext;
 
     ctx->op_durations = nullptr;
     if (runtime::cpu::IsTracingEnabled())
@@ -110,6 +251,10 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
         ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
     }
     ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    ctx->t_en = new bool[m_external_function->get_tensor_enable_count()];
+    ctx->first_iteration = true;
+    ctx->executor = nullptr;
+
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
@@ -117,15 +262,60 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
         auto buffer = new AlignedBuffer(buffer_size, alignment);
         ctx->memory_buffers.push_back(buffer);
     }
+    if (m_external_function->is_direct_execution())
+    {
+        m_external_function->bind_intermediates(ctx);
+    }
+
+    // The first context uses the MKLDNN primitives and workspaces built by the emitter,
+    // every other context binds its buffers to copies of its own
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-    ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
-    ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
+    if (use_emitter_primitives)
+    {
+        ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
+        ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
+    }
+    else
+    {
+        auto primitives = mkldnn_emitter->clone_mkldnn_primitives();
+        mkldnn::primitive** clones = new mkldnn::primitive*[primitives.size()];
+        copy(primitives.begin(), primitives.end(), clones);
+        ctx->mkldnn_primitives = clones;
+
+        auto workspace_sizes = mkldnn_emitter->get_mkldnn_workspace_sizes();
+        char** workspaces = new char*[workspace_sizes.size()];
+        for (size_t i = 0; i < workspace_sizes.size(); i++)
+        {
+            workspaces[i] = static_cast<char*>(malloc(workspace_sizes[i]));
+        }
+        ctx->mkldnn_workspaces = workspaces;
+    }
+    bind_to_numa_node(ctx);
+    return ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context(CPURuntimeContext* ctx)
 {
+    const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+    if (ctx->mkldnn_primitives != mkldnn_emitter->get_mkldnn_primitives().data())
+    {
+        size_t primitive_count = mkldnn_emitter->get_mkldnn_primitives().size();
+        for (size_t i = 0; i < primitive_count; i++)
+        {
+            delete ctx->mkldnn_primitives[i];
+        }
+        delete[] ctx->mkldnn_primitives;
+
+        size_t workspace_count = mkldnn_emitter->get_mkldnn_workspaces().size();
+        for (size_t i = 0; i < workspace_count; i++)
+        {
+            free(ctx->mkldnn_workspaces[i]);
+        }
+        delete[] ctx->mkldnn_workspaces;
+    }
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->t_en;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
@@ -39,29 +43,55 @@ namespace ngraph
             using EntryPoint = std::function<EntryPoint_t>;
 
             // Compile and execute graphs
+            //
+            // A call frame owns a pool of runtime contexts that share the compiled code and
+            // constants of its external function. Each call checks out a context for its
+            // duration, so up to max_concurrent_calls() calls may execute at the same time;
+            // further callers block until a context is released.
             class CPU_CallFrame
             {
             public:
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
-                              EntryPoint compiled_function);
+                              EntryPoint compiled_function,
+                              size_t max_concurrent_calls = 1);
                 ~CPU_CallFrame();
 
                 /// @brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
+                /// Safe to call from multiple threads.
                 void call(const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::TensorView>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
-                void setup_runtime_context();
-                void cleanup_runtime_context();
+                size_t max_concurrent_calls() const { return m_max_contexts; }
+                /// @brief Run calls on executor instead of the default one, and move the
+                ///   temporary memory to its NUMA node if it has one. Not safe to change
+                ///   while calls are in flight.
+                void set_executor(std::shared_ptr<CPUExecutor> executor);
+                CPURuntimeContext* setup_runtime_context(bool use_emitter_primitives);
+                void cleanup_runtime_context(CPURuntimeContext* ctx);
 
             protected:
+                CPURuntimeContext* acquire_context(size_t& call_id, bool& ran_previous_call);
+                void release_context(CPURuntimeContext* ctx, size_t call_id);
+                void bind_to_numa_node(CPURuntimeContext* ctx);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
-                CPURuntimeContext* ctx;
+                std::shared_ptr<CPUExecutor> m_executor;
+
+                size_t m_max_contexts;
+                // Contexts are created on demand and reused most-recently-released first so
+                // that a sequential caller always sees the context from its previous call
+                std::vector<CPURuntimeContext*> m_contexts;
+                std::vector<CPURuntimeContext*> m_free_contexts;
+                std::unordered_map<CPURuntimeContext*, size_t> m_last_call_ids;
+                size_t m_call_count;
+                std::mutex m_mutex;
+                std::condition_variable m_context_available;
             };
         }
     }
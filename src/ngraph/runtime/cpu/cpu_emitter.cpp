@@ -98,6 +98,7 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
@@ -985,7 +986,7 @@ namespace ngraph
                         writer.block_end();
                     }
                 }
-                else
+                else if (s_use_ref_kernels)
                 {
                     writer << "reference::dot(" << args[0].get_name() << ",\n";
                     writer << "            " << args[1].get_name() << ",\n";
@@ -995,6 +996,17 @@ namespace ngraph
                     writer << "            {" << join(out[0].get_shape()) << "},\n";
                     writer << "            " << dot->get_reduction_axes_count() << ");\n";
                 }
+                else
+                {
+                    writer << "cpu::kernel::dot_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << args[1].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(args[1].get_shape()) << "},\n";
+                    writer << "                         " << dot->get_reduction_axes_count()
+                           << ");\n";
+                }
             }
 
             template <>
@@ -1590,6 +1602,13 @@ namespace ngraph
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Reshape)
             {
                 auto reshape = static_cast<const ngraph::op::Reshape*>(node);
+                // Memory layout placed the result over the argument, nothing to move
+                if (args[0].get_name() == out[0].get_name())
+                {
+                    writer << "// " << node->get_name() << " is a view of " << args[0].get_name()
+                           << "\n";
+                    return;
+                }
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
                 auto arg_shape = args[0].get_shape();
@@ -2477,8 +2496,7 @@ namespace ngraph
 
                     writer.block_end();
                 }
-                // Other cases are not handled yet.
-                else
+                else if (s_use_ref_kernels)
                 {
                     writer << "reference::one_hot<" << out[0].get_type() << ">("
                            << args[0].get_name() << ",\n";
@@ -2487,6 +2505,17 @@ namespace ngraph
                     writer << "                   {" << join(out[0].get_shape()) << "},\n";
                     writer << "                   " << oh->get_one_hot_axis() << ");\n";
                 }
+                else
+                {
+                    writer << "cpu::kernel::one_hot_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                             " << out[0].get_name() << ",\n";
+                    writer << "                             {" << join(args[0].get_shape())
+                           << "},\n";
+                    writer << "                             {" << join(out[0].get_shape())
+                           << "},\n";
+                    writer << "                             " << oh->get_one_hot_axis() << ");\n";
+                }
             }
 
             template <>
@@ -3211,7 +3240,7 @@ namespace ngraph
                     writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
                            << to_string(max_pool_index) << ");\n";
                 }
-                else
+                else if (s_use_ref_kernels)
                 {
                     writer << "reference::max_pool<" << out[0].get_type() << ">("
                            << args[0].get_name() << ",\n";
@@ -3225,6 +3254,19 @@ namespace ngraph
                     writer << "                 {" << join(max_pool->get_padding_above())
                            << "});\n";
                 }
+                else
+                {
+                    writer << "cpu::kernel::max_pool_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                 " << out[0].get_name() << ",\n";
+                    writer << "                 {" << join(arg_shape) << "},\n";
+                    writer << "                 {" << join(result_shape) << "},\n";
+                    writer << "                 {" << join(max_pool->get_window_shape()) << "},\n";
+                    writer << "                 {" << join(max_pool->get_window_movement_strides())
+                           << "},\n";
+                    writer << "                 {" << join(max_pool->get_padding_below())
+                           << "});\n";
+                }
             }
 
             template <>
@@ -3274,12 +3316,25 @@ namespace ngraph
                 auto arg_shape = args[0].get_shape();
                 auto result_shape = out[0].get_shape();
 
-                writer << "reference::reverse<" << out[0].get_type() << ">(" << args[0].get_name()
-                       << ",\n";
-                writer << "                " << out[0].get_name() << ",\n";
-                writer << "                {" << join(arg_shape) << "},\n";
-                writer << "                {" << join(result_shape) << "},\n";
-                writer << "                {" << join(reverse->get_reversed_axes()) << "});\n";
+                if (s_use_ref_kernels)
+                {
+                    writer << "reference::reverse<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                " << out[0].get_name() << ",\n";
+                    writer << "                {" << join(arg_shape) << "},\n";
+                    writer << "                {" << join(result_shape) << "},\n";
+                    writer << "                {" << join(reverse->get_reversed_axes()) << "});\n";
+                }
+                else
+                {
+                    writer << "cpu::kernel::reverse_nd(" << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_element_type().size()
+                           << ",\n";
+                    writer << "                         {" << join(arg_shape) << "},\n";
+                    writer << "                         {" << join(reverse->get_reversed_axes())
+                           << "});\n";
+                }
             }
 
             template <>
@@ -3489,7 +3544,7 @@ namespace ngraph
                     writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
                            << to_string(avg_pool_index) << ");\n";
                 }
-                else
+                else if (s_use_ref_kernels)
                 {
                     writer << "reference::avg_pool<" << out[0].get_type() << ">("
                            << args[0].get_name() << ",\n";
@@ -3507,6 +3562,22 @@ namespace ngraph
                            << "\n";
                     writer << "                  );\n";
                 }
+                else
+                {
+                    writer << "cpu::kernel::avg_pool_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                 " << out[0].get_name() << ",\n";
+                    writer << "                 {" << join(arg_shape) << "},\n";
+                    writer << "                 {" << join(result_shape) << "},\n";
+                    writer << "                 {" << join(avg_pool->get_window_shape()) << "},\n";
+                    writer << "                 {" << join(avg_pool->get_window_movement_strides())
+                           << "},\n";
+                    writer << "                 {" << join(avg_pool->get_padding_below()) << "},\n";
+                    writer << "                 "
+                           << ngraph::to_cplusplus_sourcecode_literal(
+                                  avg_pool->get_include_padding_in_avg_computation())
+                           << ");\n";
+                }
             }
 
             template <>
@@ -3530,7 +3601,7 @@ namespace ngraph
                            << "                            {" << join(pad->get_padding_above())
                            << "});\n";
                 }
-                else
+                else if (s_use_ref_kernels)
                 {
                     writer << "reference::pad<" << out[0].get_type() << ">(" << args[0].get_name()
                            << ",\n";
@@ -3542,6 +3613,18 @@ namespace ngraph
                     writer << "            {" << join(pad->get_padding_above()) << "},\n";
                     writer << "            {" << join(pad->get_padding_interior()) << "});\n";
                 }
+                else
+                {
+                    writer << "cpu::kernel::pad_nd(" << args[0].get_name() << ",\n";
+                    writer << "                     " << args[1].get_name() << ",\n";
+                    writer << "                     " << out[0].get_name() << ",\n";
+                    writer << "                     " << out[0].get_element_type().size() << ",\n";
+                    writer << "                     {" << join(arg0_shape) << "},\n";
+                    writer << "                     {" << join(result_shape) << "},\n";
+                    writer << "                     {" << join(pad->get_padding_below()) << "},\n";
+                    writer << "                     {" << join(pad->get_padding_interior())
+                           << "});\n";
+                }
             }
 
             template <>
@@ -3634,7 +3717,9 @@ namespace ngraph
                     writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(fdeps[1])
                            << ", " << out[0].get_name() << ");\n";
                     writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(fdeps[2])
-                           << ", ctx->mkldnn_workspaces[" << fdeps[3] << "]);\n";
+                           << ", ctx->mkldnn_workspaces["
+                           << mkldnn_emitter->get_primitive_workspace(max_pool_index - 1)
+                           << "]);\n";
                     writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
                            << to_string(max_pool_index - 1) << ");\n";
 
@@ -3642,7 +3727,8 @@ namespace ngraph
                     writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(bdeps[0])
                            << ", " << args[1].get_name() << ");\n";
                     writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(bdeps[1])
-                           << ", ctx->mkldnn_workspaces[" << bdeps[3] << "]);\n";
+                           << ", ctx->mkldnn_workspaces["
+                           << mkldnn_emitter->get_primitive_workspace(max_pool_index) << "]);\n";
                     writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(bdeps[2])
                            << ", " << out[0].get_name() << ");\n";
 
@@ -3758,14 +3844,25 @@ namespace ngraph
                            << "});\n";
                 }
 #else
-                // TODO: add an emitter akin to the emit_sum
-                writer << "reference::product<" << out[0].get_type() << ">(" << args[0].get_name()
-                       << ",\n";
-                writer << "                         " << out[0].get_name() << ",\n";
-                writer << "                         {" << join(args[0].get_shape()) << "},\n";
-                writer << "                         {" << join(out[0].get_shape()) << "},\n";
-                writer << "                         {" << join(product->get_reduction_axes())
-                       << "});\n";
+                if (s_use_ref_kernels)
+                {
+                    writer << "reference::product<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(out[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(product->get_reduction_axes())
+                           << "});\n";
+                }
+                else
+                {
+                    writer << "cpu::kernel::reduce_product_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(product->get_reduction_axes())
+                           << "});\n";
+                }
 #endif
                 writer.block_end();
             }
@@ -3838,7 +3935,7 @@ namespace ngraph
                            << "{" << join(max->get_reduction_axes()) << "}"
                            << ");\n";
                 }
-                else
+                else if (s_use_ref_kernels)
                 {
                     writer << "reference::max<" << out[0].get_type() << ">(" << args[0].get_name()
                            << ",\n";
@@ -3848,6 +3945,15 @@ namespace ngraph
                     writer << "                         {" << join(max->get_reduction_axes())
                            << "});\n";
                 }
+                else
+                {
+                    writer << "cpu::kernel::reduce_max_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(max->get_reduction_axes())
+                           << "});\n";
+                }
 #endif
                 writer.block_end();
             }
@@ -3910,14 +4016,25 @@ namespace ngraph
                            << "});\n";
                 }
 #else
-                // TODO: add an emitter akin to the emit_sum
-                writer << "reference::min<" << out[0].get_type() << ">(" << args[0].get_name()
-                       << ",\n";
-                writer << "                         " << out[0].get_name() << ",\n";
-                writer << "                         {" << join(args[0].get_shape()) << "},\n";
-                writer << "                         {" << join(out[0].get_shape()) << "},\n";
-                writer << "                         {" << join(min->get_reduction_axes())
-                       << "});\n";
+                if (s_use_ref_kernels)
+                {
+                    writer << "reference::min<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(out[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(min->get_reduction_axes())
+                           << "});\n";
+                }
+                else
+                {
+                    writer << "cpu::kernel::reduce_min_nd<" << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "                         " << out[0].get_name() << ",\n";
+                    writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                    writer << "                         {" << join(min->get_reduction_axes())
+                           << "});\n";
+                }
 #endif
                 writer.block_end();
             }
@@ -4164,6 +4281,49 @@ namespace ngraph
                 }
                 return func_block;
             }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::LoopKernel)
+            {
+                auto kernel = static_cast<const ngraph::op::LoopKernel*>(node);
+                const NodeVector& nodes = kernel->get_nodes();
+
+                unordered_map<const Node*, string> values;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    values[kernel->get_parameters()[i].get()] = args[i].get_name() + "[i]";
+                }
+
+                // Intermediates are named by position so that identical kernels emit identical
+                // code and can share a function
+                writer.block_begin();
+                writer << "#pragma omp parallel for simd\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                for (size_t i = 0; i < nodes.size(); i++)
+                {
+                    vector<string> operands;
+                    for (const shared_ptr<Node>& arg : nodes[i]->get_arguments())
+                    {
+                        operands.push_back(values.at(arg.get()));
+                    }
+                    string expression = kernel::emit_elementwise_expression(*nodes[i], operands);
+                    if (i + 1 == nodes.size())
+                    {
+                        writer << out[0].get_name() << "[i] = " << expression << ";\n";
+                    }
+                    else
+                    {
+                        string value = "t" + to_string(i);
+                        writer << nodes[i]->get_element_type().c_type_string() << " " << value
+                               << " = " << expression << ";\n";
+                        values[nodes[i].get()] = value;
+                    }
+                }
+                writer.block_end();
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::SigmoidMultiply)
             {
@@ -0,0 +1,432 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <omp.h>
+
+#ifdef NGRAPH_TBB_ENABLE
+#include <tbb/task_arena.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef NGRAPH_TBB_ENABLE
+struct runtime::cpu::CPUExecutor::Arena
+{
+    Arena(int thread_count)
+        : m_arena(thread_count)
+    {
+    }
+
+    tbb::task_arena m_arena;
+};
+#else
+struct runtime::cpu::CPUExecutor::Arena
+{
+};
+#endif
+
+static thread_local runtime::cpu::CPUExecutor* s_current_executor = nullptr;
+static thread_local Eigen::ThreadPoolDevice* s_current_device = nullptr;
+// The OpenMP workers of a thread are kept between its parallel regions, so the cores and the
+// team size they were last pinned for are remembered per thread
+static thread_local vector<int> s_omp_team_affinity;
+static thread_local int s_omp_team_size = 0;
+
+static bool set_thread_affinity(const vector<int>& cores)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int core : cores)
+    {
+        CPU_SET(core, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+// Restricts the workers of the OpenMP team the calling thread starts to a set of cores, or to
+// the cores of the calling thread if empty. The calling thread itself is left alone.
+static void set_omp_team_affinity(const vector<int>& cores)
+{
+    int thread_count = omp_get_max_threads();
+    // A smaller team reuses workers that are pinned already
+    if (omp_in_parallel() ||
+        (cores == s_omp_team_affinity && (cores.empty() || thread_count <= s_omp_team_size)))
+    {
+        return;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    if (cores.empty())
+    {
+        // Release the workers from the cores of the executor that pinned them last
+        if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            return;
+        }
+    }
+    else
+    {
+        CPU_ZERO(&set);
+        for (int core : cores)
+        {
+            CPU_SET(core, &set);
+        }
+    }
+#pragma omp parallel num_threads(thread_count)
+    {
+        if (omp_get_thread_num() != 0)
+        {
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+    }
+#endif
+    s_omp_team_affinity = cores;
+    s_omp_team_size = thread_count;
+}
+
+// Restricts the calling thread to a set of cores until destroyed
+class AffinityScope
+{
+public:
+    AffinityScope(const vector<int>& cores)
+        : m_restore(false)
+    {
+#ifdef __linux__
+        if (!cores.empty() &&
+            pthread_getaffinity_np(pthread_self(), sizeof(m_previous), &m_previous) == 0)
+        {
+            m_restore = set_thread_affinity(cores);
+        }
+#endif
+    }
+
+    ~AffinityScope()
+    {
+#ifdef __linux__
+        if (m_restore)
+        {
+            pthread_setaffinity_np(pthread_self(), sizeof(m_previous), &m_previous);
+        }
+#endif
+    }
+
+private:
+    bool m_restore;
+#ifdef __linux__
+    cpu_set_t m_previous;
+#endif
+};
+
+struct runtime::cpu::CPUExecutor::InterOpThreads
+{
+    struct Job
+    {
+        const function<void(size_t)>* m_function;
+        size_t m_next_index;
+        size_t m_running;
+    };
+
+    InterOpThreads(size_t thread_count, const vector<int>& affinity)
+        : m_thread_count(thread_count)
+        , m_affinity(affinity)
+        , m_stop(false)
+    {
+    }
+
+    ~InterOpThreads()
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_job_available.notify_all();
+        for (thread& t : m_threads)
+        {
+            t.join();
+        }
+    }
+
+    // Called with m_mutex held
+    void start()
+    {
+        for (size_t i = 1; i < m_thread_count; i++)
+        {
+            m_threads.emplace_back(&InterOpThreads::run, this);
+        }
+    }
+
+    void run();
+
+    size_t m_thread_count;
+    vector<int> m_affinity;
+    bool m_stop;
+    mutex m_mutex;
+    condition_variable m_job_available;
+    condition_variable m_job_done;
+    deque<Job*> m_jobs;
+    vector<thread> m_threads;
+};
+
+void runtime::cpu::CPUExecutor::InterOpThreads::run()
+{
+    if (!m_affinity.empty())
+    {
+        set_thread_affinity(m_affinity);
+    }
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_job_available.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+        if (m_stop)
+        {
+            return;
+        }
+        Job* job = m_jobs.front();
+        size_t index = job->m_next_index++;
+        if (job->m_next_index == m_thread_count)
+        {
+            m_jobs.pop_front();
+        }
+        job->m_running++;
+        lock.unlock();
+        (*job->m_function)(index);
+        lock.lock();
+        if (--job->m_running == 0)
+        {
+            m_job_done.notify_all();
+        }
+    }
+}
+
+static size_t get_default_thread_count()
+{
+    const char* omp_num_threads = std::getenv("OMP_NUM_THREADS");
+    int count = (omp_num_threads ? std::atoi(omp_num_threads) : 0);
+    if (count <= 0)
+    {
+        count = std::thread::hardware_concurrency() >> 1;
+    }
+    return count > 0 ? count : 1;
+}
+
+runtime::cpu::CPUExecutor::CPUExecutor(size_t thread_count, const vector<int>& affinity)
+    : CPUExecutor(thread_count, affinity, true)
+{
+}
+
+runtime::cpu::CPUExecutor::CPUExecutor(size_t thread_count,
+                                       const vector<int>& affinity,
+                                       bool limit_runtimes)
+    : m_thread_count(thread_count)
+    , m_affinity(affinity)
+    , m_numa_node(-1)
+    , m_limit_runtimes(limit_runtimes)
+{
+    if (thread_count == 0)
+    {
+        throw ngraph_error("A CPU executor needs at least one thread");
+    }
+    for (int core : affinity)
+    {
+#ifdef __linux__
+        if (core < 0 || core >= CPU_SETSIZE)
+        {
+            throw ngraph_error("Invalid core " + to_string(core) + " in CPU executor affinity");
+        }
+#else
+        throw ngraph_error("CPU executor affinity is only supported on Linux");
+#endif
+    }
+
+    int count = static_cast<int>(thread_count);
+    m_pool.reset(new Eigen::ThreadPool(count));
+    for (int i = 1; i <= count; i++)
+    {
+        m_devices.emplace_back(new Eigen::ThreadPoolDevice(m_pool.get(), i));
+    }
+    m_inter_op_threads.reset(new InterOpThreads(thread_count, affinity));
+#ifdef NGRAPH_TBB_ENABLE
+    if (limit_runtimes)
+    {
+        m_arena.reset(new Arena(count));
+    }
+#endif
+
+    if (!affinity.empty())
+    {
+        // No task finishes before all have started, so each pool thread runs exactly one
+        atomic<size_t> started(0);
+        atomic<bool> failed(false);
+        Eigen::Barrier done(count);
+        for (size_t i = 0; i < thread_count; i++)
+        {
+            m_pool->Schedule([&]() {
+                if (!set_thread_affinity(affinity))
+                {
+                    failed = true;
+                }
+                started++;
+                while (started < thread_count)
+                {
+                    this_thread::yield();
+                }
+                done.Notify();
+            });
+        }
+        done.Wait();
+        if (failed)
+        {
+            throw ngraph_error("Failed to set the affinity of the CPU executor threads");
+        }
+    }
+}
+
+runtime::cpu::CPUExecutor::~CPUExecutor()
+{
+}
+
+void runtime::cpu::CPUExecutor::execute(const function<void()>& f, bool use_tbb)
+{
+    // Serial kernels, MKLDNN and OpenMP's master thread run on the caller
+    AffinityScope affinity_scope(m_affinity);
+#ifdef NGRAPH_TBB_ENABLE
+    if (use_tbb && m_arena)
+    {
+        // Flow graph tasks spawned inside the arena stay on its threads
+        m_arena->m_arena.execute([&]() {
+            Scope scope(*this);
+            f();
+        });
+        return;
+    }
+#endif
+    Scope scope(*this);
+    f();
+}
+
+Eigen::ThreadPoolDevice& runtime::cpu::CPUExecutor::get_device(size_t thread_count)
+{
+    return *m_devices[min(max(thread_count, size_t(1)), m_thread_count) - 1];
+}
+
+void runtime::cpu::CPUExecutor::run_inter_op(const function<void(size_t)>& f)
+{
+    if (m_thread_count == 1)
+    {
+        f(0);
+        return;
+    }
+
+    InterOpThreads& threads = *m_inter_op_threads;
+    InterOpThreads::Job job{&f, 1, 0};
+    {
+        lock_guard<mutex> lock(threads.m_mutex);
+        if (threads.m_threads.empty())
+        {
+            threads.start();
+        }
+        threads.m_jobs.push_back(&job);
+    }
+    threads.m_job_available.notify_all();
+
+    f(0);
+
+    unique_lock<mutex> lock(threads.m_mutex);
+    auto it = find(threads.m_jobs.begin(), threads.m_jobs.end(), &job);
+    if (it != threads.m_jobs.end())
+    {
+        threads.m_jobs.erase(it);
+    }
+    threads.m_job_done.wait(lock, [&job]() { return job.m_running == 0; });
+}
+
+runtime::cpu::CPUExecutor& runtime::cpu::CPUExecutor::get_current()
+{
+    return s_current_executor ? *s_current_executor : get_default();
+}
+
+Eigen::ThreadPoolDevice& runtime::cpu::CPUExecutor::get_current_device()
+{
+    return s_current_device ? *s_current_device : get_current().get_device();
+}
+
+runtime::cpu::CPUExecutor& runtime::cpu::CPUExecutor::get_default()
+{
+    static CPUExecutor executor(get_default_thread_count(), {}, false);
+    return executor;
+}
+
+shared_ptr<runtime::cpu::CPUExecutor>
+    runtime::cpu::CPUExecutor::create_for_numa_node(size_t node_id)
+{
+    const numa::Node& node = numa::get_node(node_id);
+    auto executor = make_shared<CPUExecutor>(node.m_cpus.size(), node.m_cpus);
+    executor->m_numa_node = static_cast<int>(node_id);
+    return executor;
+}
+
+runtime::cpu::CPUExecutor::Scope::Scope(CPUExecutor& executor, size_t thread_count)
+    : m_previous(s_current_executor)
+    , m_previous_device(s_current_device)
+    , m_previous_omp_thread_count(0)
+{
+    s_current_executor = &executor;
+    s_current_device = (thread_count != 0 ? &executor.get_device(thread_count) : nullptr);
+    // The thread count of OpenMP regions is per thread, so concurrent calls on other
+    // threads keep theirs
+    if (executor.m_limit_runtimes || thread_count != 0)
+    {
+        m_previous_omp_thread_count = omp_get_max_threads();
+        omp_set_num_threads(static_cast<int>(
+            thread_count != 0 ? min(thread_count, executor.m_thread_count)
+                              : executor.m_thread_count));
+    }
+    // Most of the work of a call runs on the OpenMP workers of the threads that run it
+    set_omp_team_affinity(executor.m_affinity);
+}
+
+runtime::cpu::CPUExecutor::Scope::~Scope()
+{
+    if (m_previous_omp_thread_count != 0)
+    {
+        omp_set_num_threads(m_previous_omp_thread_count);
+    }
+    s_current_device = m_previous_device;
+    s_current_executor = m_previous;
+}
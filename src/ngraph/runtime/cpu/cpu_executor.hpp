@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Eigen
+{
+    class ThreadPoolInterface;
+    struct ThreadPoolDevice;
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief The threads that execute the kernels of CPU function calls.
+            ///
+            /// Eigen kernels run on the executor's thread pool, while OpenMP regions (the
+            /// emitted loops and MKLDNN primitives) and the TBB flow graph are limited to its
+            /// thread count. Task graphs run their ops on the caller and the executor's
+            /// inter-op threads. Functions that run concurrently with separate executors, for
+            /// example with disjoint affinity masks, don't compete for each other's cores.
+            /// An executor may be shared by any number of functions and concurrent calls.
+            class CPUExecutor
+            {
+            public:
+                /// \param thread_count The number of threads of the executor.
+                /// \param affinity The cores the executor's pool threads, the caller of execute
+                ///        while it runs and the OpenMP workers of the threads running its
+                ///        calls may run on. All cores if empty. Only supported on Linux.
+                CPUExecutor(size_t thread_count, const std::vector<int>& affinity = {});
+                ~CPUExecutor();
+
+                CPUExecutor(const CPUExecutor&) = delete;
+                CPUExecutor& operator=(const CPUExecutor&) = delete;
+
+                size_t get_thread_count() const { return m_thread_count; }
+                const std::vector<int>& get_affinity() const { return m_affinity; }
+                /// \brief The NUMA node the CPU backend places the memory of this executor's
+                ///        functions on, or -1 to leave it where it is allocated.
+                int get_numa_node() const { return m_numa_node; }
+                Eigen::ThreadPoolDevice& get_device() { return *m_devices.back(); }
+                /// \brief A device on the executor's pool that splits work for at most
+                ///        thread_count threads.
+                Eigen::ThreadPoolDevice& get_device(size_t thread_count);
+                /// \brief Calls f with this executor current on the calling thread, inside its
+                ///        TBB arena if use_tbb is set.
+                void execute(const std::function<void()>& f, bool use_tbb = false);
+
+                /// \brief Calls f(0) on the calling thread and f(i), 0 < i < get_thread_count(),
+                ///        on the inter-op threads that are idle or become idle before f(0)
+                ///        returns. Returns once every f that was started has returned, so f(0)
+                ///        must be able to finish the work on its own. f must not throw.
+                void run_inter_op(const std::function<void(size_t)>& f);
+
+                /// \brief The executor of the call running on this thread, or the default one.
+                static CPUExecutor& get_current();
+
+                /// \brief The Eigen device of the current executor, narrowed to the thread
+                ///        count of the innermost Scope that has one.
+                static Eigen::ThreadPoolDevice& get_current_device();
+
+                /// \brief The executor of functions that aren't given one. It is sized from
+                ///        OMP_NUM_THREADS, or half the hardware threads, and leaves the OpenMP
+                ///        and TBB thread counts at their defaults.
+                static CPUExecutor& get_default();
+
+                /// \brief An executor with a thread on each CPU of NUMA node node_id, whose
+                ///        functions keep their memory on that node.
+                static std::shared_ptr<CPUExecutor> create_for_numa_node(size_t node_id);
+
+                /// \brief Makes an executor current on this thread until destroyed. The
+                ///        emitted TBB flow graph nodes use it to run on the caller's executor.
+                ///
+                /// A non-zero thread_count limits the Eigen kernels and OpenMP regions started
+                /// in the scope to that many threads, which lets concurrent ops share the
+                /// executor's cores.
+                class Scope
+                {
+                public:
+                    Scope(CPUExecutor& executor, size_t thread_count = 0);
+                    ~Scope();
+
+                    Scope(const Scope&) = delete;
+                    Scope& operator=(const Scope&) = delete;
+
+                private:
+                    CPUExecutor* m_previous;
+                    Eigen::ThreadPoolDevice* m_previous_device;
+                    int m_previous_omp_thread_count;
+                };
+
+            private:
+                struct Arena;
+                struct InterOpThreads;
+
+                CPUExecutor(size_t thread_count,
+                            const std::vector<int>& affinity,
+                            bool limit_runtimes);
+
+                size_t m_thread_count;
+                std::vector<int> m_affinity;
+                int m_numa_node;
+                // The default executor must not change the OpenMP and TBB defaults
+                bool m_limit_runtimes;
+                std::unique_ptr<Eigen::ThreadPoolInterface> m_pool;
+                // m_devices[i] splits work for i + 1 threads
+                std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_devices;
+                std::unique_ptr<Arena> m_arena;
+                std::unique_ptr<InterOpThreads> m_inter_op_threads;
+            };
+        }
+    }
+}
@@ -14,9 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cctype>
 #include <cstdlib>
 #include <fstream>
+#include <list>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -100,6 +105,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
@@ -124,6 +130,7 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
@@ -134,6 +141,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -149,6 +157,10 @@ using namespace ngraph;
 
 static const string s_output_dir = "cpu_codegen";
 
+// Functions with fewer ops than this per available compiler thread are emitted as a single
+// module, since every extra module pays for loading the precompiled header
+static const size_t s_min_ops_per_module = 16;
+
 static void
     generate_isnan_isinf_check(codegen::CodeWriter& writer,
                                std::shared_ptr<Node> node,
@@ -204,6 +216,200 @@ static string emit_string_array(const vector<string>& s, size_t max_line_length)
 
 static StaticInitializers s_static_initializers;
 
+// Non-destructive in-place outputs that Liveness turned into views of a parameter, constant or
+// result. They have no buffer of their own and read through the storage of their input.
+static vector<pair<descriptor::Tensor*, descriptor::Tensor*>>
+    get_persistent_views(const shared_ptr<Node>& node)
+{
+    vector<pair<descriptor::Tensor*, descriptor::Tensor*>> views;
+    auto op = dynamic_pointer_cast<ngraph::op::Op>(node);
+    if (!op || !op->get_op_annotations())
+    {
+        return views;
+    }
+    for (const auto& oi : op->get_op_annotations()->get_in_place_oi_pairs())
+    {
+        descriptor::Tensor* output = &node->get_output_tensor(oi.output);
+        if (!oi.destructive && node->liveness_new_list.count(output) == 0)
+        {
+            views.emplace_back(output, &node->get_inputs().at(oi.input).get_tensor());
+        }
+    }
+    return views;
+}
+
+// Pairs of temporaries whose pool buffers overlap, the one allocated first to the left. Memory
+// sharing only places a tensor over buffers of tensors that are dead by then. Only the last
+// earlier occupant of each byte range a tensor is placed over is paired with it; ordering the
+// tensor after those orders it after every earlier occupant of its range transitively, since
+// they in turn were paired with their own predecessors.
+static vector<pair<descriptor::Tensor*, descriptor::Tensor*>>
+    find_overlapping_temporaries(const list<shared_ptr<Node>>& ordered_ops)
+{
+    vector<pair<descriptor::Tensor*, descriptor::Tensor*>> overlapping;
+    // The current occupant of each byte range of the pool, by the offset the range begins at
+    map<size_t, pair<size_t, descriptor::Tensor*>> occupants;
+    for (const shared_ptr<Node>& node : ordered_ops)
+    {
+        // The tensors allocated by one node are live together, so none overlaps another
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            size_t begin = tensor->get_pool_offset();
+            size_t end = begin + tensor->get_allocated_size();
+            if (end <= begin)
+            {
+                continue;
+            }
+
+            auto it = occupants.upper_bound(begin);
+            if (it != occupants.begin() && prev(it)->second.first > begin)
+            {
+                --it;
+            }
+            size_t first_pair = overlapping.size();
+            while (it != occupants.end() && it->first < end)
+            {
+                size_t range_begin = it->first;
+                size_t range_end = it->second.first;
+                descriptor::Tensor* occupant = it->second.second;
+                it = occupants.erase(it);
+                // Keep the parts of the range outside the new tensor
+                if (range_begin < begin)
+                {
+                    occupants.emplace(range_begin, make_pair(begin, occupant));
+                }
+                if (range_end > end)
+                {
+                    it = occupants.emplace(end, make_pair(range_end, occupant)).first;
+                }
+                overlapping.emplace_back(occupant, tensor);
+            }
+            occupants.emplace(begin, make_pair(end, tensor));
+
+            // Ranges split by earlier tensors may belong to the same occupant
+            sort(overlapping.begin() + first_pair, overlapping.end());
+            overlapping.erase(unique(overlapping.begin() + first_pair, overlapping.end()),
+                              overlapping.end());
+        }
+    }
+    return overlapping;
+}
+
+// For each op, the positions in ordered_ops of the ops it waits for when ops run concurrently:
+// the producers of its arguments and, when it reuses a pool buffer, every op that produced or
+// read the tensors that had the buffer immediately before it
+static vector<set<size_t>> find_dependencies(
+    const list<shared_ptr<Node>>& ordered_ops,
+    const vector<pair<descriptor::Tensor*, descriptor::Tensor*>>& overlapping_temporaries)
+{
+    unordered_map<const Node*, size_t> positions;
+    unordered_map<const descriptor::Tensor*, size_t> producers;
+    unordered_map<const descriptor::Tensor*, vector<size_t>> users;
+    size_t position = 0;
+    for (const shared_ptr<Node>& node : ordered_ops)
+    {
+        positions[node.get()] = position;
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            producers[&output.get_tensor()] = position;
+        }
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            users[&input.get_output().get_tensor()].push_back(position);
+        }
+        position++;
+    }
+
+    vector<set<size_t>> dependencies(ordered_ops.size());
+    position = 0;
+    for (const shared_ptr<Node>& node : ordered_ops)
+    {
+        for (const shared_ptr<Node>& arg : node->get_arguments())
+        {
+            dependencies[position].insert(positions.at(arg.get()));
+        }
+        position++;
+    }
+    for (const auto& overlap : overlapping_temporaries)
+    {
+        size_t reuser = producers.at(overlap.second);
+        size_t producer = producers.at(overlap.first);
+        if (producer != reuser)
+        {
+            dependencies[reuser].insert(producer);
+        }
+        for (size_t user : users[overlap.first])
+        {
+            if (user != reuser)
+            {
+                dependencies[reuser].insert(user);
+            }
+        }
+    }
+    return dependencies;
+}
+
+// Replaces the names in the generated source. Identifiers derived from a name, such as tensor
+// names or the functions emitted for an op, begin or end with it at an underscore, so names
+// are matched on the underscore-separated parts of each identifier, longest first.
+static string rename_identifiers(const string& source, const unordered_map<string, string>& names)
+{
+    string result;
+    result.reserve(source.size());
+    auto is_identifier_char = [](char c) {
+        return isalnum(static_cast<unsigned char>(c)) || c == '_';
+    };
+    size_t i = 0;
+    while (i < source.size())
+    {
+        if (!is_identifier_char(source[i]))
+        {
+            result += source[i++];
+            continue;
+        }
+        size_t end = i;
+        while (end < source.size() && is_identifier_char(source[end]))
+        {
+            end++;
+        }
+        if (isdigit(static_cast<unsigned char>(source[i])))
+        {
+            result.append(source, i, end - i);
+            i = end;
+            continue;
+        }
+        size_t pos = i;
+        while (pos < end)
+        {
+            bool renamed = false;
+            if (pos == i || source[pos - 1] == '_')
+            {
+                for (size_t part_end = end; part_end > pos; part_end--)
+                {
+                    if (part_end != end && source[part_end] != '_')
+                    {
+                        continue;
+                    }
+                    auto it = names.find(source.substr(pos, part_end - pos));
+                    if (it != names.end())
+                    {
+                        result += it->second;
+                        pos = part_end;
+                        renamed = true;
+                        break;
+                    }
+                }
+            }
+            if (!renamed)
+            {
+                result += source[pos++];
+            }
+        }
+        i = end;
+    }
+    return result;
+}
+
 #define TI(x) type_index(typeid(x))
 
 static const runtime::cpu::OpMap dispatcher{
@@ -300,6 +506,7 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::SigmoidMultiply), &runtime::cpu::CPU_Emitter::emit<op::SigmoidMultiply>},
     {TI(ngraph::op::SigmoidMultiplyBackprop),
      &runtime::cpu::CPU_Emitter::emit<op::SigmoidMultiplyBackprop>},
+    {TI(ngraph::op::LoopKernel), &runtime::cpu::CPU_Emitter::emit<op::LoopKernel>},
     {TI(ngraph::op::Softmax), &runtime::cpu::CPU_Emitter::emit<op::Softmax>},
     {TI(ngraph::op::SigmoidBackprop), &runtime::cpu::CPU_Emitter::emit<op::SigmoidBackprop>},
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
@@ -315,8 +522,15 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_release_function(release_function)
     , m_is_compiled(false)
     , m_compiled_function(nullptr)
+    , m_tensor_enable_count(0)
     , m_emit_timing(false)
-    , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr &&
+                std::getenv("NGRAPH_CPU_USE_TASK_GRAPH") == nullptr)
+    , m_use_task_graph(std::getenv("NGRAPH_CPU_USE_TASK_GRAPH") != nullptr)
+    , m_disable_memory_sharing(std::getenv("NGRAPH_CPU_DISABLE_MEMORY_SHARING") != nullptr)
+    , m_memory_planning(std::getenv("NGRAPH_CPU_OFFLINE_MEMORY_PLANNING") != nullptr
+                            ? ngraph::pass::MemoryLayout::planning_scheme::OFFLINE
+                            : ngraph::pass::MemoryLayout::planning_scheme::ONLINE)
     , m_function_name(function->get_name())
     , m_is_built(false)
     , m_direct_execution(std::getenv("NGRAPH_DEX") != nullptr)
@@ -349,7 +563,9 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
@@ -358,7 +574,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        s_memory_pool_alignment, m_disable_memory_sharing, m_memory_planning);
     pass_manager.run_passes(m_function);
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
@@ -375,8 +592,10 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/except.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_eigen_utils.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/cpu_task_graph.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
@@ -485,7 +704,10 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant addresses are bound after the module is loaded rather than embedded in the
+    // source so that the compiled module can be reused by other processes
     writer << "// Declare all constants\n";
+    codegen::CodeWriter constant_binder;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
@@ -493,15 +715,22 @@ using namespace ngraph::runtime;
             const ngraph::op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
             if (c)
             {
-                m_active_constants.push_back(node);
                 shared_ptr<descriptor::TensorView> tv = node->get_outputs()[0].get_tensor_view();
                 string type = tv->get_tensor().get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_tensor().get_name() << " = (("
-                       << type << "*)(" << c->get_data_ptr() << "));\n";
+                writer << "static " << type << "* " << tv->get_tensor().get_name()
+                       << " = nullptr;\n";
+                constant_binder << tv->get_tensor().get_name() << " = static_cast<" << type
+                                << "*>(constants[" << m_active_constants.size() << "]);\n";
+                m_active_constants.push_back(node);
                 m_variable_name_map[tv->get_tensor().get_name()] = tv->get_tensor().get_name();
             }
         }
     }
+    writer << "\nextern \"C\" void " << m_function_name << "_bind_constants(void** constants)\n";
+    writer.block_begin();
+    writer << constant_binder.get_code();
+    writer.block_end();
+    writer << "\n";
 
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
@@ -511,10 +740,38 @@ using namespace ngraph::runtime;
     }
     writer << "\n";
 
+    m_compiler.reset(new codegen::Compiler());
+
+    // Large functions are compiled in parallel. Every op is then emitted as a function of its
+    // own, and those functions are spread over several modules next to the main one
+    size_t op_count = 0;
+    for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+    {
+        for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+        {
+            if (!node->is_parameter() && !node->is_constant())
+            {
+                op_count++;
+            }
+        }
+    }
+    size_t op_module_count =
+        std::min(m_compiler->get_thread_count(), op_count / s_min_ops_per_module);
+    bool split_module = op_module_count > 1;
+
     // This for loop creates a collection of functions that are called more than once
     // and emitting them as globally callable functions.
     // ops implement the is_functionally_identical method
     unordered_map<Node*, string> match_functions;
+    vector<string> op_functions;
+    vector<string> op_declarations;
+    auto add_op_function = [&](const Node& node, const string& function_name) {
+        op_functions.push_back(emit_op_as_function(node, function_name, !split_module));
+        if (split_module)
+        {
+            op_declarations.push_back(emit_op_function_declaration(node, function_name));
+        }
+    };
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         list<shared_ptr<Node>> tmp = function_ordered_ops.at(current_function);
@@ -569,11 +826,69 @@ using namespace ngraph::runtime;
             }
             if (!match_function_name.empty())
             {
-                writer << emit_op_as_function(*op_list[i], match_function_name);
+                add_op_function(*op_list[i], match_function_name);
+            }
+        }
+        if (split_module)
+        {
+            for (shared_ptr<Node>& op : op_list)
+            {
+                if (!op->is_constant() && !op->is_parameter() &&
+                    !contains_key(match_functions, op.get()))
+                {
+                    string function_name = "func_" + op->get_name();
+                    match_functions.insert({op.get(), function_name});
+                    add_op_function(*op, function_name);
+                }
             }
         }
     }
 
+    vector<string> module_sources;
+    if (split_module)
+    {
+        codegen::CodeWriter module_prologue;
+        module_prologue << pch_header_source;
+        for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
+        {
+            module_prologue << "extern \"C\" void " << f->get_name()
+                            << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx);\n";
+        }
+        module_prologue << "\n";
+        module_sources.assign(op_module_count, module_prologue.get_code());
+
+        // Balance the modules by source size, placing the largest functions first. The
+        // placement only depends on the emitted code so unchanged modules hit the codegen cache
+        vector<size_t> order(op_functions.size());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&op_functions](size_t a, size_t b) {
+            return op_functions[a].size() > op_functions[b].size();
+        });
+        for (size_t index : order)
+        {
+            auto smallest = min_element(module_sources.begin(),
+                                        module_sources.end(),
+                                        [](const string& a, const string& b) {
+                                            return a.size() < b.size();
+                                        });
+            *smallest += op_functions[index];
+        }
+
+        // The main module only needs the declarations
+        for (const string& op_declaration : op_declarations)
+        {
+            writer << op_declaration;
+        }
+    }
+    else
+    {
+        for (const string& op_function : op_functions)
+        {
+            writer << op_function;
+        }
+    }
+
+    codegen::CodeWriter task_graph_binder;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         auto ordered_ops = function_ordered_ops.at(current_function);
@@ -602,13 +917,28 @@ using namespace ngraph::runtime;
                 temporaries_used = true;
                 for (descriptor::Tensor* tensor : node->liveness_new_list)
                 {
-                    worst_case_tmp_size += tensor->size();
+                    worst_case_tmp_size += ngraph::pass::MemoryManager::align(
+                        tensor->get_allocated_size(), s_memory_pool_alignment);
                 }
             }
         }
         if (temporaries_used)
         {
             m_memory_buffer_sizes.push_back(current_function->get_temporary_pool_size());
+            NGRAPH_DEBUG << current_function->get_name() << " temporary pool: "
+                         << current_function->get_temporary_pool_size() << " bytes, "
+                         << worst_case_tmp_size << " without memory sharing";
+        }
+
+        // A buffer holds its tensor only until a later tensor reuses it. Nodes writing such
+        // buffers can't be skipped on the strength of the previous call, and with TBB the
+        // node reusing a buffer has to wait for every node that touched the earlier tensor.
+        auto overlapping_temporaries = find_overlapping_temporaries(ordered_ops);
+        unordered_set<const descriptor::Tensor*> shared_temporaries;
+        for (const auto& overlap : overlapping_temporaries)
+        {
+            shared_temporaries.insert(overlap.first);
+            shared_temporaries.insert(overlap.second);
         }
 
         // Indexing for Control Flags
@@ -628,8 +958,22 @@ using namespace ngraph::runtime;
             }
         }
 
-        writer << "bool " << current_function->get_name() << "_t_en[" << tensor_index << "];\n";
-        writer << "bool " << current_function->get_name() << "_init = true;\n";
+        // Control flags live in the runtime context so that concurrent calls on
+        // different contexts don't share them
+        size_t tensor_enable_offset = m_tensor_enable_count;
+        m_tensor_enable_count += tensor_index;
+
+        // The task graph is built once here and bound to the module after it is loaded, the
+        // calls only run it
+        TaskGraph task_graph;
+        codegen::CodeWriter task_writer;
+        if (m_use_task_graph)
+        {
+            writer << "static const cpu::TaskGraph* " << current_function->get_name()
+                   << "_task_graph = nullptr;\n\n";
+            task_graph_binder << current_function->get_name() << "_task_graph = task_graphs["
+                              << m_task_graphs.size() << "];\n";
+        }
 
         writer << "extern \"C\" void " << current_function->get_name();
         writer << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx)\n";
@@ -668,7 +1012,7 @@ using namespace ngraph::runtime;
             }
         }
 
-        writer << "bool* t_en = (bool*)" << current_function->get_name() << "_t_en;\n";
+        writer << "bool* t_en = ctx->t_en + " << tensor_enable_offset << ";\n";
 
         // Add inputs to the variable name map
         size_t arg_index = 0;
@@ -710,6 +1054,11 @@ using namespace ngraph::runtime;
 
         for (shared_ptr<Node> node : ordered_ops)
         {
+            // With a task graph the ops are the cases of a switch on the task index, which is
+            // emitted after them
+            codegen::CodeWriter& node_writer =
+                m_use_task_graph && !node->is_parameter() && !node->is_constant() ? task_writer
+                                                                                   : writer;
             auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
             // with shared pointers, which is fine here but clang doesn't like it.)
             auto handler = dispatcher.find(type_index(typeid(n)));
@@ -728,6 +1077,15 @@ using namespace ngraph::runtime;
                     TensorViewWrapper(tv, m_variable_name_map[tv->get_tensor().get_name()]));
                 node_input_names.emplace_back(tv->get_tensor().get_name());
             }
+            for (const auto& view : get_persistent_views(node))
+            {
+                // Unless the view is itself computed into an output
+                if (m_variable_name_map.count(view.first->get_name()) == 0)
+                {
+                    m_variable_name_map[view.first->get_name()] =
+                        m_variable_name_map[view.second->get_name()];
+                }
+            }
             vector<TensorViewWrapper> out;
             for (const descriptor::Output& output : node->get_outputs())
             {
@@ -747,39 +1105,47 @@ using namespace ngraph::runtime;
                 }
                 if (m_use_tbb)
                 {
-                    writer << "tbb::flow::continue_node<tbb::flow::continue_msg> "
-                              "flowgraph_node_"
-                           << node->get_name()
-                           << "(G, [&](const tbb::flow::continue_msg &msg)\n{\n";
-                    writer.indent++;
+                    node_writer << "tbb::flow::continue_node<tbb::flow::continue_msg> "
+                                   "flowgraph_node_"
+                                << node->get_name()
+                                << "(G, [&](const tbb::flow::continue_msg &msg)\n{\n";
+                    node_writer.indent++;
+                    // Flow graph nodes run on TBB threads, which need the caller's executor
+                    node_writer << "cpu::CPUExecutor::Scope executor_scope(*ctx->executor);\n";
+                }
+                if (m_use_task_graph)
+                {
+                    node_writer << "case " << task_graph.add_task(TaskGraph::estimate_cost(*node))
+                                << ":\n{\n";
+                    node_writer.indent++;
                 }
                 if (runtime::cpu::IsTracingEnabled() &&
                     current_function->get_name() == m_function_name)
                 {
-                    writer << "start_ts = cpu::Clock::now();\n";
+                    node_writer << "start_ts = cpu::Clock::now();\n";
                 }
             }
 
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "\n// " << node->get_name() << "(";
+                node_writer << "\n// " << node->get_name() << "(";
                 vector<string> parameter_nodes = node_input_names;
                 parameter_nodes.insert(
                     parameter_nodes.end(), node_output_names.begin(), node_output_names.end());
-                writer << join(parameter_nodes);
-                writer << ")\n";
+                node_writer << join(parameter_nodes);
+                node_writer << ")\n";
             }
 
             // Emit operation body
             if (!node->is_parameter() && !node->is_constant())
             {
-                emit_debug_function_entry(writer, node.get(), in, out);
+                emit_debug_function_entry(node_writer, node.get(), in, out);
             }
 
             // Op Control
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "if (" << current_function->get_name() << "_init ";
+                node_writer << "if (ctx->first_iteration ";
                 for (const descriptor::Input& input : node->get_inputs())
                 {
                     const descriptor::Output& output = input.get_output();
@@ -788,11 +1154,11 @@ using namespace ngraph::runtime;
 
                     if (output.get_node()->is_parameter())
                     {
-                        writer << " || ctx->p_en[" << param_index_map[input_name] << "]";
+                        node_writer << " || ctx->p_en[" << param_index_map[input_name] << "]";
                     }
                     else if (!output.get_node()->is_constant())
                     {
-                        writer << " || t_en[" << tensor_index_map[input_name] << "]";
+                        node_writer << " || t_en[" << tensor_index_map[input_name] << "]";
                     }
                 }
 
@@ -816,20 +1182,30 @@ using namespace ngraph::runtime;
                     }
                     return false;
                 };
-                // Always enable nodes computing output tensors
-                if (computes_output())
+                auto writes_shared_temporary = [&]() {
+                    for (const descriptor::Output& output : node->get_outputs())
+                    {
+                        if (shared_temporaries.count(&output.get_tensor()) != 0)
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                };
+                // Always enable nodes computing output tensors or shared temporaries
+                if (computes_output() || writes_shared_temporary())
                 {
-                    writer << " || 1";
+                    node_writer << " || 1";
                 }
-                writer << ") {\n";
-                writer.indent++;
+                node_writer << ") {\n";
+                node_writer.indent++;
             }
 
             string func_name;
             auto it = match_functions.find(node.get());
             if (it == match_functions.end())
             {
-                handler->second(this, writer, node.get(), in, out);
+                handler->second(this, node_writer, node.get(), in, out);
             }
             else
             {
@@ -843,7 +1219,7 @@ using namespace ngraph::runtime;
                 {
                     names.push_back(tv.get_name());
                 }
-                writer << func_name << "(" << join(names) << ", ctx);\n";
+                node_writer << func_name << "(" << join(names) << ", ctx);\n";
             }
 
             //skip multi-output nodes since they would be covered by GetOutputElement
@@ -858,12 +1234,12 @@ using namespace ngraph::runtime;
                 {
                     if (std::getenv("NGRAPH_CPU_NAN_CHECK"))
                     {
-                        generate_isnan_isinf_check(writer, node, out, "std::isnan");
+                        generate_isnan_isinf_check(node_writer, node, out, "std::isnan");
                     }
 
                     if (std::getenv("NGRAPH_CPU_INF_CHECK"))
                     {
-                        generate_isnan_isinf_check(writer, node, out, "std::isinf");
+                        generate_isnan_isinf_check(node_writer, node, out, "std::isinf");
                     }
                 }
             }
@@ -873,64 +1249,108 @@ using namespace ngraph::runtime;
             {
                 for (auto output_name : node_output_names)
                 {
-                    writer << "t_en[" << tensor_index_map[output_name] << "] = true;\n";
+                    node_writer << "t_en[" << tensor_index_map[output_name] << "] = true;\n";
                 }
-                writer.indent--;
-                writer << "} else {\n";
-                writer.indent++;
+                node_writer.indent--;
+                node_writer << "} else {\n";
+                node_writer.indent++;
                 for (auto output_name : node_output_names)
                 {
-                    writer << "t_en[" << tensor_index_map[output_name] << "] = false;\n";
+                    node_writer << "t_en[" << tensor_index_map[output_name] << "] = false;\n";
                 }
-                writer.indent--;
-                writer << "}\n";
-                emit_debug_function_exit(writer, node.get(), in, out);
+                node_writer.indent--;
+                node_writer << "}\n";
+                emit_debug_function_exit(node_writer, node.get(), in, out);
                 if (runtime::cpu::IsTracingEnabled() &&
                     current_function->get_name() == m_function_name)
                 {
-                    writer << "ctx->op_durations[profiler_count++] = "
-                           << "(std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() - "
-                              "start_ts)).count();\n";
+                    node_writer
+                        << "ctx->op_durations[profiler_count++] = "
+                        << "(std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() - "
+                           "start_ts)).count();\n";
                 }
                 if (m_use_tbb)
                 {
-                    writer.indent--;
-                    writer << "});\n";
+                    node_writer.indent--;
+                    node_writer << "});\n";
+                }
+                if (m_use_task_graph)
+                {
+                    node_writer << "break;\n";
+                    node_writer.indent--;
+                    node_writer << "}\n";
                 }
             }
         }
 
-        if (m_use_tbb)
+        if (m_use_tbb || m_use_task_graph)
         {
             writer << "\n";
+            // Tasks were added for the ops other than parameters and constants, in order
+            vector<Node*> ops;
+            vector<size_t> task_indices;
+            size_t task_count = 0;
+            for (shared_ptr<Node> node : ordered_ops)
+            {
+                ops.push_back(node.get());
+                task_indices.push_back(task_count);
+                if (!node->is_parameter() && !node->is_constant())
+                {
+                    task_count++;
+                }
+            }
+
             // Build the flow graph
             vector<Node*> dependence_graph_heads;
-
-            traverse_nodes(
-                current_function, [&writer, &dependence_graph_heads](shared_ptr<Node> n) {
-                    if (!n->is_parameter() && !n->is_constant())
+            auto dependencies = find_dependencies(ordered_ops, overlapping_temporaries);
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                Node* n = ops[i];
+                if (n->is_parameter() || n->is_constant())
+                {
+                    continue;
+                }
+                bool is_head = true;
+                for (size_t dependency : dependencies[i])
+                {
+                    Node* arg = ops[dependency];
+                    if (arg->is_parameter() || arg->is_constant())
                     {
-                        bool is_head = true;
-                        for (auto arg : n->get_arguments())
-                        {
-                            if (!arg->is_parameter() && !arg->is_constant())
-                            {
-                                is_head = false;
-                                writer << "tbb::flow::make_edge(flowgraph_node_" << arg->get_name()
-                                       << ", flowgraph_node_" << n->get_name() << ");\n";
-                            }
-                        }
-                        if (is_head)
-                        {
-                            dependence_graph_heads.emplace_back(n.get());
-                        }
+                        continue;
+                    }
+                    is_head = false;
+                    if (m_use_tbb)
+                    {
+                        writer << "tbb::flow::make_edge(flowgraph_node_" << arg->get_name()
+                               << ", flowgraph_node_" << n->get_name() << ");\n";
                     }
-                });
+                    else
+                    {
+                        task_graph.add_edge(task_indices[dependency], task_indices[i]);
+                    }
+                }
+                if (is_head)
+                {
+                    dependence_graph_heads.emplace_back(n);
+                }
+            }
 
             writer << "\n";
 
             // Execute the flow graph
-            if (!dependence_graph_heads.empty())
+            if (m_use_task_graph)
+            {
+                writer << current_function->get_name()
+                       << "_task_graph->run(*ctx->executor, [&](size_t task)\n{\n";
+                writer.indent++;
+                writer << "switch (task)\n{\n";
+                writer << task_writer.get_code();
+                writer << "}\n";
+                writer.indent--;
+                writer << "});\n";
+                m_task_graphs.push_back(move(task_graph));
+            }
+            else if (!dependence_graph_heads.empty())
             {
                 for (Node* n : dependence_graph_heads)
                 {
@@ -940,41 +1360,115 @@ using namespace ngraph::runtime;
                 writer << "try { G.wait_for_all(); } catch(...) { throw; }\n";
             }
         }
-        writer << current_function->get_name() << "_init = false;\n";
+        if (current_function->get_name() == m_function_name)
+        {
+            writer << "ctx->first_iteration = false;\n";
+        }
 
         writer.indent--;
         // End generated function
         writer += "}\n\n";
     }
 
+    if (m_use_task_graph)
+    {
+        writer << "extern \"C\" void " << m_function_name
+               << "_bind_task_graphs(const cpu::TaskGraph** task_graphs)\n";
+        writer.block_begin();
+        writer << task_graph_binder.get_code();
+        writer.block_end();
+        writer << "\n";
+    }
+
+    // Node and function names come from process-wide counters. They are replaced by names
+    // numbered in emission order so that the same graph generates the same source, and hits
+    // the codegen cache, however many graphs were built before it
+    unordered_map<string, string> canonical_names;
+    size_t function_index = 0;
+    size_t node_index = 0;
+    for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+    {
+        canonical_names[current_function->get_name()] = "Function_c" + to_string(function_index++);
+        for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+        {
+            string canonical_name = node->description() + "_c" + to_string(node_index++);
+            canonical_names[node->get_name()] = canonical_name;
+            m_original_names[canonical_name] = node->get_name();
+        }
+    }
+    string entry_name = canonical_names.at(m_function_name);
+    for (string& module_source : module_sources)
+    {
+        module_source = rename_identifiers(module_source, canonical_names);
+    }
+
     // TODO: Cleanup and make this a utility function
     file_util::make_directory(s_output_dir);
     string filename = file_util::path_join(s_output_dir, m_function_name + "_codegen.cpp");
     ofstream out(filename);
-    string code = writer.get_code();
+    string code = rename_identifiers(writer.get_code(), canonical_names);
     out << code;
     out.close();
+    for (size_t i = 0; i < module_sources.size(); ++i)
+    {
+        ofstream module_out(file_util::path_join(
+            s_output_dir, m_function_name + "_codegen_" + to_string(i) + ".cpp"));
+        module_out << module_sources[i];
+    }
 
-    m_compiler.reset(new codegen::Compiler());
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
+    module_sources.insert(module_sources.begin(), code);
+    auto codegen_modules = m_compiler->compile_modules(module_sources);
 
-    if (codegen_module == nullptr)
+    for (auto& codegen_module : codegen_modules)
     {
-        throw runtime_error("function failed to compile");
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
-    m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(m_function_name);
+    m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(entry_name);
 
     if (m_compiled_function == nullptr)
     {
         throw runtime_error("could not find compiled function");
     }
 
+    auto bind_constants =
+        m_execution_engine->find_function<void(void**)>(entry_name + "_bind_constants");
+    if (bind_constants == nullptr)
+    {
+        throw runtime_error("could not find compiled constant binder");
+    }
+    vector<void*> constants;
+    for (auto& node : m_active_constants)
+    {
+        auto c = static_pointer_cast<ngraph::op::Constant>(node);
+        constants.push_back(const_cast<void*>(c->get_data_ptr()));
+    }
+    bind_constants(constants.data());
+
+    if (m_use_task_graph)
+    {
+        auto bind_task_graphs = m_execution_engine->find_function<void(const TaskGraph**)>(
+            entry_name + "_bind_task_graphs");
+        if (bind_task_graphs == nullptr)
+        {
+            throw runtime_error("could not find compiled task graph binder");
+        }
+        vector<const TaskGraph*> task_graphs;
+        for (const TaskGraph& task_graph : m_task_graphs)
+        {
+            task_graphs.push_back(&task_graph);
+        }
+        bind_task_graphs(task_graphs.data());
+    }
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1039,6 +1533,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
@@ -1048,7 +1543,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        s_memory_pool_alignment, m_disable_memory_sharing, m_memory_planning);
     pass_manager.run_passes(m_function);
 
     // Store layouts assigned for arguments
@@ -1088,6 +1584,11 @@ void runtime::cpu::CPU_ExternalFunction::build()
     }
 
     // Build executor
+    // Inputs, outputs and intermediates are resolved by name here and turned into slot
+    // lists once the functors exist so that calls never touch the string-keyed maps
+    unordered_map<string, size_t> function_input_names, function_output_names,
+        intermediate_names;
+
     // Inputs
     size_t arg_index = 0;
     for (auto& param : m_function->get_parameters())
@@ -1095,7 +1596,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::TensorView> tv = param->get_output_tensor_view(i);
-            function_input_index[tv->get_tensor().get_name()] = arg_index;
+            function_input_names[tv->get_tensor().get_name()] = arg_index;
             arg_index++;
         }
     }
@@ -1105,14 +1606,14 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::TensorView> tv = op->get_output_tensor_view();
-        function_output_index[tv->get_tensor().get_name()] = i;
+        function_output_names[tv->get_tensor().get_name()] = i;
 
         auto res = std::dynamic_pointer_cast<ngraph::op::Result>(op);
         if (!res->needs_copy())
         {
             shared_ptr<descriptor::TensorView> itv =
                 res->get_inputs().at(0).get_output().get_tensor_view();
-            function_output_index[itv->get_tensor().get_name()] = i;
+            function_output_names[itv->get_tensor().get_name()] = i;
         }
     }
 
@@ -1125,11 +1626,19 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             for (auto tensor : node->liveness_new_list)
             {
-                intermediates_offsets[tensor->get_name()] = tensor->get_pool_offset();
+                intermediate_names[tensor->get_name()] = tensor->get_pool_offset();
             }
         }
     }
 
+    // Every tensor the functors can refer to is the output of an op
+    size_t tensor_count = 0;
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        tensor_count += node->get_output_size();
+    }
+    tensor_data.reset(tensor_count);
+
     // Constants
     for (auto& node : m_function->get_ordered_ops())
     {
@@ -1141,10 +1650,23 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
-    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    vector<pair<string, string>> view_names;
+    // The range of functors built for each op
+    vector<pair<size_t, size_t>> op_functors;
+    list<shared_ptr<Node>> ordered_ops = m_function->get_ordered_ops();
+    for (shared_ptr<Node> node : ordered_ops)
     {
+        for (const auto& view : get_persistent_views(node))
+        {
+            if (function_output_names.count(view.first->get_name()) == 0)
+            {
+                view_names.emplace_back(view.first->get_name(), view.second->get_name());
+            }
+        }
+
         auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
         // with shared pointers, which is fine here but clang doesn't like it.)
+        auto& build_dispatcher = runtime::cpu::get_global_build_dispatcher();
         auto handler = build_dispatcher.find(type_index(typeid(n)));
         if (handler == build_dispatcher.end())
         {
@@ -1164,24 +1686,89 @@ void runtime::cpu::CPU_ExternalFunction::build()
             out.push_back(TensorViewWrapper(tv, tv->get_tensor().get_name()));
         }
 
+        size_t first_functor = functors.size();
         handler->second(this, node.get(), in, out);
+        op_functors.emplace_back(first_functor, functors.size());
     }
 
-    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        for (auto& p : intermediates_offsets)
+    if (m_use_task_graph)
+    {
+        // Ops without functors, such as views, pass the tasks they wait for on to their users
+        auto dependencies =
+            find_dependencies(ordered_ops, find_overlapping_temporaries(ordered_ops));
+        vector<set<size_t>> op_tasks(op_functors.size());
+        size_t position = 0;
+        for (shared_ptr<Node> node : ordered_ops)
         {
-            tensor_data[p.first] =
-                static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+            set<size_t> predecessors;
+            for (size_t dependency : dependencies[position])
+            {
+                predecessors.insert(op_tasks[dependency].begin(), op_tasks[dependency].end());
+            }
+            if (op_functors[position].first == op_functors[position].second)
+            {
+                op_tasks[position] = move(predecessors);
+            }
+            else
+            {
+                size_t task = m_task_graph.add_task(TaskGraph::estimate_cost(*node));
+                m_task_functors.push_back(op_functors[position]);
+                for (size_t predecessor : predecessors)
+                {
+                    m_task_graph.add_edge(predecessor, task);
+                }
+                op_tasks[position] = {task};
+            }
+            position++;
         }
+    }
 
+    for (const auto& p : intermediate_names)
+    {
+        intermediates_offsets.emplace_back(tensor_data.get_index(p.first), p.second);
+    }
+    for (const auto& p : function_input_names)
+    {
+        function_input_index.emplace_back(tensor_data.get_index(p.first), p.second);
+    }
+    for (const auto& p : function_output_names)
+    {
+        function_output_index.emplace_back(tensor_data.get_index(p.first), p.second);
+    }
+    for (const auto& p : view_names)
+    {
+        persistent_views.emplace_back(tensor_data.get_index(p.first),
+                                      tensor_data.get_index(p.second));
+    }
+
+    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
+        void** slots = tensor_data.data();
         for (const auto& p : function_input_index)
         {
-            tensor_data[p.first] = inputs[p.second];
+            slots[p.first] = inputs[p.second];
         }
 
         for (const auto& p : function_output_index)
         {
-            tensor_data[p.first] = outputs[p.second];
+            slots[p.first] = outputs[p.second];
+        }
+
+        // In order, so that views of views resolve
+        for (const auto& p : persistent_views)
+        {
+            slots[p.first] = slots[p.second];
+        }
+
+        if (m_use_task_graph)
+        {
+            m_task_graph.run(*ctx->executor, [&](size_t task) {
+                for (size_t i = m_task_functors[task].first; i < m_task_functors[task].second;
+                     i++)
+                {
+                    functors[i](ctx);
+                }
+            });
+            return;
         }
 
         for (const auto& functor : functors)
@@ -1199,7 +1786,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
 }
 
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
-    runtime::cpu::CPU_ExternalFunction::make_call_frame()
+    runtime::cpu::CPU_ExternalFunction::make_call_frame(size_t max_concurrent_calls)
 {
     if (!m_is_compiled && !m_direct_execution)
     {
@@ -1211,8 +1798,22 @@ shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
         build();
     }
 
-    return make_shared<ngraph::runtime::cpu::CPU_CallFrame>(shared_from_this(),
-                                                            m_compiled_function);
+    return make_shared<ngraph::runtime::cpu::CPU_CallFrame>(
+        shared_from_this(), m_compiled_function, max_concurrent_calls);
+}
+
+void runtime::cpu::CPU_ExternalFunction::bind_intermediates(CPURuntimeContext* ctx)
+{
+    if (intermediates_offsets.empty())
+    {
+        return;
+    }
+    auto base = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr());
+    void** slots = tensor_data.data();
+    for (const auto& p : intermediates_offsets)
+    {
+        slots[p.first] = base + p.second;
+    }
 }
 
 const runtime::cpu::LayoutDescriptorPtrs&
@@ -1257,16 +1858,16 @@ bool runtime::cpu::CPU_ExternalFunction::is_functionally_identical(
     return node_cache.at(&n1) == node_cache.at(&n2);
 }
 
-string runtime::cpu::CPU_ExternalFunction::emit_op_as_function(const Node& node,
-                                                               const string& function_name)
+string runtime::cpu::CPU_ExternalFunction::emit_op_function_signature(
+    const Node& node,
+    const string& function_name,
+    bool is_static,
+    vector<TensorViewWrapper>& in,
+    vector<TensorViewWrapper>& out)
 {
     codegen::CodeWriter writer;
-    writer << "static void " << function_name << "(";
+    writer << (is_static ? "static void " : "void ") << function_name << "(";
     writer.indent++;
-    // Work around a compiler warning (*node inside typeid may have effects
-    // with shared pointers, which is fine here but clang doesn't like it.)
-    auto handler = dispatcher.find(type_index(typeid(node)));
-    vector<TensorViewWrapper> in;
     size_t arg_index = 0;
     set<string> arg_names;
     for (const descriptor::Input& input : node.get_inputs())
@@ -1286,7 +1887,6 @@ string runtime::cpu::CPU_ExternalFunction::emit_op_as_function(const Node& node,
         }
         in.push_back(tvw);
     }
-    vector<TensorViewWrapper> out;
     for (const descriptor::Output& output : node.get_outputs())
     {
         shared_ptr<descriptor::TensorView> tv = output.get_tensor_view();
@@ -1301,8 +1901,30 @@ string runtime::cpu::CPU_ExternalFunction::emit_op_as_function(const Node& node,
     }
     writer << ",\ncpu::CPURuntimeContext* ctx";
     writer.indent--;
-    writer << "\n)\n";
-    writer << "{\n";
+    writer << "\n)";
+    return writer.get_code();
+}
+
+string runtime::cpu::CPU_ExternalFunction::emit_op_function_declaration(
+    const Node& node, const string& function_name)
+{
+    vector<TensorViewWrapper> in;
+    vector<TensorViewWrapper> out;
+    return emit_op_function_signature(node, function_name, false, in, out) + ";\n";
+}
+
+string runtime::cpu::CPU_ExternalFunction::emit_op_as_function(const Node& node,
+                                                               const string& function_name,
+                                                               bool is_static)
+{
+    // Work around a compiler warning (*node inside typeid may have effects
+    // with shared pointers, which is fine here but clang doesn't like it.)
+    auto handler = dispatcher.find(type_index(typeid(node)));
+    vector<TensorViewWrapper> in;
+    vector<TensorViewWrapper> out;
+    codegen::CodeWriter writer;
+    writer << emit_op_function_signature(node, function_name, is_static, in, out);
+    writer << "\n{\n";
     writer.indent++;
     handler->second(this, writer, &node, in, out);
     writer.indent--;
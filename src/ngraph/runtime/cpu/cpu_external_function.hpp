@@ -17,7 +17,6 @@
 #pragma once
 
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
@@ -30,8 +29,11 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_task_graph.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_slots.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
 
@@ -76,7 +78,8 @@ namespace ngraph
                 CPU_ExternalFunction(const std::shared_ptr<ngraph::Function>& function,
                                      bool release_function = true);
                 ~CPU_ExternalFunction();
-                std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> make_call_frame();
+                std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
+                    make_call_frame(size_t max_concurrent_calls = 1);
 
                 const LayoutDescriptorPtrs& get_parameter_layout_descriptors();
                 const LayoutDescriptorPtrs& get_result_layout_descriptors();
@@ -84,6 +87,7 @@ namespace ngraph
                 {
                     return m_memory_buffer_sizes;
                 }
+                size_t get_tensor_enable_count() const { return m_tensor_enable_count; }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
@@ -95,17 +99,26 @@ namespace ngraph
                 // Temporary Memory Pool alignment
                 static const size_t s_memory_pool_alignment;
 
-                std::list<std::function<void(CPURuntimeContext*)>>& get_functors()
+                std::vector<std::function<void(CPURuntimeContext*)>>& get_functors()
                 {
                     return functors;
                 }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
+                TensorSlots& get_tensor_data() { return tensor_data; }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
                     return executor;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                /// \brief Number of the generated modules loaded from the codegen cache
+                size_t get_codegen_cache_hits() const
+                {
+                    return m_compiler ? m_compiler->get_cache_hits() : 0;
+                }
+                bool uses_tbb() const { return m_use_tbb && !m_direct_execution; }
+                /// \brief Points the direct execution intermediates at the temporary pool of
+                ///        ctx. Inputs and outputs are patched by the executor on every call.
+                void bind_intermediates(CPURuntimeContext* ctx);
             protected:
                 void build();
                 void compile();
@@ -128,20 +141,38 @@ namespace ngraph
                     const Node&,
                     const Node&,
                     const std::unordered_map<const Node*, std::string>& node_cache);
-                std::string emit_op_as_function(const Node&, const std::string& function_name);
+                /// The signature of the op function emitted for the node, filling in the
+                /// wrappers of its arguments and results
+                std::string emit_op_function_signature(const Node&,
+                                                       const std::string& function_name,
+                                                       bool is_static,
+                                                       std::vector<TensorViewWrapper>& in,
+                                                       std::vector<TensorViewWrapper>& out);
+                std::string emit_op_function_declaration(const Node&,
+                                                         const std::string& function_name);
+                std::string emit_op_as_function(const Node&,
+                                                const std::string& function_name,
+                                                bool is_static = true);
                 std::string strip_comments(const std::string&);
                 void release_function() { m_function = nullptr; }
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_release_function;
                 bool m_is_compiled;
                 EntryPoint m_compiled_function;
+                size_t m_tensor_enable_count;
                 std::unique_ptr<codegen::Compiler> m_compiler;
                 std::unique_ptr<codegen::ExecutionEngine> m_execution_engine;
                 bool m_emit_timing;
                 bool m_use_tbb;
+                // Run the ops as a task graph so that independent ops run concurrently
+                bool m_use_task_graph;
+                bool m_disable_memory_sharing;
+                ngraph::pass::MemoryLayout::planning_scheme m_memory_planning;
 
                 std::unordered_map<std::string, std::string> m_variable_name_map;
                 std::map<std::string, size_t> m_name_index_map;
+                // The names of the nodes by the names they have in the generated source
+                std::unordered_map<std::string, std::string> m_original_names;
 
                 // Because we are directly accessing the constant data stored in the
                 // Constant ops we need to keep a list of shared_ptr to each Constant
@@ -157,12 +188,20 @@ namespace ngraph
 
                 std::string m_function_name;
 
-                std::list<std::function<void(CPURuntimeContext*)>> functors;
+                std::vector<std::function<void(CPURuntimeContext*)>> functors;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, size_t> intermediates_offsets;
-                std::unordered_map<std::string, size_t> function_input_index, function_output_index;
+                TensorSlots tensor_data;
+                // (tensor_data slot, pool offset or argument index) pairs resolved by build()
+                std::vector<std::pair<size_t, size_t>> intermediates_offsets;
+                std::vector<std::pair<size_t, size_t>> function_input_index, function_output_index;
+                // (view slot, viewed tensor slot) pairs
+                std::vector<std::pair<size_t, size_t>> persistent_views;
+                // The task graph of each generated function, in the order of their binder
+                std::vector<TaskGraph> m_task_graphs;
+                // The direct execution ops with functors, and the range of functors of each
+                TaskGraph m_task_graph;
+                std::vector<std::pair<size_t, size_t>> m_task_functors;
                 bool m_is_built;
                 bool m_direct_execution;
             };
@@ -14,11 +14,40 @@
 * limitations under the License.
 *******************************************************************************/
 #include <algorithm>
+#include <functional>
 #include <map>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 
 #include "ngraph/codegen/code_writer.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/acos.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/asin.hpp"
+#include "ngraph/op/atan.hpp"
+#include "ngraph/op/ceiling.hpp"
+#include "ngraph/op/cos.hpp"
+#include "ngraph/op/cosh.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/floor.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sin.hpp"
+#include "ngraph/op/sinh.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tan.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/runtime/cpu/cpu_kernel_emitters.hpp"
 #include "ngraph/runtime/cpu/cpu_kernel_utils.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -446,3 +475,73 @@ void ngraph::runtime::cpu::kernel::emit_reduce(codegen::CodeWriter& writer,
         close_for_loops(writer, index_vars);
     }
 }
+
+#define TI(x) type_index(typeid(x))
+
+using ElementwiseExpression = function<string(const vector<string>&)>;
+
+static ElementwiseExpression unary_call(const string& name)
+{
+    return [name](const vector<string>& args) { return name + "(" + args[0] + ")"; };
+}
+
+// The expressions match the scalar loops CPU_Emitter generates for the ops themselves
+static const unordered_map<type_index, ElementwiseExpression> s_elementwise_expressions{
+    {TI(ngraph::op::Abs), unary_call("std::abs")},
+    {TI(ngraph::op::Acos), unary_call("acos")},
+    {TI(ngraph::op::Asin), unary_call("asin")},
+    {TI(ngraph::op::Atan), unary_call("atan")},
+    {TI(ngraph::op::Ceiling), unary_call("ceil")},
+    {TI(ngraph::op::Cos), unary_call("cos")},
+    {TI(ngraph::op::Cosh), unary_call("cosh")},
+    {TI(ngraph::op::Exp), unary_call("exp")},
+    {TI(ngraph::op::Floor), unary_call("floor")},
+    {TI(ngraph::op::Log), unary_call("log")},
+    {TI(ngraph::op::Sin), unary_call("sin")},
+    {TI(ngraph::op::Sinh), unary_call("sinh")},
+    {TI(ngraph::op::Sqrt), unary_call("sqrt")},
+    {TI(ngraph::op::Tan), unary_call("tan")},
+    {TI(ngraph::op::Tanh), unary_call("tanh")},
+    {TI(ngraph::op::Negative), [](const vector<string>& args) { return "-" + args[0]; }},
+    {TI(ngraph::op::Relu),
+     [](const vector<string>& args) { return args[0] + " > 0 ? " + args[0] + " : 0"; }},
+    {TI(ngraph::op::Sigmoid),
+     [](const vector<string>& args) { return "1 / (1 + exp(-" + args[0] + "))"; }},
+    {TI(ngraph::op::Add), [](const vector<string>& args) { return args[0] + " + " + args[1]; }},
+    {TI(ngraph::op::Subtract),
+     [](const vector<string>& args) { return args[0] + " - " + args[1]; }},
+    {TI(ngraph::op::Multiply),
+     [](const vector<string>& args) { return args[0] + " * " + args[1]; }},
+    {TI(ngraph::op::Divide), [](const vector<string>& args) { return args[0] + " / " + args[1]; }},
+    {TI(ngraph::op::Maximum),
+     [](const vector<string>& args) {
+         return args[0] + " > " + args[1] + " ? " + args[0] + " : " + args[1];
+     }},
+    {TI(ngraph::op::Minimum),
+     [](const vector<string>& args) {
+         return args[0] + " < " + args[1] + " ? " + args[0] + " : " + args[1];
+     }},
+    {TI(ngraph::op::Power),
+     [](const vector<string>& args) { return "pow(" + args[0] + ", " + args[1] + ")"; }},
+};
+
+bool ngraph::runtime::cpu::kernel::is_elementwise_expression(const Node& node)
+{
+    return s_elementwise_expressions.find(TI(node)) != s_elementwise_expressions.end();
+}
+
+string ngraph::runtime::cpu::kernel::emit_elementwise_expression(const Node& node,
+                                                                 const vector<string>& args)
+{
+    auto it = s_elementwise_expressions.find(TI(node));
+    if (it == s_elementwise_expressions.end())
+    {
+        throw ngraph_error("No elementwise expression for " + node.description());
+    }
+    vector<string> operands;
+    for (const string& arg : args)
+    {
+        operands.push_back("(" + arg + ")");
+    }
+    return it->second(operands);
+}
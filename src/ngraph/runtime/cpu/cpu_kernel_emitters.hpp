@@ -19,6 +19,7 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/codegen/code_writer.hpp"
 #include "ngraph/coordinate.hpp"
+#include "ngraph/node.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -85,6 +86,13 @@ namespace ngraph
                                  const Shape& arg0_shape,
                                  const Shape& out_shape,
                                  const AxisSet& reduction_axes);
+
+                /// \brief Returns true if emit_elementwise_expression supports the op.
+                bool is_elementwise_expression(const Node& node);
+                /// \brief Returns the C++ expression computing one element of an elementwise op,
+                /// given the expressions computing the matching elements of its arguments.
+                std::string emit_elementwise_expression(const Node& node,
+                                                        const std::vector<std::string>& args);
             }
         }
     }
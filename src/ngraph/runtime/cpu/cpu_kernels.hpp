@@ -127,6 +127,7 @@ namespace ngraph
     class Shape;
     class AxisSet;
     class AxisVector;
+    class Strides;
 
     namespace runtime
     {
@@ -186,6 +187,76 @@ namespace ngraph
                                            const Shape& input_shape,
                                            const AxisVector& input_axis_order,
                                            const Shape& output_shape);
+
+                // Rank- and type-generic kernels for the cases the specialized kernels above
+                // do not cover. Templates are explicitly instantiated for every element type.
+
+                void reverse_nd(const void* input,
+                                void* output,
+                                size_t element_size,
+                                const Shape& shape,
+                                const AxisSet& reversed_axes);
+
+                void pad_nd(const void* input,
+                            const void* pad_value,
+                            void* output,
+                            size_t element_size,
+                            const Shape& input_shape,
+                            const Shape& output_shape,
+                            const Shape& padding_below,
+                            const Shape& padding_interior);
+
+                template <typename ElementType>
+                void one_hot_nd(const ElementType* input,
+                                ElementType* output,
+                                const Shape& input_shape,
+                                const Shape& output_shape,
+                                size_t one_hot_axis);
+
+                template <typename ElementType>
+                void dot_nd(const ElementType* arg0,
+                            const ElementType* arg1,
+                            ElementType* output,
+                            const Shape& arg0_shape,
+                            const Shape& arg1_shape,
+                            size_t reduction_axes_count);
+
+                template <typename ElementType>
+                void reduce_product_nd(const ElementType* input,
+                                       ElementType* output,
+                                       const Shape& input_shape,
+                                       const AxisSet& reduction_axes);
+
+                template <typename ElementType>
+                void reduce_max_nd(const ElementType* input,
+                                   ElementType* output,
+                                   const Shape& input_shape,
+                                   const AxisSet& reduction_axes);
+
+                template <typename ElementType>
+                void reduce_min_nd(const ElementType* input,
+                                   ElementType* output,
+                                   const Shape& input_shape,
+                                   const AxisSet& reduction_axes);
+
+                template <typename ElementType>
+                void max_pool_nd(const ElementType* input,
+                                 ElementType* output,
+                                 const Shape& input_shape,
+                                 const Shape& output_shape,
+                                 const Shape& window_shape,
+                                 const Strides& window_movement_strides,
+                                 const Shape& padding_below);
+
+                template <typename ElementType>
+                void avg_pool_nd(const ElementType* input,
+                                 ElementType* output,
+                                 const Shape& input_shape,
+                                 const Shape& output_shape,
+                                 const Shape& window_shape,
+                                 const Strides& window_movement_strides,
+                                 const Shape& padding_below,
+                                 bool include_padding_in_avg_computation);
             }
         }
     }
@@ -18,6 +18,9 @@
 #include <algorithm>
 #include <numeric>
 
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -64,6 +67,36 @@ namespace ngraph
                 std::reverse(strides.begin(), strides.end());
             }
 
+            size_t LayoutDescriptor::get_allocated_size()
+            {
+                size_t allocated_size = TensorViewLayout::get_allocated_size();
+                if (mkldnn_format == mkldnn::memory::format::format_undef ||
+                    mkldnn_format == mkldnn::memory::format::any)
+                {
+                    return allocated_size;
+                }
+
+                // Blocked MKLDNN formats round some dimensions up to the block size and the
+                // primitives write that padding too.
+                try
+                {
+                    const Shape& shape = get_shape();
+                    mkldnn::memory::desc md(
+                        mkldnn::memory::dims(shape.begin(), shape.end()),
+                        mkldnn_utils::get_mkldnn_data_type(get_element_type()),
+                        mkldnn_format);
+                    mkldnn::memory::primitive_desc pd(md, mkldnn_utils::global_cpu_engine);
+                    allocated_size = std::max(allocated_size, pd.get_size());
+                }
+                catch (const mkldnn::error&)
+                {
+                }
+                catch (const ngraph_error&)
+                {
+                }
+                return allocated_size;
+            }
+
             void LayoutDescriptor::set_axis_order(const AxisVector& perm) { axis_order = perm; }
             size_t LayoutDescriptor::get_index_offset(const std::vector<size_t>& indices)
             {
@@ -41,6 +41,7 @@ namespace ngraph
                                  const AxisVector& tv_axis_order);
                 ~LayoutDescriptor() override {}
                 size_t get_size() override { return size; }
+                size_t get_allocated_size() override;
                 size_t get_offset() const { return offset; }
                 size_t get_index_offset(const std::vector<size_t>& indices) override;
 
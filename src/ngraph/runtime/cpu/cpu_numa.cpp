@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// From <numaif.h>, which comes with libnuma rather than the kernel headers
+#define NGRAPH_MPOL_BIND 2
+#define NGRAPH_MPOL_MF_MOVE (1 << 1)
+
+static const string s_node_directory = "/sys/devices/system/node";
+
+// Parses a sysfs CPU list such as "0-3,8,10-11"
+static vector<int> parse_cpu_list(const string& list)
+{
+    vector<int> cpus;
+    stringstream ss(list);
+    string range;
+    while (getline(ss, range, ','))
+    {
+        if (range.empty() || range == "\n")
+        {
+            continue;
+        }
+        size_t dash = range.find('-');
+        int first = stoi(range.substr(0, dash));
+        int last = (dash == string::npos ? first : stoi(range.substr(dash + 1)));
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+static vector<runtime::cpu::numa::Node> read_nodes()
+{
+    vector<string> node_directories;
+    if (file_util::exists(s_node_directory))
+    {
+        file_util::iterate_files(s_node_directory, [&](const string& path, bool is_dir) {
+            string name = file_util::get_file_name(path);
+            if (is_dir && name.size() > 4 && name.compare(0, 4, "node") == 0 &&
+                name.find_first_not_of("0123456789", 4) == string::npos)
+            {
+                node_directories.push_back(path);
+            }
+        });
+    }
+
+    vector<runtime::cpu::numa::Node> nodes;
+    for (const string& path : node_directories)
+    {
+        ifstream cpulist(file_util::path_join(path, "cpulist"));
+        string list;
+        getline(cpulist, list);
+        vector<int> cpus = parse_cpu_list(list);
+        // Memory-only nodes can't run threads
+        if (!cpus.empty())
+        {
+            nodes.push_back({stoul(file_util::get_file_name(path).substr(4)), cpus});
+        }
+    }
+    sort(nodes.begin(),
+         nodes.end(),
+         [](const runtime::cpu::numa::Node& a, const runtime::cpu::numa::Node& b) {
+             return a.m_id < b.m_id;
+         });
+
+    if (nodes.empty())
+    {
+        runtime::cpu::numa::Node node{0, {}};
+        size_t cpu_count = max(thread::hardware_concurrency(), 1u);
+        for (size_t cpu = 0; cpu < cpu_count; cpu++)
+        {
+            node.m_cpus.push_back(static_cast<int>(cpu));
+        }
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+const vector<runtime::cpu::numa::Node>& runtime::cpu::numa::get_nodes()
+{
+    static const vector<Node> nodes = read_nodes();
+    return nodes;
+}
+
+const runtime::cpu::numa::Node& runtime::cpu::numa::get_node(size_t node_id)
+{
+    for (const Node& node : get_nodes())
+    {
+        if (node.m_id == node_id)
+        {
+            return node;
+        }
+    }
+    throw ngraph_error("NUMA node " + to_string(node_id) + " has no CPUs or does not exist");
+}
+
+bool runtime::cpu::numa::bind_memory(void* data, size_t size, size_t node_id)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // mbind works on whole pages, the partial pages at either end may belong to other
+    // allocations
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(data) + page_size - 1) & ~(page_size - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(data) + size) & ~(page_size - 1);
+    if (end <= begin)
+    {
+        return true;
+    }
+
+    const size_t bits = sizeof(unsigned long) * CHAR_BIT;
+    vector<unsigned long> mask(node_id / bits + 1, 0);
+    mask[node_id / bits] = 1UL << (node_id % bits);
+    // The kernel ignores the last bit of maxnode
+    long rc = syscall(SYS_mbind,
+                      begin,
+                      end - begin,
+                      NGRAPH_MPOL_BIND,
+                      mask.data(),
+                      mask.size() * bits + 1,
+                      NGRAPH_MPOL_MF_MOVE);
+    return rc == 0 || (errno == ENOSYS && node_id == 0);
+#else
+    return node_id == 0;
+#endif
+}
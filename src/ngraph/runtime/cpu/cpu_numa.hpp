@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace numa
+            {
+                /// A NUMA node and the CPUs it contains
+                struct Node
+                {
+                    size_t m_id;
+                    std::vector<int> m_cpus;
+                };
+
+                /// \brief The NUMA nodes that have CPUs, read from sysfs. A machine without
+                ///        NUMA support is a single node 0 with every CPU.
+                const std::vector<Node>& get_nodes();
+
+                /// \brief The node with id node_id. Throws if there is none.
+                const Node& get_node(size_t node_id);
+
+                /// \brief Moves the pages that lie entirely in [data, data + size) to node_id
+                ///        and keeps them there. Returns false if they could not be placed, in
+                ///        which case they stay where they are. Without NUMA support in the
+                ///        kernel all memory is on node 0.
+                bool bind_memory(void* data, size_t size, size_t node_id);
+            }
+        }
+    }
+}
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 namespace mkldnn
 {
@@ -29,6 +30,11 @@ namespace ngraph
     namespace runtime
     {
         class AlignedBuffer;
+
+        namespace cpu
+        {
+            class CPUExecutor;
+        }
     }
 }
 
@@ -43,13 +49,19 @@ namespace ngraph
             typedef std::chrono::microseconds Timescale;
 
             extern "C" {
+            // One context per in-flight call. Everything a call writes to (temporary pools,
+            // op control flags, MKLDNN primitives and workspaces) lives here, so a
+            // compiled function can be executed concurrently on distinct contexts.
             struct CPURuntimeContext
             {
                 int64_t* op_durations;
                 bool* p_en;
+                bool* t_en;
+                bool first_iteration;
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
+                CPUExecutor* executor;
             };
             }
         }
@@ -0,0 +1,355 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "ngraph/except.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_task_graph.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+const size_t runtime::cpu::TaskGraph::s_serial_cost = 1 << 16;
+
+size_t runtime::cpu::TaskGraph::add_task(size_t cost)
+{
+    m_costs.push_back(cost);
+    m_successors.emplace_back();
+    m_predecessor_counts.push_back(0);
+    return m_costs.size() - 1;
+}
+
+void runtime::cpu::TaskGraph::add_edge(size_t from, size_t to)
+{
+    if (from >= to || to >= m_costs.size())
+    {
+        throw ngraph_error("Invalid task graph edge " + to_string(from) + " -> " + to_string(to));
+    }
+    m_successors[from].push_back(to);
+    m_predecessor_counts[to]++;
+}
+
+namespace
+{
+    // The ready tasks of a worker. The owner pushes and pops at the back, thieves take
+    // from the front.
+    struct TaskQueue
+    {
+        mutex m_mutex;
+        deque<size_t> m_tasks;
+    };
+
+    // The state of one run of a task graph, shared by the workers
+    class TaskGraphRun
+    {
+    public:
+        TaskGraphRun(const runtime::cpu::TaskGraph& graph,
+                     runtime::cpu::CPUExecutor& executor,
+                     const function<void(size_t)>& body);
+
+        // Runs tasks until the graph is done
+        void work(size_t worker);
+
+        exception_ptr m_error;
+
+    private:
+        bool pop(size_t worker, size_t& task);
+        void push(size_t worker, size_t task);
+        void execute(size_t worker, size_t task);
+        size_t get_thread_count(size_t task) const;
+
+        const runtime::cpu::TaskGraph& m_graph;
+        runtime::cpu::CPUExecutor& m_executor;
+        const function<void(size_t)>& m_body;
+        size_t m_worker_count;
+        // The cost of the longest path from each task to the end of the graph
+        vector<size_t> m_ranks;
+        unique_ptr<atomic<size_t>[]> m_pending_predecessors;
+        unique_ptr<TaskQueue[]> m_queues;
+        atomic<size_t> m_unfinished;
+        atomic<size_t> m_queued;
+        // The cost of the tasks that are ready or running
+        atomic<size_t> m_active_cost;
+        atomic<bool> m_failed;
+        // Idle workers wait for tasks here
+        mutex m_mutex;
+        condition_variable m_idle;
+    };
+}
+
+TaskGraphRun::TaskGraphRun(const runtime::cpu::TaskGraph& graph,
+                           runtime::cpu::CPUExecutor& executor,
+                           const function<void(size_t)>& body)
+    : m_graph(graph)
+    , m_executor(executor)
+    , m_body(body)
+    , m_worker_count(executor.get_thread_count())
+    , m_ranks(graph.size())
+    , m_pending_predecessors(new atomic<size_t>[graph.size()])
+    , m_queues(new TaskQueue[executor.get_thread_count()])
+    , m_unfinished(graph.size())
+    , m_queued(0)
+    , m_active_cost(0)
+    , m_failed(false)
+{
+    vector<size_t> ready;
+    for (size_t task = graph.size(); task-- > 0;)
+    {
+        size_t rank = 0;
+        for (size_t successor : graph.get_successors(task))
+        {
+            rank = max(rank, m_ranks[successor]);
+        }
+        m_ranks[task] = rank + graph.get_cost(task);
+
+        m_pending_predecessors[task] = graph.get_predecessor_count(task);
+        if (graph.get_predecessor_count(task) == 0)
+        {
+            ready.push_back(task);
+        }
+    }
+
+    // Deal the most critical tasks out first so that every worker starts on one
+    stable_sort(ready.begin(), ready.end(), [this](size_t a, size_t b) {
+        return m_ranks[a] > m_ranks[b];
+    });
+    for (size_t i = 0; i < ready.size(); i++)
+    {
+        m_active_cost += graph.get_cost(ready[i]);
+        m_queues[i % m_worker_count].m_tasks.push_front(ready[i]);
+    }
+    m_queued = ready.size();
+}
+
+void TaskGraphRun::work(size_t worker)
+{
+    size_t task;
+    while (true)
+    {
+        if (pop(worker, task))
+        {
+            execute(worker, task);
+            continue;
+        }
+        unique_lock<mutex> lock(m_mutex);
+        m_idle.wait(lock, [this]() { return m_unfinished == 0 || m_queued != 0; });
+        if (m_unfinished == 0)
+        {
+            return;
+        }
+    }
+}
+
+bool TaskGraphRun::pop(size_t worker, size_t& task)
+{
+    for (size_t i = 0; i < m_worker_count; i++)
+    {
+        TaskQueue& queue = m_queues[(worker + i) % m_worker_count];
+        lock_guard<mutex> lock(queue.m_mutex);
+        if (!queue.m_tasks.empty())
+        {
+            if (i == 0)
+            {
+                task = queue.m_tasks.back();
+                queue.m_tasks.pop_back();
+            }
+            else
+            {
+                task = queue.m_tasks.front();
+                queue.m_tasks.pop_front();
+            }
+            m_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskGraphRun::push(size_t worker, size_t task)
+{
+    {
+        TaskQueue& queue = m_queues[worker];
+        lock_guard<mutex> lock(queue.m_mutex);
+        queue.m_tasks.push_back(task);
+    }
+    m_queued++;
+    {
+        // Orders the notification after the check of a worker about to wait
+        lock_guard<mutex> lock(m_mutex);
+    }
+    m_idle.notify_one();
+}
+
+void TaskGraphRun::execute(size_t worker, size_t task)
+{
+    while (true)
+    {
+        if (!m_failed)
+        {
+            try
+            {
+                runtime::cpu::CPUExecutor::Scope scope(m_executor, get_thread_count(task));
+                m_body(task);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(m_mutex);
+                if (!m_error)
+                {
+                    m_error = current_exception();
+                }
+                m_failed = true;
+            }
+        }
+        m_active_cost -= m_graph.get_cost(task);
+
+        // Continue with the most critical successor that became ready and queue the others
+        bool has_next = false;
+        size_t next = 0;
+        for (size_t successor : m_graph.get_successors(task))
+        {
+            if (--m_pending_predecessors[successor] != 0)
+            {
+                continue;
+            }
+            m_active_cost += m_graph.get_cost(successor);
+            if (!has_next)
+            {
+                next = successor;
+                has_next = true;
+            }
+            else if (m_ranks[successor] > m_ranks[next])
+            {
+                push(worker, next);
+                next = successor;
+            }
+            else
+            {
+                push(worker, successor);
+            }
+        }
+
+        if (--m_unfinished == 0)
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+            }
+            m_idle.notify_all();
+        }
+        if (!has_next)
+        {
+            return;
+        }
+        task = next;
+    }
+}
+
+size_t TaskGraphRun::get_thread_count(size_t task) const
+{
+    size_t cost = m_graph.get_cost(task);
+    if (cost < runtime::cpu::TaskGraph::s_serial_cost)
+    {
+        return 1;
+    }
+    double share = static_cast<double>(cost) / max(m_active_cost.load(), cost);
+    size_t thread_count = static_cast<size_t>(share * m_worker_count + 0.5);
+    return min(max(thread_count, size_t(1)), m_worker_count);
+}
+
+void runtime::cpu::TaskGraph::run(CPUExecutor& executor,
+                                  const function<void(size_t)>& body) const
+{
+    if (executor.get_thread_count() == 1)
+    {
+        for (size_t task = 0; task < m_costs.size(); task++)
+        {
+            body(task);
+        }
+        return;
+    }
+    if (m_costs.empty())
+    {
+        return;
+    }
+
+    TaskGraphRun state(*this, executor, body);
+    executor.run_inter_op([&state](size_t worker) { state.work(worker); });
+    if (state.m_error)
+    {
+        rethrow_exception(state.m_error);
+    }
+}
+
+size_t runtime::cpu::TaskGraph::estimate_cost(const Node& node)
+{
+    static const unordered_set<string> convolutions{"Convolution",
+                                                    "ConvolutionBias",
+                                                    "ConvolutionBiasRelu",
+                                                    "ConvolutionRelu",
+                                                    "GroupConvolution"};
+
+    size_t bytes = 0;
+    for (const descriptor::Input& input : node.get_inputs())
+    {
+        bytes += input.get_tensor().size();
+    }
+    size_t output_size = 0;
+    for (const descriptor::Output& output : node.get_outputs())
+    {
+        bytes += output.get_tensor().size();
+        output_size += shape_size(output.get_shape());
+    }
+
+    size_t operations = output_size;
+    if (auto dot = dynamic_cast<const op::Dot*>(&node))
+    {
+        const Shape& arg0_shape = node.get_input_shape(0);
+        size_t reduction_size = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count();
+             i < arg0_shape.size();
+             i++)
+        {
+            reduction_size *= arg0_shape[i];
+        }
+        operations = 2 * output_size * reduction_size;
+    }
+    else if (auto matmul = dynamic_cast<const op::MatmulBias*>(&node))
+    {
+        const Shape& arg0_shape = matmul->get_arg0_shape();
+        operations =
+            2 * output_size * arg0_shape.at(matmul->get_is_arg0_transposed() ? 0 : 1);
+    }
+    else if (convolutions.count(node.description()) != 0)
+    {
+        // Each output element reduces over one output channel's filters
+        const Shape& filters_shape = node.get_input_shape(1);
+        operations = 2 * output_size * (shape_size(filters_shape) / filters_shape.at(0));
+    }
+    return operations + bytes;
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace ngraph
+{
+    class Node;
+
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPUExecutor;
+
+            /// \brief A DAG of tasks with estimated costs, such as the ops of a function, that
+            ///        run concurrently on a CPU executor.
+            ///
+            /// Tasks are added in a topological order, so every edge goes from an earlier
+            /// task to a later one. The graph isn't changed by run, so a graph may be run by
+            /// any number of calls at once.
+            ///
+            /// run schedules with work stealing: each thread takes the most critical of its
+            /// own ready tasks, ranked by the cost of the longest path from the task to the
+            /// end of the graph, and idle threads steal from the others. Each task is given a
+            /// share of the executor's threads for its kernels that is proportional to its
+            /// cost among the tasks that are ready or running, so a single expensive task
+            /// gets the whole executor while a wide set of cheap ones runs one per thread.
+            class TaskGraph
+            {
+            public:
+                /// \brief Adds a task and returns its index.
+                size_t add_task(size_t cost);
+                /// \brief Makes task to wait for task from, which must have been added first.
+                void add_edge(size_t from, size_t to);
+
+                size_t size() const { return m_costs.size(); }
+                size_t get_cost(size_t task) const { return m_costs.at(task); }
+                const std::vector<size_t>& get_successors(size_t task) const
+                {
+                    return m_successors.at(task);
+                }
+                size_t get_predecessor_count(size_t task) const
+                {
+                    return m_predecessor_counts.at(task);
+                }
+
+                /// \brief Calls body(task) for every task, each after the tasks it waits for,
+                ///        on the calling thread and executor's inter-op threads.
+                ///
+                /// If a task throws, the tasks that haven't started are skipped and the first
+                /// exception is rethrown once the running ones are done.
+                void run(CPUExecutor& executor, const std::function<void(size_t)>& body) const;
+
+                /// \brief The estimated cost of running node: twice its multiply-adds for
+                ///        dot products and convolutions, or one operation per output element
+                ///        otherwise, plus the bytes it reads and writes.
+                static size_t estimate_cost(const Node& node);
+
+                /// \brief Tasks cheaper than this run their kernels on a single thread.
+                static const size_t s_serial_cost;
+
+            private:
+                std::vector<size_t> m_costs;
+                std::vector<std::vector<size_t>> m_successors;
+                std::vector<size_t> m_predecessor_counts;
+            };
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/except.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief The data pointers of the tensors of a direct execution function, held
+            ///        in a dense table with one slot per tensor.
+            ///
+            /// The functors built for the ops keep references to their slots, so the table
+            /// is sized for every tensor of the function by reset before any slot is handed
+            /// out and never grows afterwards.
+            class TensorSlots
+            {
+            public:
+                /// \brief Empties the table and makes room for count tensors.
+                void reset(size_t count)
+                {
+                    m_slots.assign(count, nullptr);
+                    m_indices.clear();
+                }
+
+                /// \brief The index of the slot of the tensor named name, assigning the next
+                ///        free slot to a tensor seen for the first time.
+                size_t get_index(const std::string& name)
+                {
+                    auto it = m_indices.find(name);
+                    if (it != m_indices.end())
+                    {
+                        return it->second;
+                    }
+                    if (m_indices.size() == m_slots.size())
+                    {
+                        throw ngraph_error("No tensor slot left for " + name);
+                    }
+                    size_t index = m_indices.size();
+                    m_indices.emplace(name, index);
+                    return index;
+                }
+
+                void*& operator[](const std::string& name) { return m_slots[get_index(name)]; }
+                void** data() { return m_slots.data(); }
+                size_t size() const { return m_indices.size(); }
+
+            private:
+                std::vector<void*> m_slots;
+                std::unordered_map<std::string, size_t> m_indices;
+            };
+        }
+    }
+}
@@ -41,6 +41,7 @@ namespace ngraph
 
                 char* get_data_ptr();
                 const char* get_data_ptr() const;
+                void* get_host_data_ptr() override { return get_data_ptr(); }
 
                 size_t get_size() const;
                 const element::Type& get_element_type() const;
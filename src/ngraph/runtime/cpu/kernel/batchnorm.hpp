@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/runtime/reference/batch_norm.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType>
+                void batch_norm_three_outputs(double eps,
+                                              void* gamma,
+                                              void* beta,
+                                              void* input,
+                                              void* output,
+                                              void* mean,
+                                              void* variance,
+                                              const Shape& input_shape)
+                {
+                    reference::batch_norm_three_outputs<ElementType>(
+                        eps,
+                        static_cast<const ElementType*>(gamma),
+                        static_cast<const ElementType*>(beta),
+                        static_cast<const ElementType*>(input),
+                        static_cast<ElementType*>(output),
+                        static_cast<ElementType*>(mean),
+                        static_cast<ElementType*>(variance),
+                        input_shape);
+                }
+
+                template <typename ElementType>
+                void batch_norm_one_output(double eps,
+                                           void* gamma,
+                                           void* beta,
+                                           void* input,
+                                           void* mean,
+                                           void* variance,
+                                           void* output,
+                                           const Shape& input_shape)
+                {
+                    reference::batch_norm_one_output<ElementType>(
+                        eps,
+                        static_cast<const ElementType*>(gamma),
+                        static_cast<const ElementType*>(beta),
+                        static_cast<const ElementType*>(input),
+                        static_cast<const ElementType*>(mean),
+                        static_cast<const ElementType*>(variance),
+                        static_cast<ElementType*>(output),
+                        input_shape);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType, unsigned int Rank>
+                void broadcast(void* input,
+                               void* output,
+                               const Shape& input_shape,
+                               const Shape& output_shape,
+                               const AxisSet& broadcast_axes)
+                {
+                    Eigen::array<Eigen::Index, Rank> out_dims, in_dims, factors;
+
+                    // View the input with a unit extent on every broadcast axis so that
+                    // both tensors have the same rank
+                    size_t input_axis = 0;
+                    for (int i = 0; i < Rank; i++)
+                    {
+                        out_dims[i] = output_shape[i];
+                        if (broadcast_axes.count(i))
+                        {
+                            in_dims[i] = 1;
+                            factors[i] = output_shape[i];
+                        }
+                        else
+                        {
+                            in_dims[i] = input_shape[input_axis++];
+                            factors[i] = 1;
+                        }
+                    }
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
+                        static_cast<ElementType*>(input), in_dims);
+
+                    out.device(eigen::get_thread_pool_device()) = in.broadcast(factors);
+                }
+
+                template <typename ElementType>
+                void ref_broadcast(void* input,
+                                   void* output,
+                                   const Shape& input_shape,
+                                   const Shape& output_shape,
+                                   const AxisSet& broadcast_axes)
+                {
+                    reference::broadcast<ElementType>(static_cast<const ElementType*>(input),
+                                                      static_cast<ElementType*>(output),
+                                                      input_shape,
+                                                      output_shape,
+                                                      broadcast_axes);
+                }
+            }
+        }
+    }
+}
@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <thread>
+#pragma once
 
-#include "eigen_thread_pool.hpp"
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 
 namespace ngraph
 {
@@ -24,27 +27,22 @@ namespace ngraph
     {
         namespace cpu
         {
-            namespace eigen
+            namespace kernel
             {
-                static int GetNumCores()
+                template <typename ElementType>
+                void ceil(void* input0, void* output, size_t count)
                 {
-                    const auto omp_num_threads = std::getenv("OMP_NUM_THREADS");
-                    int count;
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
 
-                    if (omp_num_threads && (count = std::atoi(omp_num_threads)))
-                    {
-                        return count;
-                    }
-                    else
-                    {
-                        count = std::thread::hardware_concurrency() >> 1;
-                    }
-                    return count ? count : 1;
-                }
+                    out_dims[0] = in_dims[0] = count;
 
-                Eigen::ThreadPool global_thread_pool(GetNumCores());
-                Eigen::ThreadPoolDevice global_thread_pool_device(&global_thread_pool,
-                                                                  global_thread_pool.NumThreads());
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), in_dims);
+
+                    out.device(eigen::get_thread_pool_device()) = in0.ceil();
+                }
             }
         }
     }
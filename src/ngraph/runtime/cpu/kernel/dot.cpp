@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/element_types.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace
+                {
+                    // Columns of the output row handled by one task, so that short and wide
+                    // products still spread across the pool.
+                    constexpr size_t s_dot_column_block = 512;
+
+                    // Row-major (m x k) * (k x n). Every output element accumulates over k in
+                    // order, matching the reference kernel.
+                    template <typename ElementType>
+                    void gemm(const ElementType* a,
+                              const ElementType* b,
+                              ElementType* c,
+                              size_t m,
+                              size_t n,
+                              size_t k)
+                    {
+                        size_t column_blocks = (n + s_dot_column_block - 1) / s_dot_column_block;
+                        double block_bytes = k * std::min(n, s_dot_column_block) *
+                                             sizeof(ElementType);
+                        eigen::parallel_for(
+                            m * column_blocks,
+                            block_bytes,
+                            block_bytes / sizeof(ElementType),
+                            [&](size_t first, size_t last) {
+                                for (size_t task = first; task < last; task++)
+                                {
+                                    size_t row = task / column_blocks;
+                                    size_t begin = (task % column_blocks) * s_dot_column_block;
+                                    size_t end = std::min(n, begin + s_dot_column_block);
+                                    ElementType* out = c + row * n;
+                                    std::fill(out + begin, out + end, ElementType(0));
+                                    for (size_t p = 0; p < k; p++)
+                                    {
+                                        ElementType scale = a[row * k + p];
+                                        const ElementType* in = b + p * n;
+                                        for (size_t j = begin; j < end; j++)
+                                        {
+                                            out[j] += scale * in[j];
+                                        }
+                                    }
+                                }
+                            });
+                    }
+
+                    void gemm(
+                        const float* a, const float* b, float* c, size_t m, size_t n, size_t k)
+                    {
+                        if (k == 0)
+                        {
+                            std::fill(c, c + m * n, 0.0f);
+                            return;
+                        }
+                        cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                           cblas::Transpose::None,
+                                           cblas::Transpose::None,
+                                           m,
+                                           n,
+                                           k,
+                                           1.0f,
+                                           a,
+                                           k,
+                                           b,
+                                           std::max<size_t>(1, n),
+                                           0.0f,
+                                           c,
+                                           std::max<size_t>(1, n));
+                    }
+                }
+
+                template <typename ElementType>
+                void dot_nd(const ElementType* arg0,
+                            const ElementType* arg1,
+                            ElementType* output,
+                            const Shape& arg0_shape,
+                            const Shape& arg1_shape,
+                            size_t reduction_axes_count)
+                {
+                    // A tensor dot is a matrix product once the free axes of each argument and
+                    // the reduction axes are flattened.
+                    size_t arg0_free_axes = arg0_shape.size() - reduction_axes_count;
+                    size_t m = shape_size(
+                        Shape(arg0_shape.begin(), arg0_shape.begin() + arg0_free_axes));
+                    size_t k = shape_size(
+                        Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                    size_t n = shape_size(
+                        Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                    if (m == 0 || n == 0)
+                    {
+                        return;
+                    }
+                    gemm(arg0, arg1, output, m, n, k);
+                }
+
+#define INSTANTIATE_DOT(T)                                                                         \
+    template void dot_nd<T>(const T*, const T*, T*, const Shape&, const Shape&, size_t);
+                NGRAPH_CPU_KERNEL_FOR_EACH_TYPE(INSTANTIATE_DOT)
+#undef INSTANTIATE_DOT
+            }
+        }
+    }
+}
@@ -19,6 +19,8 @@
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -27,8 +29,25 @@ namespace ngraph
         {
             namespace eigen
             {
-                extern Eigen::ThreadPool global_thread_pool;
-                extern Eigen::ThreadPoolDevice global_thread_pool_device;
+                /// The Eigen device of the executor of the call running on this thread
+                inline Eigen::ThreadPoolDevice& get_thread_pool_device()
+                {
+                    return CPUExecutor::get_current_device();
+                }
+
+                /// Runs f(first, last) over disjoint ranges covering [0, n) on the current
+                /// executor's thread pool. The per-item cost decides how finely the range is
+                /// split; small problems run inline on the calling thread.
+                template <typename F>
+                void parallel_for(size_t n, double bytes_per_item, double cycles_per_item, F f)
+                {
+                    get_thread_pool_device().parallelFor(
+                        static_cast<Eigen::Index>(n),
+                        Eigen::TensorOpCost(bytes_per_item, bytes_per_item, cycles_per_item),
+                        [&f](Eigen::Index first, Eigen::Index last) {
+                            f(static_cast<size_t>(first), static_cast<size_t>(last));
+                        });
+                }
             }
         }
     }
@@ -0,0 +1,35 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+// Expands MACRO once for every C type that backs an nGraph element type. Used to explicitly
+// instantiate the kernel templates declared in cpu_kernels.hpp so generated code can link
+// against them.
+#define NGRAPH_CPU_KERNEL_FOR_EACH_TYPE(MACRO)                                                     \
+    MACRO(char)                                                                                    \
+    MACRO(float)                                                                                   \
+    MACRO(double)                                                                                  \
+    MACRO(int8_t)                                                                                  \
+    MACRO(int16_t)                                                                                 \
+    MACRO(int32_t)                                                                                 \
+    MACRO(int64_t)                                                                                 \
+    MACRO(uint8_t)                                                                                 \
+    MACRO(uint16_t)                                                                                \
+    MACRO(uint32_t)                                                                                \
+    MACRO(uint64_t)
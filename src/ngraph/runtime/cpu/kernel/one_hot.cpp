@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/element_types.hpp"
+#include "ngraph/runtime/cpu/kernel/strided_copy.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace
+                {
+                    template <typename ElementType>
+                    bool is_integral(ElementType value)
+                    {
+                        return !(std::floor(value) < value || std::floor(value) > value);
+                    }
+
+                    template <typename ElementType>
+                    bool is_in_range(ElementType value, size_t depth)
+                    {
+                        return !(value < 0) && static_cast<size_t>(value) < depth;
+                    }
+                }
+
+                template <typename ElementType>
+                void one_hot_nd(const ElementType* input,
+                                ElementType* output,
+                                const Shape& input_shape,
+                                const Shape& output_shape,
+                                size_t one_hot_axis)
+                {
+                    ElementType zero = 0;
+                    fill(output, &zero, sizeof(ElementType), shape_size(output_shape));
+
+                    // Input element (outer, inner) sets output element (outer, value, inner).
+                    size_t depth = output_shape[one_hot_axis];
+                    size_t inner = 1;
+                    for (size_t i = one_hot_axis; i < input_shape.size(); i++)
+                    {
+                        inner *= input_shape[i];
+                    }
+
+                    // Workers cannot throw, so remember the first bad input and report it
+                    // afterwards the same way the reference kernel would.
+                    std::atomic<size_t> first_invalid(std::numeric_limits<size_t>::max());
+                    eigen::parallel_for(
+                        shape_size(input_shape),
+                        sizeof(ElementType),
+                        4,
+                        [&](size_t first, size_t last) {
+                            for (size_t i = first; i < last; i++)
+                            {
+                                ElementType value = input[i];
+                                if (!is_integral(value) || !is_in_range(value, depth))
+                                {
+                                    size_t seen = first_invalid.load();
+                                    while (i < seen &&
+                                           !first_invalid.compare_exchange_weak(seen, i))
+                                    {
+                                    }
+                                    return;
+                                }
+                                size_t outer = i / inner;
+                                output[(outer * depth + static_cast<size_t>(value)) * inner +
+                                       i % inner] = 1;
+                            }
+                        });
+
+                    if (first_invalid != std::numeric_limits<size_t>::max())
+                    {
+                        if (!is_integral(input[first_invalid]))
+                        {
+                            throw(std::range_error("One-hot: non-integral value in input"));
+                        }
+                        throw(std::range_error("One-hot: value is out of category range"));
+                    }
+                }
+
+#define INSTANTIATE_ONE_HOT(T)                                                                     \
+    template void one_hot_nd<T>(const T*, T*, const Shape&, const Shape&, size_t);
+                NGRAPH_CPU_KERNEL_FOR_EACH_TYPE(INSTANTIATE_ONE_HOT)
+#undef INSTANTIATE_ONE_HOT
+            }
+        }
+    }
+}
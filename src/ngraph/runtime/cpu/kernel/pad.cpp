@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include "pad.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/strided_copy.hpp"
 
 namespace ngraph
 {
@@ -34,12 +36,46 @@ namespace ngraph
                 {
                     pad<float, 4>(input,
                                   output,
-                                  pad_value,
+                                  &pad_value,
                                   input_shape,
                                   output_shape,
                                   padding_below,
                                   padding_above);
                 }
+
+                void pad_nd(const void* input,
+                            const void* pad_value,
+                            void* output,
+                            size_t element_size,
+                            const Shape& input_shape,
+                            const Shape& output_shape,
+                            const Shape& padding_below,
+                            const Shape& padding_interior)
+                {
+                    fill(output, pad_value, element_size, shape_size(output_shape));
+
+                    // The input lands at padding_below, with each axis stepping over its
+                    // interior padding.
+                    std::vector<size_t> strides = row_major_strides(output_shape);
+                    std::vector<size_t> input_row_strides = row_major_strides(input_shape);
+                    std::vector<ptrdiff_t> input_strides(input_row_strides.begin(),
+                                                         input_row_strides.end());
+                    std::vector<ptrdiff_t> output_strides(input_shape.size());
+                    size_t offset = 0;
+                    for (size_t i = 0; i < input_shape.size(); i++)
+                    {
+                        output_strides[i] =
+                            static_cast<ptrdiff_t>(strides[i] * (padding_interior[i] + 1));
+                        offset += padding_below[i] * strides[i];
+                    }
+
+                    strided_copy(input,
+                                 static_cast<char*>(output) + offset * element_size,
+                                 element_size,
+                                 input_shape,
+                                 input_strides,
+                                 output_strides);
+                }
             }
         }
     }
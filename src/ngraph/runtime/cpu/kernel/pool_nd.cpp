@@ -0,0 +1,261 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/element_types.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace
+                {
+                    // Calls f(run, length) for every contiguous run of the window
+                    // [lower, upper) within one input plane.
+                    template <typename ElementType, typename F>
+                    void for_each_window_run(const ElementType* plane,
+                                             const std::vector<size_t>& lower,
+                                             const std::vector<size_t>& upper,
+                                             const std::vector<size_t>& strides,
+                                             std::vector<size_t>& coord,
+                                             F f)
+                    {
+                        size_t inner = lower.size() - 1;
+                        coord = lower;
+                        while (true)
+                        {
+                            size_t offset = 0;
+                            for (size_t d = 0; d <= inner; d++)
+                            {
+                                offset += coord[d] * strides[d];
+                            }
+                            f(plane + offset, upper[inner] - lower[inner]);
+
+                            size_t d = inner;
+                            while (d > 0)
+                            {
+                                d--;
+                                if (++coord[d] < upper[d])
+                                {
+                                    break;
+                                }
+                                coord[d] = lower[d];
+                                if (d == 0)
+                                {
+                                    return;
+                                }
+                            }
+                            if (inner == 0)
+                            {
+                                return;
+                            }
+                        }
+                    }
+
+                    // Walks every output element of an (N, C, spatial...) pooling and sets
+                    // it to pool(plane, lower, upper, coord), where [lower, upper) is the part
+                    // of its window that lies inside the unpadded input plane.
+                    template <typename ElementType, typename Pool>
+                    void pool(const ElementType* input,
+                              ElementType* output,
+                              const Shape& input_shape,
+                              const Shape& output_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              Pool pool_window)
+                    {
+                        Shape input_plane(input_shape.begin() + 2, input_shape.end());
+                        Shape output_plane(output_shape.begin() + 2, output_shape.end());
+                        size_t rank = input_plane.size();
+                        size_t input_plane_size = shape_size(input_plane);
+                        size_t output_plane_size = shape_size(output_plane);
+                        std::vector<size_t> strides = row_major_strides(input_plane);
+                        size_t window_size = shape_size(window_shape);
+
+                        auto pool_range = [&](size_t first, size_t last) {
+                            std::vector<size_t> out_coord(rank);
+                            std::vector<size_t> lower(rank);
+                            std::vector<size_t> upper(rank);
+                            std::vector<size_t> coord(rank);
+                            size_t plane = first / output_plane_size;
+                            size_t index = first % output_plane_size;
+                            for (size_t d = rank; d-- > 0;)
+                            {
+                                out_coord[d] = index % output_plane[d];
+                                index /= output_plane[d];
+                            }
+
+                            for (size_t o = first; o < last; o++)
+                            {
+                                bool empty = false;
+                                for (size_t d = 0; d < rank; d++)
+                                {
+                                    ptrdiff_t start =
+                                        static_cast<ptrdiff_t>(out_coord[d] *
+                                                               window_movement_strides[d]) -
+                                        static_cast<ptrdiff_t>(padding_below[d]);
+                                    ptrdiff_t end =
+                                        start + static_cast<ptrdiff_t>(window_shape[d]);
+                                    lower[d] = static_cast<size_t>(std::max<ptrdiff_t>(start, 0));
+                                    upper[d] = static_cast<size_t>(std::min<ptrdiff_t>(
+                                        end, static_cast<ptrdiff_t>(input_plane[d])));
+                                    empty |= lower[d] >= upper[d];
+                                }
+                                output[o] = pool_window(input + plane * input_plane_size,
+                                                        lower,
+                                                        upper,
+                                                        strides,
+                                                        coord,
+                                                        empty);
+
+                                size_t d = rank;
+                                while (d > 0)
+                                {
+                                    d--;
+                                    if (++out_coord[d] < output_plane[d])
+                                    {
+                                        break;
+                                    }
+                                    out_coord[d] = 0;
+                                    if (d == 0)
+                                    {
+                                        plane++;
+                                    }
+                                }
+                            }
+                        };
+                        eigen::parallel_for(input_shape[0] * input_shape[1] * output_plane_size,
+                                            window_size * sizeof(ElementType),
+                                            window_size,
+                                            pool_range);
+                    }
+                }
+
+                template <typename ElementType>
+                void max_pool_nd(const ElementType* input,
+                                 ElementType* output,
+                                 const Shape& input_shape,
+                                 const Shape& output_shape,
+                                 const Shape& window_shape,
+                                 const Strides& window_movement_strides,
+                                 const Shape& padding_below)
+                {
+                    auto max_window = [](const ElementType* plane,
+                                         const std::vector<size_t>& lower,
+                                         const std::vector<size_t>& upper,
+                                         const std::vector<size_t>& strides,
+                                         std::vector<size_t>& coord,
+                                         bool empty) {
+                        ElementType result = std::numeric_limits<ElementType>::lowest();
+                        if (!empty)
+                        {
+                            for_each_window_run(
+                                plane, lower, upper, strides, coord, [&](
+                                    const ElementType* run, size_t n) {
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        result = run[i] > result ? run[i] : result;
+                                    }
+                                });
+                        }
+                        return result;
+                    };
+                    pool(input,
+                         output,
+                         input_shape,
+                         output_shape,
+                         window_shape,
+                         window_movement_strides,
+                         padding_below,
+                         max_window);
+                }
+
+                template <typename ElementType>
+                void avg_pool_nd(const ElementType* input,
+                                 ElementType* output,
+                                 const Shape& input_shape,
+                                 const Shape& output_shape,
+                                 const Shape& window_shape,
+                                 const Strides& window_movement_strides,
+                                 const Shape& padding_below,
+                                 bool include_padding_in_avg_computation)
+                {
+                    size_t window_size = shape_size(window_shape);
+                    auto avg_window = [&](const ElementType* plane,
+                                          const std::vector<size_t>& lower,
+                                          const std::vector<size_t>& upper,
+                                          const std::vector<size_t>& strides,
+                                          std::vector<size_t>& coord,
+                                          bool empty) {
+                        ElementType result = 0;
+                        size_t n_elements = 0;
+                        if (!empty)
+                        {
+                            for_each_window_run(
+                                plane, lower, upper, strides, coord, [&](
+                                    const ElementType* run, size_t n) {
+                                    for (size_t i = 0; i < n; i++)
+                                    {
+                                        result += run[i];
+                                    }
+                                    n_elements += n;
+                                });
+                        }
+                        // Padding inside the window counts as zeros when it is included.
+                        if (include_padding_in_avg_computation)
+                        {
+                            n_elements = window_size;
+                        }
+                        return static_cast<ElementType>(result / n_elements);
+                    };
+                    pool(input,
+                         output,
+                         input_shape,
+                         output_shape,
+                         window_shape,
+                         window_movement_strides,
+                         padding_below,
+                         avg_window);
+                }
+
+#define INSTANTIATE_POOL(T)                                                                        \
+    template void max_pool_nd<T>(                                                                  \
+        const T*, T*, const Shape&, const Shape&, const Shape&, const Strides&, const Shape&);     \
+    template void avg_pool_nd<T>(const T*,                                                         \
+                                 T*,                                                               \
+                                 const Shape&,                                                     \
+                                 const Shape&,                                                     \
+                                 const Shape&,                                                     \
+                                 const Strides&,                                                   \
+                                 const Shape&,                                                     \
+                                 bool);
+                NGRAPH_CPU_KERNEL_FOR_EACH_TYPE(INSTANTIATE_POOL)
+#undef INSTANTIATE_POOL
+            }
+        }
+    }
+}
@@ -19,7 +19,9 @@
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/axis_set.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -31,8 +33,8 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType, unsigned int Rank>
-                void reduce_max_all(ElementType* input,
-                                    ElementType* output,
+                void reduce_max_all(void* input,
+                                    void* output,
                                     const Shape& input_shape,
                                     const Shape& output_shape)
                 {
@@ -44,16 +46,16 @@ namespace ngraph
                         in_dims[i] = input_shape[i];
                     }
 
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, 0, Eigen::RowMajor>> out(output,
-                                                                                         out_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(input,
-                                                                                           in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.maximum();
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 0, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
+                        static_cast<ElementType*>(input), in_dims);
+                    out.device(eigen::get_thread_pool_device()) = in.maximum();
                 }
 
                 template <typename ElementType, unsigned int Rank, unsigned int ReductionDims>
-                void reduce_max(ElementType* input,
-                                ElementType* output,
+                void reduce_max(void* input,
+                                void* output,
                                 const Shape& input_shape,
                                 const Shape& output_shape,
                                 const AxisSet& reduction_axes)
@@ -80,10 +82,35 @@ namespace ngraph
 
                     Eigen::TensorMap<
                         Eigen::Tensor<ElementType, Rank - ReductionDims, Eigen::RowMajor>>
-                        out(output, out_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(input,
-                                                                                           in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.maximum(reduction_dims);
+                        out(static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
+                        static_cast<ElementType*>(input), in_dims);
+                    out.device(eigen::get_thread_pool_device()) = in.maximum(reduction_dims);
+                }
+
+                template <typename ElementType, unsigned int Rank>
+                void reduce_max_1rd(void* input,
+                                    void* output,
+                                    const Shape& input_shape,
+                                    const Shape& output_shape,
+                                    const AxisSet& reduction_axes)
+                {
+                    reduce_max<ElementType, Rank, 1>(
+                        input, output, input_shape, output_shape, reduction_axes);
+                }
+
+                template <typename ElementType>
+                void ref_max(void* input,
+                             void* output,
+                             const Shape& input_shape,
+                             const Shape& output_shape,
+                             const AxisSet& reduction_axes)
+                {
+                    reference::max<ElementType>(static_cast<const ElementType*>(input),
+                                                static_cast<ElementType*>(output),
+                                                input_shape,
+                                                output_shape,
+                                                reduction_axes);
                 }
             }
         }
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/element_types.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace
+                {
+                    // Elements per partial result when a whole tensor reduces to one value.
+                    constexpr size_t s_reduce_all_block = 16384;
+
+                    // A run of adjacent axes that are either all reduced or all kept.
+                    struct AxisGroup
+                    {
+                        size_t extent;
+                        size_t stride;
+                        bool reduced;
+                    };
+
+                    size_t group_offset(const std::vector<AxisGroup>& groups, size_t index)
+                    {
+                        size_t offset = 0;
+                        for (size_t g = groups.size(); g-- > 0;)
+                        {
+                            offset += (index % groups[g].extent) * groups[g].stride;
+                            index /= groups[g].extent;
+                        }
+                        return offset;
+                    }
+
+                    std::vector<size_t> group_offsets(const std::vector<AxisGroup>& groups)
+                    {
+                        size_t count = 1;
+                        for (const AxisGroup& group : groups)
+                        {
+                            count *= group.extent;
+                        }
+                        std::vector<size_t> offsets(count);
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            offsets[i] = group_offset(groups, i);
+                        }
+                        return offsets;
+                    }
+
+                    template <typename ElementType, typename Combine>
+                    ElementType combine_run(ElementType acc,
+                                            const ElementType* input,
+                                            size_t count,
+                                            Combine combine)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            acc = combine(acc, input[i]);
+                        }
+                        return acc;
+                    }
+
+                    // Each output element combines its inputs in row-major order, as the
+                    // reference kernels do. The only exception is a reduction of one long
+                    // contiguous run to a scalar, which is split into partial results.
+                    template <typename ElementType, typename Combine>
+                    void reduce(const ElementType* input,
+                                ElementType* output,
+                                const Shape& input_shape,
+                                const AxisSet& reduction_axes,
+                                ElementType identity,
+                                Combine combine)
+                    {
+                        std::vector<size_t> strides = row_major_strides(input_shape);
+                        std::vector<AxisGroup> groups;
+                        size_t output_size = 1;
+                        for (size_t i = 0; i < input_shape.size(); i++)
+                        {
+                            bool reduced = reduction_axes.count(i) != 0;
+                            if (!reduced)
+                            {
+                                output_size *= input_shape[i];
+                            }
+                            if (input_shape[i] == 1)
+                            {
+                                continue;
+                            }
+                            if (!groups.empty() && groups.back().reduced == reduced)
+                            {
+                                groups.back().extent *= input_shape[i];
+                                groups.back().stride = strides[i];
+                            }
+                            else
+                            {
+                                groups.push_back({input_shape[i], strides[i], reduced});
+                            }
+                        }
+
+                        if (shape_size(input_shape) == 0)
+                        {
+                            std::fill(output, output + output_size, identity);
+                            return;
+                        }
+                        if (groups.empty())
+                        {
+                            groups.push_back({1, 1, true});
+                        }
+
+                        AxisGroup inner = groups.back();
+                        groups.pop_back();
+                        std::vector<AxisGroup> kept;
+                        std::vector<AxisGroup> reduced;
+                        for (const AxisGroup& group : groups)
+                        {
+                            (group.reduced ? reduced : kept).push_back(group);
+                        }
+                        if (!inner.reduced)
+                        {
+                            // The innermost axes are kept: every output row is combined
+                            // element-wise with the matching contiguous rows of the input.
+                            std::vector<size_t> reduced_offsets = group_offsets(reduced);
+                            size_t row = inner.extent;
+                            size_t count = reduced_offsets.size();
+                            auto reduce_rows = [&](size_t first, size_t last) {
+                                for (size_t o = first; o < last;)
+                                {
+                                    size_t begin = o % row;
+                                    size_t n = std::min(last - o, row - begin);
+                                    const ElementType* base =
+                                        input + group_offset(kept, o / row) + begin;
+                                    ElementType* out = output + o;
+                                    std::fill(out, out + n, identity);
+                                    for (size_t offset : reduced_offsets)
+                                    {
+                                        const ElementType* in = base + offset;
+                                        for (size_t j = 0; j < n; j++)
+                                        {
+                                            out[j] = combine(out[j], in[j]);
+                                        }
+                                    }
+                                    o += n;
+                                }
+                            };
+                            eigen::parallel_for(
+                                output_size, count * sizeof(ElementType), count, reduce_rows);
+                            return;
+                        }
+
+                        // The innermost axes are reduced: every output element walks the
+                        // outer reduced axes and combines a contiguous run for each.
+                        std::vector<size_t> reduced_offsets = group_offsets(reduced);
+                        size_t run = inner.extent;
+                        if (output_size == 1 && reduced_offsets.size() == 1 &&
+                            run > s_reduce_all_block)
+                        {
+                            size_t blocks = (run + s_reduce_all_block - 1) / s_reduce_all_block;
+                            std::vector<ElementType> partials(blocks);
+                            auto reduce_blocks = [&](size_t first, size_t last) {
+                                for (size_t b = first; b < last; b++)
+                                {
+                                    size_t begin = b * s_reduce_all_block;
+                                    size_t n = std::min(s_reduce_all_block, run - begin);
+                                    partials[b] =
+                                        combine_run(identity, input + begin, n, combine);
+                                }
+                            };
+                            eigen::parallel_for(blocks,
+                                                s_reduce_all_block * sizeof(ElementType),
+                                                s_reduce_all_block,
+                                                reduce_blocks);
+                            *output = combine_run(identity, partials.data(), blocks, combine);
+                            return;
+                        }
+
+                        size_t count = reduced_offsets.size() * run;
+                        auto reduce_elements = [&](size_t first, size_t last) {
+                            for (size_t o = first; o < last; o++)
+                            {
+                                const ElementType* base = input + group_offset(kept, o);
+                                ElementType acc = identity;
+                                for (size_t offset : reduced_offsets)
+                                {
+                                    acc = combine_run(acc, base + offset, run, combine);
+                                }
+                                output[o] = acc;
+                            }
+                        };
+                        eigen::parallel_for(
+                            output_size, count * sizeof(ElementType), count, reduce_elements);
+                    }
+
+                    // Initial values match runtime::reference::max and min.
+                    template <typename ElementType>
+                    ElementType lowest_value()
+                    {
+                        return std::numeric_limits<ElementType>::has_infinity
+                                   ? -std::numeric_limits<ElementType>::infinity()
+                                   : std::numeric_limits<ElementType>::min();
+                    }
+
+                    template <typename ElementType>
+                    ElementType highest_value()
+                    {
+                        return std::numeric_limits<ElementType>::has_infinity
+                                   ? std::numeric_limits<ElementType>::infinity()
+                                   : std::numeric_limits<ElementType>::max();
+                    }
+                }
+
+                template <typename ElementType>
+                void reduce_product_nd(const ElementType* input,
+                                       ElementType* output,
+                                       const Shape& input_shape,
+                                       const AxisSet& reduction_axes)
+                {
+                    reduce(input,
+                           output,
+                           input_shape,
+                           reduction_axes,
+                           ElementType(1),
+                           [](ElementType acc, ElementType x) { return acc * x; });
+                }
+
+                template <typename ElementType>
+                void reduce_max_nd(const ElementType* input,
+                                   ElementType* output,
+                                   const Shape& input_shape,
+                                   const AxisSet& reduction_axes)
+                {
+                    reduce(input,
+                           output,
+                           input_shape,
+                           reduction_axes,
+                           lowest_value<ElementType>(),
+                           [](ElementType acc, ElementType x) { return x > acc ? x : acc; });
+                }
+
+                template <typename ElementType>
+                void reduce_min_nd(const ElementType* input,
+                                   ElementType* output,
+                                   const Shape& input_shape,
+                                   const AxisSet& reduction_axes)
+                {
+                    reduce(input,
+                           output,
+                           input_shape,
+                           reduction_axes,
+                           highest_value<ElementType>(),
+                           [](ElementType acc, ElementType x) { return x < acc ? x : acc; });
+                }
+
+#define INSTANTIATE_REDUCE(T)                                                                      \
+    template void reduce_product_nd<T>(const T*, T*, const Shape&, const AxisSet&);                \
+    template void reduce_max_nd<T>(const T*, T*, const Shape&, const AxisSet&);                    \
+    template void reduce_min_nd<T>(const T*, T*, const Shape&, const AxisSet&);
+                NGRAPH_CPU_KERNEL_FOR_EACH_TYPE(INSTANTIATE_REDUCE)
+#undef INSTANTIATE_REDUCE
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/replace_slice.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType, unsigned int Rank>
+                void replace_slice(void* input0,
+                                   void* input1,
+                                   void* output,
+                                   const Shape& input1_shape,
+                                   const Coordinate& lower_bounds,
+                                   const Coordinate& upper_bounds,
+                                   const Strides& strides,
+                                   const Shape& output_shape)
+                {
+                    Eigen::array<Eigen::Index, Rank> out_dims, in1_dims;
+                    Eigen::array<Eigen::Index, Rank> start_indices, stop_indices, slice_strides;
+                    bool unit_strides = true;
+
+                    for (int i = 0; i < Rank; i++)
+                    {
+                        out_dims[i] = output_shape[i];
+                        in1_dims[i] = input1_shape[i];
+                        start_indices[i] = lower_bounds[i];
+                        stop_indices[i] = upper_bounds[i];
+                        slice_strides[i] = strides[i];
+                        unit_strides = unit_strides && strides[i] == 1;
+                    }
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in1(
+                        static_cast<ElementType*>(input1), in1_dims);
+
+                    if (input0 != output)
+                    {
+                        out.device(eigen::get_thread_pool_device()) = in0;
+                    }
+
+                    if (unit_strides)
+                    {
+                        out.slice(start_indices, in1_dims)
+                            .device(eigen::get_thread_pool_device()) = in1;
+                    }
+                    else
+                    {
+                        out.stridedSlice(start_indices, stop_indices, slice_strides)
+                            .device(eigen::get_thread_pool_device()) = in1;
+                    }
+                }
+
+                template <typename ElementType>
+                void ref_replace_slice(void* input0,
+                                       void* input1,
+                                       void* output,
+                                       const Shape& input1_shape,
+                                       const Coordinate& lower_bounds,
+                                       const Coordinate& upper_bounds,
+                                       const Strides& strides,
+                                       const Shape& output_shape)
+                {
+                    reference::replace_slice<ElementType>(static_cast<const ElementType*>(input0),
+                                                          static_cast<const ElementType*>(input1),
+                                                          static_cast<ElementType*>(output),
+                                                          input1_shape,
+                                                          lower_bounds,
+                                                          upper_bounds,
+                                                          strides,
+                                                          output_shape);
+                }
+            }
+        }
+    }
+}
@@ -21,6 +21,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -32,8 +33,8 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType, unsigned int InRank, unsigned int OutRank>
-                void reshape(ElementType* input,
-                             ElementType* output,
+                void reshape(void* input,
+                             void* output,
                              const Shape& input_shape,
                              const AxisVector& input_axis_order,
                              const Shape& output_shape)
@@ -54,13 +55,38 @@ namespace ngraph
                     }
 
                     Eigen::TensorMap<Eigen::Tensor<ElementType, OutRank, Eigen::RowMajor>> out(
-                        output, out_dims);
+                        static_cast<ElementType*>(output), out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, InRank, Eigen::RowMajor>> in(
-                        input, in_dims);
+                        static_cast<ElementType*>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         in.shuffle(axis_order).reshape(out_dims);
                 }
+
+                template <typename ElementType, unsigned int Rank>
+                void reshape_same_rank(void* input,
+                                       void* output,
+                                       const Shape& input_shape,
+                                       const AxisVector& input_axis_order,
+                                       const Shape& output_shape)
+                {
+                    reshape<ElementType, Rank, Rank>(
+                        input, output, input_shape, input_axis_order, output_shape);
+                }
+
+                template <typename ElementType>
+                void ref_reshape(void* input,
+                                 void* output,
+                                 const Shape& input_shape,
+                                 const AxisVector& input_axis_order,
+                                 const Shape& output_shape)
+                {
+                    reference::reshape<ElementType>(static_cast<const ElementType*>(input),
+                                                    static_cast<ElementType*>(output),
+                                                    input_shape,
+                                                    input_axis_order,
+                                                    output_shape);
+                }
             }
         }
     }
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/strided_copy.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void reverse_nd(const void* input,
+                                void* output,
+                                size_t element_size,
+                                const Shape& shape,
+                                const AxisSet& reversed_axes)
+                {
+                    // Reversing an axis is a copy that reads it from its last element with a
+                    // negated stride.
+                    std::vector<size_t> strides = row_major_strides(shape);
+                    std::vector<ptrdiff_t> input_strides(strides.begin(), strides.end());
+                    std::vector<ptrdiff_t> output_strides(strides.begin(), strides.end());
+                    ptrdiff_t offset = 0;
+                    for (size_t axis : reversed_axes)
+                    {
+                        if (shape[axis] != 0)
+                        {
+                            offset += static_cast<ptrdiff_t>((shape[axis] - 1) * strides[axis]);
+                        }
+                        input_strides[axis] = -input_strides[axis];
+                    }
+
+                    strided_copy(static_cast<const char*>(input) +
+                                     offset * static_cast<ptrdiff_t>(element_size),
+                                 output,
+                                 element_size,
+                                 shape,
+                                 input_strides,
+                                 output_strides);
+                }
+            }
+        }
+    }
+}
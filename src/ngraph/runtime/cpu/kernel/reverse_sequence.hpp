@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType, typename SequenceLengthType>
+                void reverse_sequence(void* input,
+                                      void* output,
+                                      const Shape& input_shape,
+                                      size_t batch_axis,
+                                      size_t sequence_axis,
+                                      void* sequence_lengths)
+                {
+                    reference::reverse_sequence<ElementType, SequenceLengthType>(
+                        static_cast<const ElementType*>(input),
+                        static_cast<ElementType*>(output),
+                        input_shape,
+                        batch_axis,
+                        sequence_axis,
+                        static_cast<SequenceLengthType*>(sequence_lengths));
+                }
+
+                template <typename ElementType>
+                void reverse_sequence_sli32(void* input,
+                                            void* output,
+                                            const Shape& input_shape,
+                                            size_t batch_axis,
+                                            size_t sequence_axis,
+                                            void* sequence_lengths)
+                {
+                    reverse_sequence<ElementType, int32_t>(
+                        input, output, input_shape, batch_axis, sequence_axis, sequence_lengths);
+                }
+            }
+        }
+    }
+}
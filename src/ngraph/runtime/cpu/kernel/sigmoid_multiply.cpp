@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "ngraph/runtime/cpu/kernel/sigmoid_multiply.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                static inline void sigmoid_mul_func(float input,
+                                                    op::SigmoidMultiply::FunctionType func_type,
+                                                    float& numer,
+                                                    float& denom,
+                                                    float& d_numer,
+                                                    float& d_denom)
+                {
+                    switch (func_type)
+                    {
+                    case op::SigmoidMultiply::FunctionType::Logistic:
+                    {
+                        float e_x = std::exp(input);
+                        numer = e_x;
+                        denom = e_x + 1;
+                        d_numer = numer;
+                        d_denom = denom * denom;
+                        break;
+                    }
+                    case op::SigmoidMultiply::FunctionType::Tanh:
+                    {
+                        float e_2x = std::exp(2.0f * input);
+                        numer = e_2x - 1;
+                        denom = e_2x + 1;
+                        d_numer = 4.0f * e_2x;
+                        d_denom = denom * denom;
+                        break;
+                    }
+                    case op::SigmoidMultiply::FunctionType::Identity:
+                        numer = input;
+                        denom = 1;
+                        d_numer = 1;
+                        d_denom = 1;
+                        break;
+                    }
+                }
+
+                void sigmoid_multiply(float* input0,
+                                      float* input1,
+                                      float* output,
+                                      size_t elements,
+                                      op::SigmoidMultiply::FunctionType input0_type,
+                                      op::SigmoidMultiply::FunctionType input1_type)
+                {
+#pragma omp parallel for simd
+                    for (size_t i = 0; i < elements; i++)
+                    {
+                        float numer_0 = 0, denom_0 = 1, d_numer_0 = 0, d_denom_0 = 1;
+                        float numer_1 = 0, denom_1 = 1, d_numer_1 = 0, d_denom_1 = 1;
+                        sigmoid_mul_func(
+                            input0[i], input0_type, numer_0, denom_0, d_numer_0, d_denom_0);
+                        sigmoid_mul_func(
+                            input1[i], input1_type, numer_1, denom_1, d_numer_1, d_denom_1);
+                        output[i] = (numer_0 * numer_1) / (denom_0 * denom_1);
+                    }
+                }
+
+                void sigmoid_multiply_backprop(float* input0,
+                                               float* input1,
+                                               float* delta,
+                                               float* input0_delta,
+                                               float* input1_delta,
+                                               size_t elements,
+                                               op::SigmoidMultiply::FunctionType input0_type,
+                                               op::SigmoidMultiply::FunctionType input1_type)
+                {
+#pragma omp parallel for simd
+                    for (size_t i = 0; i < elements; i++)
+                    {
+                        float numer_0 = 0, denom_0 = 1, d_numer_0 = 0, d_denom_0 = 1;
+                        float numer_1 = 0, denom_1 = 1, d_numer_1 = 0, d_denom_1 = 1;
+                        sigmoid_mul_func(
+                            input0[i], input0_type, numer_0, denom_0, d_numer_0, d_denom_0);
+                        sigmoid_mul_func(
+                            input1[i], input1_type, numer_1, denom_1, d_numer_1, d_denom_1);
+                        input0_delta[i] = delta[i] * (numer_1 * d_numer_0) / (denom_1 * d_denom_0);
+                        input1_delta[i] = delta[i] * (numer_0 * d_numer_1) / (denom_0 * d_denom_1);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                void sigmoid_multiply(float* input0,
+                                      float* input1,
+                                      float* output,
+                                      size_t elements,
+                                      op::SigmoidMultiply::FunctionType input0_type,
+                                      op::SigmoidMultiply::FunctionType input1_type);
+
+                void sigmoid_multiply_backprop(float* input0,
+                                               float* input1,
+                                               float* delta,
+                                               float* input0_delta,
+                                               float* input1_delta,
+                                               size_t elements,
+                                               op::SigmoidMultiply::FunctionType input0_type,
+                                               op::SigmoidMultiply::FunctionType input1_type);
+            }
+        }
+    }
+}
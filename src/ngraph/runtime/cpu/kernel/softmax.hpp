@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType, unsigned int Rank>
+                void softmax_1rd(void* input, void* output, const Shape& input_shape, size_t axis)
+                {
+                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
+                    Eigen::array<Eigen::Index, 1> axis_dim{{static_cast<Eigen::Index>(axis)}};
+
+                    for (int i = 0; i < Rank; i++)
+                    {
+                        in_dims[i] = rdims[i] = input_shape[i];
+                        bcast[i] = 1;
+                    }
+                    rdims[axis] = 1;
+                    bcast[axis] = input_shape[axis];
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), in_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
+                        static_cast<ElementType*>(input), in_dims);
+
+                    // Subtract the per-slice maximum before exponentiating for stability
+                    out.device(eigen::get_thread_pool_device()) =
+                        (in - in.maximum(axis_dim).eval().reshape(rdims).broadcast(bcast)).exp();
+                    out.device(eigen::get_thread_pool_device()) =
+                        out * out.sum(axis_dim).inverse().eval().reshape(rdims).broadcast(bcast);
+                }
+
+                template <typename ElementType>
+                void ref_softmax(void* input,
+                                 void* output,
+                                 const Shape& input_shape,
+                                 const AxisSet& softmax_axes)
+                {
+                    reference::softmax<ElementType>(static_cast<const ElementType*>(input),
+                                                    static_cast<ElementType*>(output),
+                                                    input_shape,
+                                                    softmax_axes);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/kernel/strided_copy.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace
+                {
+                    struct StridedDim
+                    {
+                        size_t extent;
+                        ptrdiff_t input_step;  // bytes
+                        ptrdiff_t output_step; // bytes
+                    };
+
+                    template <size_t N>
+                    void copy_elements(const char* input,
+                                       char* output,
+                                       size_t count,
+                                       ptrdiff_t input_step,
+                                       ptrdiff_t output_step)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            std::memcpy(output, input, N);
+                            input += input_step;
+                            output += output_step;
+                        }
+                    }
+
+                    void copy_run(const char* input,
+                                  char* output,
+                                  size_t count,
+                                  ptrdiff_t input_step,
+                                  ptrdiff_t output_step,
+                                  size_t element_size)
+                    {
+                        ptrdiff_t dense_step = static_cast<ptrdiff_t>(element_size);
+                        if (input_step == dense_step && output_step == dense_step)
+                        {
+                            std::memcpy(output, input, count * element_size);
+                            return;
+                        }
+                        switch (element_size)
+                        {
+                        case 1:
+                            copy_elements<1>(input, output, count, input_step, output_step);
+                            break;
+                        case 2:
+                            copy_elements<2>(input, output, count, input_step, output_step);
+                            break;
+                        case 4:
+                            copy_elements<4>(input, output, count, input_step, output_step);
+                            break;
+                        case 8:
+                            copy_elements<8>(input, output, count, input_step, output_step);
+                            break;
+                        default:
+                            for (size_t i = 0; i < count; i++)
+                            {
+                                std::memcpy(output, input, element_size);
+                                input += input_step;
+                                output += output_step;
+                            }
+                            break;
+                        }
+                    }
+                }
+
+                void strided_copy(const void* input,
+                                  void* output,
+                                  size_t element_size,
+                                  const Shape& shape,
+                                  const std::vector<ptrdiff_t>& input_strides,
+                                  const std::vector<ptrdiff_t>& output_strides)
+                {
+                    ptrdiff_t element_step = static_cast<ptrdiff_t>(element_size);
+
+                    // Drop unit dimensions and fold each dimension into its outer neighbour
+                    // whenever both tensors walk the pair as a single run.
+                    std::vector<StridedDim> dims;
+                    for (size_t i = 0; i < shape.size(); i++)
+                    {
+                        if (shape[i] == 0)
+                        {
+                            return;
+                        }
+                        if (shape[i] == 1)
+                        {
+                            continue;
+                        }
+                        ptrdiff_t extent = static_cast<ptrdiff_t>(shape[i]);
+                        ptrdiff_t input_step = input_strides[i] * element_step;
+                        ptrdiff_t output_step = output_strides[i] * element_step;
+                        if (!dims.empty() && dims.back().input_step == input_step * extent &&
+                            dims.back().output_step == output_step * extent)
+                        {
+                            dims.back() = {dims.back().extent * shape[i], input_step, output_step};
+                        }
+                        else
+                        {
+                            dims.push_back({shape[i], input_step, output_step});
+                        }
+                    }
+
+                    const char* in = static_cast<const char*>(input);
+                    char* out = static_cast<char*>(output);
+                    if (dims.empty())
+                    {
+                        std::memcpy(out, in, element_size);
+                        return;
+                    }
+
+                    StridedDim inner = dims.back();
+                    dims.pop_back();
+                    size_t rows = 1;
+                    for (const StridedDim& dim : dims)
+                    {
+                        rows *= dim.extent;
+                    }
+
+                    // A single run is split along its length.
+                    if (rows == 1)
+                    {
+                        eigen::parallel_for(
+                            inner.extent, element_size, 1, [&](size_t first, size_t last) {
+                                ptrdiff_t offset = static_cast<ptrdiff_t>(first);
+                                copy_run(in + offset * inner.input_step,
+                                         out + offset * inner.output_step,
+                                         last - first,
+                                         inner.input_step,
+                                         inner.output_step,
+                                         element_size);
+                            });
+                        return;
+                    }
+
+                    auto copy_rows = [&](size_t first, size_t last) {
+                        std::vector<size_t> coord(dims.size());
+                        const char* src = in;
+                        char* dst = out;
+                        size_t index = first;
+                        for (size_t d = dims.size(); d-- > 0;)
+                        {
+                            coord[d] = index % dims[d].extent;
+                            index /= dims[d].extent;
+                            src += static_cast<ptrdiff_t>(coord[d]) * dims[d].input_step;
+                            dst += static_cast<ptrdiff_t>(coord[d]) * dims[d].output_step;
+                        }
+
+                        for (size_t row = first; row < last; row++)
+                        {
+                            copy_run(src,
+                                     dst,
+                                     inner.extent,
+                                     inner.input_step,
+                                     inner.output_step,
+                                     element_size);
+
+                            for (size_t d = dims.size(); d-- > 0;)
+                            {
+                                src += dims[d].input_step;
+                                dst += dims[d].output_step;
+                                if (++coord[d] < dims[d].extent)
+                                {
+                                    break;
+                                }
+                                ptrdiff_t extent = static_cast<ptrdiff_t>(dims[d].extent);
+                                src -= extent * dims[d].input_step;
+                                dst -= extent * dims[d].output_step;
+                                coord[d] = 0;
+                            }
+                        }
+                    };
+                    eigen::parallel_for(rows, inner.extent * element_size, inner.extent, copy_rows);
+                }
+
+                void fill(void* output, const void* value, size_t element_size, size_t count)
+                {
+                    char* out = static_cast<char*>(output);
+                    const char* val = static_cast<const char*>(value);
+                    eigen::parallel_for(count, element_size, 1, [&](size_t first, size_t last) {
+                        if (element_size == 1)
+                        {
+                            std::memset(out + first, *val, last - first);
+                            return;
+                        }
+                        for (size_t i = first; i < last; i++)
+                        {
+                            std::memcpy(out + i * element_size, val, element_size);
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
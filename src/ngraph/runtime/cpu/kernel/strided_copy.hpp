@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// Copies every element of a tensor with the given shape, reading the element at
+                /// coordinate c from input + sum(c[i] * input_strides[i]) and writing it to
+                /// output + sum(c[i] * output_strides[i]). Strides are in elements and may be
+                /// negative. Contiguous dimensions are collapsed before copying and the outer
+                /// dimensions are split across the global thread pool.
+                void strided_copy(const void* input,
+                                  void* output,
+                                  size_t element_size,
+                                  const Shape& shape,
+                                  const std::vector<ptrdiff_t>& input_strides,
+                                  const std::vector<ptrdiff_t>& output_strides);
+
+                /// Writes count copies of the element_size bytes at value to output.
+                void fill(void* output, const void* value, size_t element_size, size_t count);
+            }
+        }
+    }
+}
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "mkldnn_emitter.hpp"
 
@@ -43,6 +44,16 @@ const std::vector<char*>& MKLDNNEmitter::get_mkldnn_workspaces()
     return m_workspace_bufs;
 }
 
+std::vector<size_t> MKLDNNEmitter::get_mkldnn_workspace_sizes() const
+{
+    std::vector<size_t> sizes;
+    for (auto& workspace : m_workspaces)
+    {
+        sizes.push_back(workspace->size);
+    }
+    return sizes;
+}
+
 size_t MKLDNNEmitter::insert_primitive(mkldnn::primitive* primitive)
 {
     m_mkldnn_primitives.emplace_back(primitive);
@@ -61,6 +72,73 @@ const std::vector<size_t>& MKLDNNEmitter::get_primitive_deps(size_t index) const
     return m_primitive_deps.at(index);
 }
 
+size_t MKLDNNEmitter::get_primitive_workspace(size_t index) const
+{
+    return m_primitive_workspaces.at(index);
+}
+
+std::vector<mkldnn::primitive*> MKLDNNEmitter::clone_mkldnn_primitives() const
+{
+    std::vector<mkldnn::primitive*> clones;
+    std::unordered_map<const_mkldnn_primitive_t, const_mkldnn_primitive_t> cloned;
+    // A primitive is only ever built over primitives inserted before it
+    for (auto primitive : m_mkldnn_primitives)
+    {
+        const_mkldnn_primitive_desc_t pd;
+        mkldnn::error::wrap_c_api(mkldnn_primitive_get_primitive_desc(primitive->get(), &pd),
+                                  "could not get the primitive descriptor of a primitive");
+        mkldnn_primitive_kind_t kind;
+        mkldnn::error::wrap_c_api(
+            mkldnn_primitive_desc_query(pd, mkldnn_query_primitive_kind, 0, &kind),
+            "could not query the kind of a primitive");
+
+        std::vector<mkldnn_primitive_at_t> inputs;
+        std::vector<const_mkldnn_primitive_t> outputs;
+        if (kind != mkldnn_memory)
+        {
+            int input_count =
+                mkldnn_primitive_desc_query_s32(pd, mkldnn_query_num_of_inputs_s32, 0);
+            for (int i = 0; i < input_count; i++)
+            {
+                mkldnn_primitive_at_t input;
+                mkldnn::error::wrap_c_api(
+                    mkldnn_primitive_get_input_at(primitive->get(), i, &input),
+                    "could not get an input of a primitive");
+                input.primitive = cloned.at(input.primitive);
+                inputs.push_back(input);
+            }
+            int output_count =
+                mkldnn_primitive_desc_query_s32(pd, mkldnn_query_num_of_outputs_s32, 0);
+            for (int i = 0; i < output_count; i++)
+            {
+                const_mkldnn_primitive_t output;
+                mkldnn::error::wrap_c_api(
+                    mkldnn_primitive_get_output(primitive->get(), i, &output),
+                    "could not get an output of a primitive");
+                outputs.push_back(cloned.at(output));
+            }
+        }
+
+        mkldnn_primitive_t clone;
+        mkldnn::error::wrap_c_api(
+            mkldnn_primitive_create(&clone,
+                                    pd,
+                                    inputs.empty() ? nullptr : inputs.data(),
+                                    outputs.empty() ? nullptr : outputs.data()),
+            "could not clone a primitive");
+        cloned[primitive->get()] = clone;
+        if (kind == mkldnn_memory)
+        {
+            clones.push_back(new mkldnn::memory(mkldnn::primitive(clone)));
+        }
+        else
+        {
+            clones.push_back(new mkldnn::primitive(clone));
+        }
+    }
+    return clones;
+}
+
 mkldnn::memory::desc MKLDNNEmitter::build_memory_descriptor(const TensorViewWrapper& tvw,
                                                             mkldnn::memory::format fmt) const
 {
@@ -503,10 +581,10 @@ size_t MKLDNNEmitter::build_max_pooling_backward(mkldnn::algorithm pooling_algor
         *m_mkldnn_primitives[ws_index],
         *m_mkldnn_primitives[diff_src_index]));
 
-    m_primitive_deps[fwd_primitive_index] = {
-        fprop_src_index, diff_src_index, ws_index, ws_buf_index};
-    m_primitive_deps[bwd_primitive_index] = {
-        diff_dst_index, ws_index, diff_src_index, ws_buf_index};
+    m_primitive_deps[fwd_primitive_index] = {fprop_src_index, diff_src_index, ws_index};
+    m_primitive_deps[bwd_primitive_index] = {diff_dst_index, ws_index, diff_src_index};
+    m_primitive_workspaces[fwd_primitive_index] = ws_buf_index;
+    m_primitive_workspaces[bwd_primitive_index] = ws_buf_index;
     return bwd_primitive_index;
 }
 
@@ -40,8 +40,13 @@ namespace ngraph
             class MKLDNNWorkspace
             {
             public:
-                MKLDNNWorkspace(size_t size) { buf = reinterpret_cast<char*>(malloc(size)); }
+                MKLDNNWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(malloc(size));
+                }
                 ~MKLDNNWorkspace() { free(buf); }
+                size_t size;
                 char* buf;
             };
 
@@ -53,10 +58,18 @@ namespace ngraph
 
                 const std::vector<mkldnn::primitive*>& get_mkldnn_primitives() const;
                 const std::vector<char*>& get_mkldnn_workspaces();
+                std::vector<size_t> get_mkldnn_workspace_sizes() const;
 
                 size_t insert_primitive(mkldnn::primitive* primitive);
                 size_t insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace);
                 const std::vector<size_t>& get_primitive_deps(size_t index) const;
+                size_t get_primitive_workspace(size_t index) const;
+
+                // Builds a copy of every primitive for a runtime context of its own. Memory
+                // primitives get fresh data handles and every other primitive is rebuilt
+                // over the copies of the memory primitives it was built over, so contexts
+                // can bind their buffers and execute primitives concurrently.
+                std::vector<mkldnn::primitive*> clone_mkldnn_primitives() const;
 
                 // TODO(jmenon): Get rid of TensorViewWrappers at some point
                 mkldnn::memory::desc build_memory_descriptor(const TensorViewWrapper& tvw,
@@ -239,6 +252,7 @@ namespace ngraph
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
                 std::unordered_map<size_t, std::vector<size_t>> m_primitive_deps;
+                std::unordered_map<size_t, size_t> m_primitive_workspaces;
                 std::vector<std::unique_ptr<MKLDNNWorkspace>> m_workspaces;
                 std::vector<char*> m_workspace_bufs;
             };
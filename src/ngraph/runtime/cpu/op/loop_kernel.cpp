@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <unordered_map>
+
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::LoopKernel::LoopKernel(const NodeVector& nodes, const NodeVector& args)
+    : LoopKernel(nodes, args, args)
+{
+}
+
+op::LoopKernel::LoopKernel(const NodeVector& nodes,
+                           const NodeVector& inputs,
+                           const NodeVector& args)
+    : RequiresTensorViewArgs("LoopKernel", args)
+{
+    if (nodes.empty())
+    {
+        throw ngraph_error("LoopKernel requires at least one op");
+    }
+
+    // Clone the ops onto parameters of their own, where inputs[i] is the value that
+    // parameter i stands in for
+    unordered_map<const Node*, shared_ptr<Node>> node_map;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto parameter =
+            make_shared<op::Parameter>(args[i]->get_element_type(), args[i]->get_shape());
+        m_parameters.push_back(parameter);
+        node_map[inputs.at(i).get()] = parameter;
+    }
+    for (const shared_ptr<Node>& node : nodes)
+    {
+        NodeVector new_args;
+        for (const shared_ptr<Node>& arg : node->get_arguments())
+        {
+            auto it = node_map.find(arg.get());
+            if (it == node_map.end())
+            {
+                throw ngraph_error("LoopKernel op " + node->get_name() + " reads " +
+                                   arg->get_name() + ", which is neither fused nor an argument");
+            }
+            new_args.push_back(it->second);
+        }
+        auto new_node = node->copy_with_new_args(new_args);
+        node_map[node.get()] = new_node;
+        m_nodes.push_back(new_node);
+    }
+
+    add_output(m_nodes.back()->get_element_type(), m_nodes.back()->get_shape());
+}
+
+shared_ptr<Node> op::LoopKernel::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != m_parameters.size())
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    NodeVector inputs;
+    for (const shared_ptr<op::Parameter>& parameter : m_parameters)
+    {
+        inputs.push_back(parameter);
+    }
+    return shared_ptr<Node>(new LoopKernel(m_nodes, inputs, new_args));
+}
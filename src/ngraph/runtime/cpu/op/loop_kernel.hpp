@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/op/parameter_vector.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A connected group of same-shape elementwise ops computed in a single loop.
+        ///
+        /// The fused ops are kept as a private graph over one Parameter per argument, so their
+        /// intermediate values never become tensors of the enclosing function.
+        class LoopKernel : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a LoopKernel operation.
+            ///
+            /// \param nodes The fused ops in topological order. The last op produces the
+            ///              result; every other op is used only within the kernel.
+            /// \param args Values read by the fused ops that are computed outside the kernel.
+            LoopKernel(const NodeVector& nodes, const NodeVector& args);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            /// \return The fused ops, in the order they are computed
+            const NodeVector& get_nodes() const { return m_nodes; }
+            /// \return The parameters of the fused graph, one per argument of the kernel
+            const ParameterVector& get_parameters() const { return m_parameters; }
+        private:
+            LoopKernel(const NodeVector& nodes, const NodeVector& inputs, const NodeVector& args);
+
+            NodeVector m_nodes;
+            ParameterVector m_parameters;
+        };
+    }
+}
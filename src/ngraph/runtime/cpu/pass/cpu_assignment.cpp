@@ -31,7 +31,9 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/maximum.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -42,6 +44,7 @@
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -67,15 +70,33 @@ namespace ngraph
 
                     // insert Add as MKLDNN op, only if the src_size is big. this is to avoid MKLDNN overhead
                     // for smaller tensor sizes
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
                     if (node->get_input_element_type(0) == element::f32 &&
                         node->get_input_element_type(1) == element::f32 && arg0_rank == 4 &&
                         arg1_rank == 4 && src_size > 64000)
                     {
-                        auto op_annotations =
-                            std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
                         op_annotations->set_mkldnn_op(true);
-                        add->set_op_annotations(op_annotations);
+                        // MKLDNN sum only runs in place on its first source
+                        op_annotations->add_in_place_oi_pair({0, 0, true});
+                    }
+                    else
+                    {
+                        op_annotations->add_in_place_oi_pair({0, 0, true});
+                        op_annotations->add_in_place_oi_pair({0, 1, true});
                     }
+                    add->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::Maximum)
+                {
+                    auto max = static_cast<op::Maximum*>(node);
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    op_annotations->add_in_place_oi_pair({0, 1, true});
+                    max->set_op_annotations(op_annotations);
                 }
 
                 template <>
@@ -446,26 +467,56 @@ namespace ngraph
                     auto arg0_rank = arg0_shape.size();
                     auto result_shape = node->get_output_shape(0);
 
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
                     if ((arg0_rank == 4 || arg0_rank == 2) &&
                         node->get_input_element_type(0) == element::f32)
                     {
-                        auto op_annotations =
-                            std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
                         op_annotations->set_mkldnn_op(true);
-                        relu->set_op_annotations(op_annotations);
                     }
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    relu->set_op_annotations(op_annotations);
                 }
 
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::Sigmoid)
                 {
                     auto sigmoid = static_cast<op::Sigmoid*>(node);
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
                     if (node->get_input_element_type(0) == element::f32)
+                    {
+                        op_annotations->set_mkldnn_op(true);
+                    }
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    sigmoid->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SigmoidMultiply)
+                {
+                    auto sigmoid_mul = static_cast<op::SigmoidMultiply*>(node);
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    op_annotations->add_in_place_oi_pair({0, 1, true});
+                    sigmoid_mul->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::Reshape)
+                {
+                    auto reshape = static_cast<op::Reshape*>(node);
+                    auto input_order = reshape->get_input_order();
+
+                    // Without a transpose the result is the argument's data under a new shape,
+                    // so it can be a view of the argument's buffer
+                    if (is_sorted(input_order.begin(), input_order.end()))
                     {
                         auto op_annotations =
                             std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
-                        op_annotations->set_mkldnn_op(true);
-                        sigmoid->set_op_annotations(op_annotations);
+                        op_annotations->add_in_place_oi_pair({0, 0, false});
+                        reshape->set_op_annotations(op_annotations);
                     }
                 }
 
@@ -586,6 +637,7 @@ namespace ngraph
 static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::Add), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Add>},
     {TI(ngraph::op::Concat), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Concat>},
+    {TI(ngraph::op::Maximum), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Maximum>},
     {TI(ngraph::op::AvgPool), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AvgPool>},
     {TI(ngraph::op::AvgPoolBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AvgPoolBackprop>},
@@ -621,6 +673,9 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::ReluBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ReluBackprop>},
     {TI(ngraph::op::Sigmoid), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Sigmoid>},
+    {TI(ngraph::op::SigmoidMultiply),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SigmoidMultiply>},
+    {TI(ngraph::op::Reshape), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Reshape>},
     {TI(ngraph::op::SigmoidBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SigmoidBackprop>},
     {TI(ngraph::op::Lstm), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Lstm>},
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <list>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_emitters.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+#include "cpu_loop_kernel_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Tensors of this rank may be kept in MKLDNN blocked layouts, which a LoopKernel would have to
+// convert back to the native layout first
+static const size_t s_mkldnn_layout_rank = 4;
+
+static bool is_fusible(const shared_ptr<Node>& node)
+{
+    return runtime::cpu::kernel::is_elementwise_expression(*node) &&
+           node->get_output_size() == 1 &&
+           (node->get_element_type() == element::f32 ||
+            node->get_element_type() == element::f64) &&
+           node->get_shape().size() != s_mkldnn_layout_rank;
+}
+
+bool runtime::cpu::pass::CPULoopKernelFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool clobbered = false;
+
+    list<shared_ptr<Node>> ordered_ops = function->get_ordered_ops();
+    unordered_map<Node*, size_t> position;
+    for (const shared_ptr<Node>& node : ordered_ops)
+    {
+        position.insert({node.get(), position.size()});
+    }
+
+    unordered_set<Node*> fused;
+    // Visit consumers before their producers so that every group is grown from its root
+    for (auto it = ordered_ops.rbegin(); it != ordered_ops.rend(); ++it)
+    {
+        shared_ptr<Node> root = *it;
+        if (fused.count(root.get()) != 0 || !is_fusible(root))
+        {
+            continue;
+        }
+
+        // Pull in producers whose users are all in the group, latest first, so that every
+        // user of a candidate has been decided on before the candidate itself
+        auto later = [&position](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+            return position.at(a.get()) < position.at(b.get());
+        };
+        priority_queue<shared_ptr<Node>, vector<shared_ptr<Node>>, decltype(later)> candidates(
+            later);
+        unordered_set<Node*> group{root.get()};
+        NodeVector nodes{root};
+        for (const shared_ptr<Node>& arg : root->get_arguments())
+        {
+            candidates.push(arg);
+        }
+        while (!candidates.empty())
+        {
+            shared_ptr<Node> node = candidates.top();
+            candidates.pop();
+            if (group.count(node.get()) != 0 || fused.count(node.get()) != 0 ||
+                !is_fusible(node) || node->get_shape() != root->get_shape() ||
+                node->get_element_type() != root->get_element_type())
+            {
+                continue;
+            }
+            bool internal = true;
+            for (const shared_ptr<Node>& user : node->get_users())
+            {
+                internal = internal && group.count(user.get()) != 0;
+            }
+            if (!internal)
+            {
+                continue;
+            }
+            group.insert(node.get());
+            nodes.push_back(node);
+            for (const shared_ptr<Node>& arg : node->get_arguments())
+            {
+                candidates.push(arg);
+            }
+        }
+        if (nodes.size() < 2)
+        {
+            continue;
+        }
+        reverse(nodes.begin(), nodes.end());
+
+        NodeVector args;
+        unordered_set<Node*> arg_set;
+        size_t unfused_tensors = 0;
+        for (const shared_ptr<Node>& node : nodes)
+        {
+            unfused_tensors += node->get_input_size() + 1;
+            for (const shared_ptr<Node>& arg : node->get_arguments())
+            {
+                if (group.count(arg.get()) == 0 && arg_set.insert(arg.get()).second)
+                {
+                    args.push_back(arg);
+                }
+            }
+        }
+
+        // Separately each op reads its inputs and writes its output; the kernel reads each
+        // argument once and writes only the result
+        size_t tensor_bytes = shape_size(root->get_shape()) * root->get_element_type().size();
+        size_t fused_tensors = args.size() + 1;
+        if (unfused_tensors <= fused_tensors)
+        {
+            continue;
+        }
+        size_t bytes_saved = (unfused_tensors - fused_tensors) * tensor_bytes;
+
+        auto kernel = make_shared<op::LoopKernel>(nodes, args);
+        NGRAPH_DEBUG << "LoopKernel " << kernel->get_name() << " fuses " << nodes.size()
+                     << " ops rooted at " << root->get_name() << ", saving " << bytes_saved
+                     << " bytes per call";
+        replace_node(root, kernel);
+        fused.insert(group.begin(), group.end());
+        m_bytes_saved += bytes_saved;
+        clobbered = true;
+    }
+
+    if (clobbered)
+    {
+        NGRAPH_DEBUG << "Loop kernel fusion saves " << m_bytes_saved << " bytes per call in total";
+    }
+    return clobbered;
+}
@@ -0,0 +1,53 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Collapses connected same-shape elementwise subgraphs into LoopKernel
+                /// ops, which the emitter computes in one loop with the intermediates in
+                /// registers.
+                ///
+                /// Elementwise ops are bound by memory bandwidth, so a group is only fused
+                /// when it moves fewer bytes than its ops do separately. Intermediates used
+                /// outside their group are never recomputed.
+                class CPULoopKernelFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPULoopKernelFusion()
+                        : m_bytes_saved(0)
+                    {
+                    }
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                    /// \return Memory traffic removed by the kernels fused so far, in bytes
+                    size_t get_bytes_saved() const { return m_bytes_saved; }
+                private:
+                    size_t m_bytes_saved;
+                };
+            }
+        }
+    }
+}
@@ -28,6 +28,11 @@ extern "C" void create_backend()
     runtime::Backend::register_backend("GPU", make_shared<runtime::gpu::GPU_Backend>());
 };
 
+runtime::gpu::GPU_Backend::~GPU_Backend()
+{
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::gpu::GPU_CallFrame> runtime::gpu::GPU_Backend::make_call_frame(
     const shared_ptr<GPU_ExternalFunction>& external_function)
 {
@@ -35,6 +35,8 @@ namespace ngraph
             class GPU_Backend : public Backend
             {
             public:
+                ~GPU_Backend() override;
+
                 std::shared_ptr<ngraph::runtime::gpu::GPU_CallFrame> make_call_frame(
                     const std::shared_ptr<ngraph::runtime::gpu::GPU_ExternalFunction>&
                         external_function);
@@ -22,6 +22,7 @@
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -35,6 +36,11 @@ extern "C" void create_backend()
                                        make_shared<runtime::interpreter::INTBackend>());
 };
 
+runtime::interpreter::INTBackend::~INTBackend()
+{
+    wait_for_async_calls();
+}
+
 shared_ptr<runtime::TensorView>
     runtime::interpreter::INTBackend::create_tensor(const element::Type& type, const Shape& shape)
 {
@@ -49,116 +55,113 @@ shared_ptr<runtime::TensorView> runtime::interpreter::INTBackend::create_tensor(
 
 bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
 {
-    FunctionInstance& instance = m_function_map[function];
-    if (!instance.m_is_compiled)
+    shared_ptr<FunctionInstance> instance;
     {
-        instance.m_is_compiled = true;
-        pass::Manager pass_manager;
-        pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
-        pass_manager.register_pass<pass::Liveness>();
-        pass_manager.run_passes(function);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance = get_instance(function);
     }
-
+    lock_guard<mutex> call_lock(instance->m_call_mutex);
+    compile_instance(function, *instance);
     return true;
 }
 
-bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
-                                            const vector<shared_ptr<runtime::TensorView>>& outputs,
-                                            const vector<shared_ptr<runtime::TensorView>>& inputs)
+const shared_ptr<runtime::interpreter::INTBackend::FunctionInstance>&
+    runtime::interpreter::INTBackend::get_instance(shared_ptr<Function> function)
 {
-    validate_call(function, outputs, inputs);
-
-    compile(function);
-    FunctionInstance& instance = m_function_map[function];
-
-    // convert inputs to HostTensorView
-    vector<shared_ptr<runtime::HostTensorView>> func_inputs;
-    for (auto tv : inputs)
+    shared_ptr<FunctionInstance>& instance = m_function_map[function];
+    if (instance == nullptr)
     {
-        func_inputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
-    }
-    if (instance.m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
+        instance = make_shared<FunctionInstance>();
     }
+    return instance;
+}
 
-    // convert outputs to HostTensorView
-    vector<shared_ptr<runtime::HostTensorView>> func_outputs;
-    for (auto tv : outputs)
+void runtime::interpreter::INTBackend::compile_instance(shared_ptr<Function> function,
+                                                        FunctionInstance& instance)
+{
+    if (!instance.m_is_compiled)
     {
-        func_outputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(runtime::alignment);
+        pass_manager.run_passes(function);
+
+        build_execution_plan(function, instance);
+        instance.m_is_compiled = true;
     }
+}
+
+void runtime::interpreter::INTBackend::build_execution_plan(const shared_ptr<Function>& function,
+                                                            FunctionInstance& instance)
+{
+    static const unordered_map<string, OP_TYPEID> typeid_map{
+#define NGRAPH_OP(a) {#a, OP_TYPEID::a},
+#include "ngraph/runtime/interpreter/int_op_tbl.hpp"
+#undef NGRAPH_OP
+    };
 
-    // map function params -> HostTensorView
-    unordered_map<descriptor::TensorView*, shared_ptr<runtime::HostTensorView>> tensor_map;
-    size_t input_count = 0;
+    // Parameters and results are bound to the caller's tensors on each call
+    unordered_map<const descriptor::Tensor*, size_t> input_index;
     for (auto param : function->get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::TensorView* tv = param->get_output_tensor_view(i).get();
-            tensor_map.insert({tv, func_inputs[input_count++]});
+            input_index.insert({&param->get_output_tensor(i), input_index.size()});
         }
     }
-
-    // map function outputs -> HostTensorView
-    for (size_t output_count = 0; output_count < function->get_output_size(); ++output_count)
+    unordered_map<const descriptor::Tensor*, size_t> output_index;
+    for (size_t i = 0; i < function->get_output_size(); ++i)
     {
-        auto output = function->get_output_op(output_count);
+        auto output = function->get_output_op(i);
         if (!dynamic_pointer_cast<op::Result>(output))
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::TensorView* tv = output->get_output_tensor_view(0).get();
-        tensor_map.insert({tv, func_outputs[output_count]});
+        output_index.insert({&output->get_output_tensor(0), i});
     }
 
-    // for each ordered op in the graph
+    instance.m_steps.clear();
+    instance.m_input_bindings.clear();
+    instance.m_output_bindings.clear();
+    instance.m_temporary_pool.reset(
+        new AlignedBuffer(function->get_temporary_pool_size(), runtime::alignment));
+    char* pool = static_cast<char*>(instance.m_temporary_pool->get_ptr());
+
+    unordered_map<const descriptor::Tensor*, shared_ptr<HostTensorView>> tensor_map;
     for (shared_ptr<Node> op : function->get_ordered_ops())
     {
-        if (op->description() == "Parameter")
+        if (op->is_parameter())
         {
             continue;
         }
 
-        // get op inputs from map
-        vector<shared_ptr<runtime::HostTensorView>> op_inputs;
-        for (const descriptor::Input& input : op->get_inputs())
+        // Constants are read in place, so they have no step
+        if (auto constant = dynamic_pointer_cast<op::Constant>(op))
         {
-            descriptor::TensorView* tv = input.get_output().get_tensor_view().get();
-            op_inputs.push_back(tensor_map.at(tv));
+            descriptor::Tensor& tensor = constant->get_output_tensor(0);
+            void* data = const_cast<void*>(constant->get_data_ptr());
+            tensor_map.insert({&tensor,
+                               make_shared<HostTensorView>(constant->get_element_type(),
+                                                           constant->get_shape(),
+                                                           data,
+                                                           tensor.get_name())});
+            continue;
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<runtime::HostTensorView>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
+        auto it = typeid_map.find(op->description());
+        if (it == typeid_map.end())
         {
-            descriptor::TensorView* tv = op->get_output_tensor_view(i).get();
-            shared_ptr<runtime::HostTensorView> htv;
-            if (!contains_key(tensor_map, tv))
-            {
-                // the output tensor is not in the tensor map so create a new tensor
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->get_output_tensor(i).get_name();
-                htv = make_shared<runtime::HostTensorView>(type, shape, name);
-                tensor_map.insert({tv, htv});
-            }
-            else
-            {
-                htv = tensor_map.at(tv);
-            }
-            op_outputs.push_back(htv);
+            throw ngraph_error("unsupported op " + op->description());
         }
 
-        // get op type
+        // The dispatch type is the type of the second input for BinaryElementwiseComparison
+        // and Select (Select has bool for the first input), the input type for Convert and
+        // the output type otherwise
         element::Type type;
         if (dynamic_pointer_cast<op::util::BinaryElementwiseComparison>(op) ||
             dynamic_pointer_cast<op::Select>(op))
         {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
             type = op->get_inputs().at(1).get_tensor().get_element_type();
         }
         else if (dynamic_pointer_cast<op::Convert>(op))
@@ -170,86 +173,167 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             type = op->get_outputs().at(0).get_element_type();
         }
 
+        size_t step_index = instance.m_steps.size();
+        instance.m_steps.push_back({op, it->second, get_kernel(type, *op), {}, {}});
+        ExecutionStep& step = instance.m_steps.back();
+
+        for (const descriptor::Input& input : op->get_inputs())
+        {
+            const descriptor::Tensor* tensor = &input.get_tensor();
+            auto index = input_index.find(tensor);
+            if (index != input_index.end())
+            {
+                instance.m_input_bindings.push_back(
+                    {step_index, step.m_inputs.size(), index->second});
+                step.m_inputs.push_back(nullptr);
+            }
+            else
+            {
+                step.m_inputs.push_back(tensor_map.at(tensor));
+            }
+        }
+
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            descriptor::Tensor* tensor = &op->get_output_tensor(i);
+            auto index = output_index.find(tensor);
+            if (index != output_index.end())
+            {
+                instance.m_output_bindings.push_back({step_index, i, index->second});
+                step.m_outputs.push_back(nullptr);
+                continue;
+            }
+
+            // Intermediates live in the pool at the offset MemoryLayout assigned them, any
+            // other tensor gets a buffer of its own
+            void* data = nullptr;
+            if (contains(op->liveness_new_list, tensor))
+            {
+                data = pool + tensor->get_pool_offset();
+            }
+            auto htv = make_shared<HostTensorView>(
+                op->get_output_element_type(i), op->get_output_shape(i), data, tensor->get_name());
+            tensor_map.insert({tensor, htv});
+            step.m_outputs.push_back(htv);
+        }
+    }
+}
+
+bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
+                                            const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                            const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    validate_call(function, outputs, inputs);
+
+    shared_ptr<FunctionInstance> instance_ptr;
+    {
+        // Only the lookup holds the map lock, so calls and compiles of different functions
+        // run concurrently. The call holds the instance in case it is removed meanwhile.
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance_ptr = get_instance(function);
+    }
+    FunctionInstance& instance = *instance_ptr;
+    lock_guard<mutex> call_lock(instance.m_call_mutex);
+    compile_instance(function, instance);
+
+    if (instance.m_nan_check_enabled)
+    {
+        vector<shared_ptr<runtime::HostTensorView>> func_inputs;
+        for (auto tv : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
+        }
+        perform_nan_check(func_inputs);
+    }
+
+    for (const TensorBinding& binding : instance.m_input_bindings)
+    {
+        instance.m_steps[binding.m_step].m_inputs[binding.m_slot] =
+            static_pointer_cast<runtime::HostTensorView>(inputs[binding.m_index]);
+    }
+    for (const TensorBinding& binding : instance.m_output_bindings)
+    {
+        instance.m_steps[binding.m_step].m_outputs[binding.m_slot] =
+            static_pointer_cast<runtime::HostTensorView>(outputs[binding.m_index]);
+    }
+
+    for (ExecutionStep& step : instance.m_steps)
+    {
         if (instance.m_performance_counters_enabled)
         {
-            instance.m_timer_map[op.get()].start();
+            instance.m_timer_map[step.m_node].start();
         }
-        generate_calls(type, *op, op_outputs, op_inputs);
+        (this->*step.m_kernel)(*step.m_node, step.m_op_id, step.m_outputs, step.m_inputs);
         if (instance.m_performance_counters_enabled)
         {
-            instance.m_timer_map[op.get()].stop();
+            instance.m_timer_map[step.m_node].stop();
         }
         if (instance.m_nan_check_enabled)
         {
-            perform_nan_check(op_outputs, op.get());
+            perform_nan_check(step.m_outputs, step.m_node.get());
         }
+    }
 
-        // delete any obsolete tensors
-        for (const descriptor::Tensor* t : op->liveness_free_list)
-        {
-            for (auto it = tensor_map.begin(); it != tensor_map.end(); ++it)
-            {
-                if (it->second->get_tensor().get_name() == t->get_name())
-                {
-                    tensor_map.erase(it);
-                    break;
-                }
-            }
-        }
+    // Don't hold on to the caller's tensors between calls
+    for (const TensorBinding& binding : instance.m_input_bindings)
+    {
+        instance.m_steps[binding.m_step].m_inputs[binding.m_slot] = nullptr;
+    }
+    for (const TensorBinding& binding : instance.m_output_bindings)
+    {
+        instance.m_steps[binding.m_step].m_outputs[binding.m_slot] = nullptr;
     }
 
     return true;
 }
 
-void runtime::interpreter::INTBackend::generate_calls(
-    const element::Type& type,
-    Node& op,
-    const vector<shared_ptr<HostTensorView>>& outputs,
-    const vector<shared_ptr<HostTensorView>>& inputs)
+runtime::interpreter::INTBackend::Kernel
+    runtime::interpreter::INTBackend::get_kernel(const element::Type& type, const Node& op)
 {
+    Kernel kernel;
     if (type == element::boolean)
     {
-        op_engine<char>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<char>;
     }
     else if (type == element::f32)
     {
-        op_engine<float>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<float>;
     }
     else if (type == element::f64)
     {
-        op_engine<double>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<double>;
     }
     else if (type == element::i8)
     {
-        op_engine<int8_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int8_t>;
     }
     else if (type == element::i16)
     {
-        op_engine<int16_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int16_t>;
     }
     else if (type == element::i32)
     {
-        op_engine<int32_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int32_t>;
     }
     else if (type == element::i64)
     {
-        op_engine<int64_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int64_t>;
     }
     else if (type == element::u8)
     {
-        op_engine<uint8_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint8_t>;
     }
     else if (type == element::u16)
     {
-        op_engine<uint16_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint16_t>;
     }
     else if (type == element::u32)
     {
-        op_engine<uint32_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint32_t>;
     }
     else if (type == element::u64)
     {
-        op_engine<uint64_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint64_t>;
     }
     else
     {
@@ -257,27 +341,97 @@ void runtime::interpreter::INTBackend::generate_calls(
         ss << "unsupported element type " << type << " op " << op.get_name();
         throw ngraph_error(ss.str());
     }
+    return kernel;
+}
+
+void runtime::interpreter::INTBackend::remove_compiled_function(shared_ptr<Function> func)
+{
+    Backend::remove_compiled_function(func);
+    lock_guard<mutex> lock(m_function_map_mutex);
+    m_function_map.erase(func);
 }
 
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
-    FunctionInstance& instance = m_function_map[func];
-    instance.m_nan_check_enabled = enable;
+    shared_ptr<FunctionInstance> instance;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance = get_instance(func);
+    }
+    lock_guard<mutex> call_lock(instance->m_call_mutex);
+    instance->m_nan_check_enabled = enable;
+}
+
+void runtime::interpreter::INTBackend::set_thread_count(size_t thread_count)
+{
+    shared_ptr<ThreadPool> thread_pool;
+    if (thread_count > 1)
+    {
+        thread_pool = make_shared<ThreadPool>(thread_count);
+    }
+    lock_guard<mutex> lock(m_thread_pool_mutex);
+    m_thread_pool.swap(thread_pool);
+}
+
+void runtime::interpreter::INTBackend::parallel_slabs(size_t extent,
+                                                      size_t work,
+                                                      const function<void(size_t, size_t)>& kernel)
+{
+    shared_ptr<ThreadPool> thread_pool;
+    if (work >= s_min_parallel_work)
+    {
+        lock_guard<mutex> lock(m_thread_pool_mutex);
+        thread_pool = m_thread_pool;
+    }
+    if (thread_pool)
+    {
+        thread_pool->parallel_for(extent, kernel);
+    }
+    else
+    {
+        kernel(0, extent);
+    }
+}
+
+Shape runtime::interpreter::INTBackend::slab_shape(const Shape& shape,
+                                                   size_t axis,
+                                                   size_t begin,
+                                                   size_t end)
+{
+    Shape slab = shape;
+    slab.at(axis) = end - begin;
+    return slab;
+}
+
+size_t runtime::interpreter::INTBackend::slab_offset(const Shape& shape, size_t axis, size_t begin)
+{
+    return begin * shape_size(Shape(shape.begin() + axis + 1, shape.end()));
 }
 
 void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Function> func,
                                                                bool enable)
 {
-    FunctionInstance& instance = m_function_map[func];
-    instance.m_performance_counters_enabled = enable;
+    shared_ptr<FunctionInstance> instance;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance = get_instance(func);
+    }
+    lock_guard<mutex> call_lock(instance->m_call_mutex);
+    instance->m_performance_counters_enabled = enable;
 }
 
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTBackend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
-    const FunctionInstance& instance = m_function_map.at(func);
-    for (const pair<const Node*, stopwatch> p : instance.m_timer_map)
+    shared_ptr<FunctionInstance> instance_ptr;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        instance_ptr = m_function_map.at(func);
+    }
+    const FunctionInstance& instance = *instance_ptr;
+    lock_guard<mutex> call_lock(instance.m_call_mutex);
+    for (const auto& p : instance.m_timer_map)
     {
         rc.emplace_back(p.first->get_name().c_str(),
                         p.second.get_total_microseconds(),
@@ -17,13 +17,16 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor_view.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/batch_norm.hpp"
@@ -124,12 +127,21 @@ namespace ngraph
         namespace interpreter
         {
             class INTBackend;
+
+            enum class OP_TYPEID
+            {
+#define NGRAPH_OP(a) a,
+#include "ngraph/runtime/interpreter/int_op_tbl.hpp"
+#undef NGRAPH_OP
+            };
         }
     }
 }
 class ngraph::runtime::interpreter::INTBackend : public Backend
 {
 public:
+    ~INTBackend() override;
+
     std::shared_ptr<TensorView>
         create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
 
@@ -142,103 +154,189 @@ public:
               const std::vector<std::shared_ptr<TensorView>>& outputs,
               const std::vector<std::shared_ptr<TensorView>>& intputs) override;
 
+    // Calls are serialized by m_call_mutex
+    bool supports_concurrent_calls() const override { return true; }
+
+    void remove_compiled_function(std::shared_ptr<Function> func) override;
+
     void set_nan_check(std::shared_ptr<Function> func, bool);
 
+    /// Splits the outer output axis of the heavy kernels (convolution, pooling, dot,
+    /// reductions, softmax and broadcast) over thread_count threads. Every output element is
+    /// computed as on a single thread, so results don't depend on the thread count. May be
+    /// called while calls run; kernels already running finish on the previous pool.
+    void set_thread_count(size_t thread_count);
+
     void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
     std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const override;
 
 private:
+    using Kernel = void (INTBackend::*)(Node&,
+                                        OP_TYPEID,
+                                        const std::vector<std::shared_ptr<HostTensorView>>&,
+                                        const std::vector<std::shared_ptr<HostTensorView>>&);
+
+    /// An op of a compiled function with its kernel and argument tensors resolved. The plan
+    /// holds its ops, so it stays valid if the function's graph is rewritten after compile.
+    struct ExecutionStep
+    {
+        std::shared_ptr<Node> m_node;
+        OP_TYPEID m_op_id;
+        Kernel m_kernel;
+        std::vector<std::shared_ptr<HostTensorView>> m_outputs;
+        std::vector<std::shared_ptr<HostTensorView>> m_inputs;
+    };
+
+    /// An argument slot of m_step that takes the caller's tensor number m_index on each call
+    struct TensorBinding
+    {
+        size_t m_step;
+        size_t m_slot;
+        size_t m_index;
+    };
+
     class FunctionInstance
     {
     public:
+        /// Serializes the compile and the calls, which bind the caller's tensors into the
+        /// shared m_steps, and guards the settings below
+        mutable std::mutex m_call_mutex;
         bool m_is_compiled = false;
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
-        std::unordered_map<const Node*, stopwatch> m_timer_map;
+        std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
+
+        /// Holds every intermediate tensor at the offset MemoryLayout assigned it
+        std::unique_ptr<AlignedBuffer> m_temporary_pool;
+        std::vector<ExecutionStep> m_steps;
+        std::vector<TensorBinding> m_input_bindings;
+        std::vector<TensorBinding> m_output_bindings;
     };
-    std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+    /// Calls copy their instance out of the map, so that removing it from the map doesn't free
+    /// it under a running call
+    std::map<std::shared_ptr<Function>, std::shared_ptr<FunctionInstance>> m_function_map;
+    mutable std::mutex m_function_map_mutex;
+
+    /// The instance of function, created if there is none. The caller holds the map lock.
+    const std::shared_ptr<FunctionInstance>& get_instance(std::shared_ptr<Function> function);
+    /// The caller holds the instance's call lock
+    void compile_instance(std::shared_ptr<Function> function, FunctionInstance& instance);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensorView>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        Node& op,
-                        const std::vector<std::shared_ptr<HostTensorView>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensorView>>& inputs);
+    static void build_execution_plan(const std::shared_ptr<Function>& function,
+                                     FunctionInstance& instance);
+
+    static Kernel get_kernel(const element::Type& type, const Node& op);
+
+    /// Kernels hold the pool while they run on it, so set_thread_count can replace it
+    std::shared_ptr<ThreadPool> m_thread_pool;
+    std::mutex m_thread_pool_mutex;
+
+    /// Calls kernel(begin, end) on slabs that cover [0, extent), in parallel when there is a
+    /// thread pool and the kernel touches at least s_min_parallel_work elements
+    void parallel_slabs(size_t extent,
+                        size_t work,
+                        const std::function<void(size_t, size_t)>& kernel);
+    static const size_t s_min_parallel_work = 1 << 15;
+
+    /// The shape of the slab [begin, end) of axis
+    static Shape slab_shape(const Shape& shape, size_t axis, size_t begin, size_t end);
+    /// The element offset of the slab starting at begin on axis, which is only contiguous if
+    /// all axes before axis have extent 1
+    static size_t slab_offset(const Shape& shape, size_t axis, size_t begin);
 
     template <typename T>
     void op_engine(Node& node,
+                   OP_TYPEID op_id,
                    const std::vector<std::shared_ptr<HostTensorView>>& out,
                    const std::vector<std::shared_ptr<HostTensorView>>& args)
     {
-        std::string node_op = node.description();
-        if (node_op == "Abs")
+        switch (op_id)
+        {
+        case OP_TYPEID::Abs:
         {
             reference::abs<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Acos")
+        case OP_TYPEID::Acos:
         {
             reference::acos<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Add")
+        case OP_TYPEID::Add:
         {
             reference::add<T>(args[0]->get_data_ptr<T>(),
                               args[1]->get_data_ptr<T>(),
                               out[0]->get_data_ptr<T>(),
                               out[0]->get_element_count());
+            break;
         }
 #ifdef NGRAPH_DISTRIBUTED
-        else if (node_op == "AllReduce")
+        case OP_TYPEID::AllReduce:
         {
             reference::allreduce<T>(args[0]->get_data_ptr<T>(),
                                     out[0]->get_data_ptr<T>(),
                                     args[0]->get_element_type(),
                                     static_cast<int>(args[0]->get_element_count()));
+            break;
         }
 #endif
-        else if (node_op == "And")
+        case OP_TYPEID::And:
         {
             reference::logical_and(args[0]->get_data_ptr<char>(),
                                    args[1]->get_data_ptr<char>(),
                                    out[0]->get_data_ptr<char>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Asin")
+        case OP_TYPEID::Asin:
         {
             reference::asin<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Atan")
+        case OP_TYPEID::Atan:
         {
             reference::atan<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "AvgPool")
+        case OP_TYPEID::AvgPool:
         {
             op::AvgPool* avg_pool = dynamic_cast<op::AvgPool*>(&node);
-
-            reference::avg_pool<T>(args[0]->get_data_ptr<T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   args[0]->get_shape(),
-                                   out[0]->get_shape(),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
-        }
-        else if (node_op == "GetOutputElement")
+            const Shape& arg_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            // Split the batch, or the channels of a single image
+            size_t axis = out_shape[0] == 1 ? 1 : 0;
+            parallel_slabs(out_shape[axis], shape_size(arg_shape), [&](size_t begin, size_t end) {
+                reference::avg_pool<T>(
+                    args[0]->get_data_ptr<T>() + slab_offset(arg_shape, axis, begin),
+                    out[0]->get_data_ptr<T>() + slab_offset(out_shape, axis, begin),
+                    slab_shape(arg_shape, axis, begin, end),
+                    slab_shape(out_shape, axis, begin, end),
+                    avg_pool->get_window_shape(),
+                    avg_pool->get_window_movement_strides(),
+                    avg_pool->get_padding_below(),
+                    avg_pool->get_padding_above(),
+                    avg_pool->get_include_padding_in_avg_computation());
+            });
+            break;
+        }
+        case OP_TYPEID::GetOutputElement:
         {
             const op::GetOutputElement* get_output_element =
                 static_cast<const op::GetOutputElement*>(&node);
             size_t n = get_output_element->get_n();
             size_t num_bytes = out[0]->get_element_count() * out[0]->get_element_type().size();
             std::memcpy(out[0]->get_data_ptr(), args[n]->get_data_ptr(), num_bytes);
+            break;
         }
-        else if (node_op == "BatchNorm")
+        case OP_TYPEID::BatchNorm:
         {
             ngraph::op::BatchNorm* bn = dynamic_cast<ngraph::op::BatchNorm*>(&node);
             if (bn->get_output_size() == 3)
@@ -264,38 +362,59 @@ private:
                                                     reinterpret_cast<T*>(out[0]->get_data_ptr()),
                                                     args[2]->get_shape());
             }
+            break;
         }
-        else if (node_op == "AvgPoolBackprop")
+        case OP_TYPEID::AvgPoolBackprop:
         {
             op::AvgPoolBackprop* apb = dynamic_cast<op::AvgPoolBackprop*>(&node);
-            reference::avg_pool_backprop<T>(args[0]->get_data_ptr<T>(),
-                                            out[0]->get_data_ptr<T>(),
-                                            args[0]->get_shape(),
-                                            out[0]->get_shape(),
-                                            apb->get_window_shape(),
-                                            apb->get_window_movement_strides(),
-                                            apb->get_padding_below(),
-                                            apb->get_padding_above(),
-                                            apb->get_include_padding_in_avg_computation());
-        }
-        else if (node_op == "Broadcast")
+            const Shape& delta_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            size_t axis = out_shape[0] == 1 ? 1 : 0;
+            parallel_slabs(out_shape[axis], shape_size(out_shape), [&](size_t begin, size_t end) {
+                reference::avg_pool_backprop<T>(
+                    args[0]->get_data_ptr<T>() + slab_offset(delta_shape, axis, begin),
+                    out[0]->get_data_ptr<T>() + slab_offset(out_shape, axis, begin),
+                    slab_shape(delta_shape, axis, begin, end),
+                    slab_shape(out_shape, axis, begin, end),
+                    apb->get_window_shape(),
+                    apb->get_window_movement_strides(),
+                    apb->get_padding_below(),
+                    apb->get_padding_above(),
+                    apb->get_include_padding_in_avg_computation());
+            });
+            break;
+        }
+        case OP_TYPEID::Broadcast:
         {
             op::Broadcast* broadcast = dynamic_cast<op::Broadcast*>(&node);
-            Shape in_shape = args[0]->get_shape();
-            Shape out_shape = out[0]->get_shape();
-            AxisSet broadcast_axes = broadcast->get_broadcast_axes();
-            reference::broadcast<T>(args[0]->get_data_ptr<T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    in_shape,
-                                    out_shape,
-                                    broadcast_axes);
-        }
-        else if (node_op == "Ceiling")
+            const Shape& in_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            const AxisSet& broadcast_axes = broadcast->get_broadcast_axes();
+            // Each slab of a broadcast outer axis is made from all of the input
+            bool split = !out_shape.empty();
+            bool split_input = split && broadcast_axes.count(0) == 0;
+            parallel_slabs(split ? out_shape[0] : 1,
+                           shape_size(out_shape),
+                           [&](size_t begin, size_t end) {
+                               size_t in_offset =
+                                   split_input ? slab_offset(in_shape, 0, begin) : 0;
+                               size_t out_offset = split ? slab_offset(out_shape, 0, begin) : 0;
+                               reference::broadcast<T>(
+                                   args[0]->get_data_ptr<T>() + in_offset,
+                                   out[0]->get_data_ptr<T>() + out_offset,
+                                   split_input ? slab_shape(in_shape, 0, begin, end) : in_shape,
+                                   split ? slab_shape(out_shape, 0, begin, end) : out_shape,
+                                   broadcast_axes);
+                           });
+            break;
+        }
+        case OP_TYPEID::Ceiling:
         {
             reference::ceiling<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Concat")
+        case OP_TYPEID::Concat:
         {
             const op::Concat* concat = static_cast<const op::Concat*>(&node);
             std::vector<const T*> in_args;
@@ -310,14 +429,16 @@ private:
                                  in_shapes,
                                  out[0]->get_shape(),
                                  concat->get_concatenation_axis());
+            break;
         }
-        else if (node_op == "Constant")
+        case OP_TYPEID::Constant:
         {
             const op::Constant* c = static_cast<const op::Constant*>(&node);
             reference::constant<T>(
                 c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Convert")
+        case OP_TYPEID::Convert:
         {
             // const op::Convert* c = static_cast<const op::Convert*>(&node);
             element::Type type = node.get_element_type();
@@ -393,30 +514,46 @@ private:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
+            break;
         }
-        else if (node_op == "Convolution")
+        case OP_TYPEID::Convolution:
         {
             auto c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(args[0]->get_data_ptr<T>(),
-                                      args[1]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      args[0]->get_shape(),
-                                      args[1]->get_shape(),
-                                      out[0]->get_shape(),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides(),
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      false);
-        }
-        else if (node_op == "ConvolutionBackpropFilters")
+            const Shape& data_shape = args[0]->get_shape();
+            const Shape& filters_shape = args[1]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            // Split the batch, or the output channels (and so the filters) of a single image
+            size_t axis = out_shape[0] == 1 ? 1 : 0;
+            bool split_data = axis == 0;
+            // Each output element takes a window of every input channel
+            Shape filter_shape(filters_shape.begin() + 1, filters_shape.end());
+            size_t work = shape_size(out_shape) * shape_size(filter_shape);
+            parallel_slabs(out_shape[axis], work, [&](size_t begin, size_t end) {
+                size_t data_offset = split_data ? slab_offset(data_shape, 0, begin) : 0;
+                size_t filters_offset = split_data ? 0 : slab_offset(filters_shape, 0, begin);
+                reference::convolution<T>(
+                    args[0]->get_data_ptr<T>() + data_offset,
+                    args[1]->get_data_ptr<T>() + filters_offset,
+                    out[0]->get_data_ptr<T>() + slab_offset(out_shape, axis, begin),
+                    split_data ? slab_shape(data_shape, 0, begin, end) : data_shape,
+                    split_data ? filters_shape : slab_shape(filters_shape, 0, begin, end),
+                    slab_shape(out_shape, axis, begin, end),
+                    c->get_window_movement_strides(),
+                    c->get_window_dilation_strides(),
+                    c->get_padding_below(),
+                    c->get_padding_above(),
+                    c->get_data_dilation_strides(),
+                    0,
+                    1,
+                    1,
+                    0,
+                    0,
+                    1,
+                    false);
+            });
+            break;
+        }
+        case OP_TYPEID::ConvolutionBackpropFilters:
         {
             auto c = static_cast<const op::ConvolutionBackpropFilters*>(&node);
             reference::convolution<T>(args[0]->get_data_ptr<T>(),
@@ -437,78 +574,105 @@ private:
                                       1,
                                       0,
                                       false);
+            break;
         }
-        else if (node_op == "ConvolutionBackpropData")
+        case OP_TYPEID::ConvolutionBackpropData:
         {
             // Note that args[1] and args[0] are switched here from the usual order.
             auto c = static_cast<const op::ConvolutionBackpropData*>(&node);
-            reference::convolution<T>(args[1]->get_data_ptr<T>(),
-                                      args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      args[1]->get_shape(),
-                                      args[0]->get_shape(),
-                                      out[0]->get_shape(),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      true);
-        }
-        else if (node_op == "Cos")
+            const Shape& delta_shape = args[1]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            const Shape& filters_shape = args[0]->get_shape();
+            Shape filter_shape(filters_shape.begin() + 1, filters_shape.end());
+            size_t work = shape_size(out_shape) * shape_size(filter_shape);
+            parallel_slabs(out_shape[0], work, [&](size_t begin, size_t end) {
+                reference::convolution<T>(
+                    args[1]->get_data_ptr<T>() + slab_offset(delta_shape, 0, begin),
+                    args[0]->get_data_ptr<T>(),
+                    out[0]->get_data_ptr<T>() + slab_offset(out_shape, 0, begin),
+                    slab_shape(delta_shape, 0, begin, end),
+                    filters_shape,
+                    slab_shape(out_shape, 0, begin, end),
+                    c->get_window_movement_strides_backward(),
+                    c->get_window_dilation_strides_backward(),
+                    c->get_padding_below_backward(),
+                    c->get_padding_above_backward(),
+                    c->get_data_dilation_strides_backward(),
+                    0,
+                    1,
+                    0,
+                    1,
+                    0,
+                    1,
+                    true);
+            });
+            break;
+        }
+        case OP_TYPEID::Cos:
         {
             reference::cos<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Cosh")
+        case OP_TYPEID::Cosh:
         {
             reference::cosh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Divide")
+        case OP_TYPEID::Divide:
         {
             reference::divide<T>(args[0]->get_data_ptr<T>(),
                                  args[1]->get_data_ptr<T>(),
                                  out[0]->get_data_ptr<T>(),
                                  out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Dot")
+        case OP_TYPEID::Dot:
         {
             op::Dot* dot = dynamic_cast<op::Dot*>(&node);
-
-            reference::dot(args[0]->get_data_ptr<T>(),
-                           args[1]->get_data_ptr<T>(),
-                           out[0]->get_data_ptr<T>(),
-                           args[0]->get_shape(),
-                           args[1]->get_shape(),
-                           out[0]->get_shape(),
-                           dot->get_reduction_axes_count());
+            const Shape& arg0_shape = args[0]->get_shape();
+            const Shape& arg1_shape = args[1]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            size_t reduction_axes_count = dot->get_reduction_axes_count();
+            // The outer axis of arg0 is the outer output axis unless it is reduced
+            bool split = arg0_shape.size() > reduction_axes_count;
+            size_t work = shape_size(arg0_shape) + shape_size(arg1_shape) + shape_size(out_shape);
+            parallel_slabs(split ? arg0_shape[0] : 1, work, [&](size_t begin, size_t end) {
+                size_t arg0_offset = split ? slab_offset(arg0_shape, 0, begin) : 0;
+                size_t out_offset = split ? slab_offset(out_shape, 0, begin) : 0;
+                reference::dot(args[0]->get_data_ptr<T>() + arg0_offset,
+                               args[1]->get_data_ptr<T>(),
+                               out[0]->get_data_ptr<T>() + out_offset,
+                               split ? slab_shape(arg0_shape, 0, begin, end) : arg0_shape,
+                               arg1_shape,
+                               split ? slab_shape(out_shape, 0, begin, end) : out_shape,
+                               reduction_axes_count);
+            });
+            break;
         }
 
-        else if (node_op == "Equal")
+        case OP_TYPEID::Equal:
         {
             reference::equal<T>(args[0]->get_data_ptr<T>(),
                                 args[1]->get_data_ptr<T>(),
                                 out[0]->get_data_ptr<char>(),
                                 out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Exp")
+        case OP_TYPEID::Exp:
         {
             reference::exp<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Floor")
+        case OP_TYPEID::Floor:
         {
             reference::floor<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "FunctionCall")
+        case OP_TYPEID::FunctionCall:
         {
             std::shared_ptr<Function> function = node.get_functions()[0];
 
@@ -525,125 +689,175 @@ private:
             }
 
             call(function, outputs, inputs);
+            break;
         }
-        else if (node_op == "Greater")
+        case OP_TYPEID::Greater:
         {
             reference::greater<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<char>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "GreaterEq")
+        case OP_TYPEID::GreaterEq:
         {
             reference::greater_eq<T>(args[0]->get_data_ptr<T>(),
                                      args[1]->get_data_ptr<T>(),
                                      out[0]->get_data_ptr<char>(),
                                      out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Less")
+        case OP_TYPEID::Less:
         {
             reference::less<T>(args[0]->get_data_ptr<T>(),
                                args[1]->get_data_ptr<T>(),
                                out[0]->get_data_ptr<char>(),
                                out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "LessEq")
+        case OP_TYPEID::LessEq:
         {
             reference::less_eq<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<char>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Log")
+        case OP_TYPEID::Log:
         {
             reference::log<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Max")
+        case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              args[0]->get_shape(),
-                              out[0]->get_shape(),
-                              max->get_reduction_axes());
-        }
-        else if (node_op == "Maximum")
+            const Shape& arg_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            const AxisSet& reduction_axes = max->get_reduction_axes();
+            bool split = !arg_shape.empty() && reduction_axes.count(0) == 0;
+            parallel_slabs(split ? arg_shape[0] : 1,
+                           shape_size(arg_shape),
+                           [&](size_t begin, size_t end) {
+                               size_t arg_offset = split ? slab_offset(arg_shape, 0, begin) : 0;
+                               size_t out_offset = split ? slab_offset(out_shape, 0, begin) : 0;
+                               reference::max<T>(
+                                   args[0]->get_data_ptr<T>() + arg_offset,
+                                   out[0]->get_data_ptr<T>() + out_offset,
+                                   split ? slab_shape(arg_shape, 0, begin, end) : arg_shape,
+                                   split ? slab_shape(out_shape, 0, begin, end) : out_shape,
+                                   reduction_axes);
+                           });
+            break;
+        }
+        case OP_TYPEID::Maximum:
         {
             reference::maximum<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "MaxPool")
+        case OP_TYPEID::MaxPool:
         {
             op::MaxPool* max_pool = dynamic_cast<op::MaxPool*>(&node);
-
-            reference::max_pool<T>(args[0]->get_data_ptr<T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   args[0]->get_shape(),
-                                   out[0]->get_shape(),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
-        }
-        else if (node_op == "MaxPoolBackprop")
+            const Shape& arg_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            // Split the batch, or the channels of a single image
+            size_t axis = out_shape[0] == 1 ? 1 : 0;
+            parallel_slabs(out_shape[axis], shape_size(arg_shape), [&](size_t begin, size_t end) {
+                reference::max_pool<T>(
+                    args[0]->get_data_ptr<T>() + slab_offset(arg_shape, axis, begin),
+                    out[0]->get_data_ptr<T>() + slab_offset(out_shape, axis, begin),
+                    slab_shape(arg_shape, axis, begin, end),
+                    slab_shape(out_shape, axis, begin, end),
+                    max_pool->get_window_shape(),
+                    max_pool->get_window_movement_strides(),
+                    max_pool->get_padding_below(),
+                    max_pool->get_padding_above());
+            });
+            break;
+        }
+        case OP_TYPEID::MaxPoolBackprop:
         {
             op::MaxPoolBackprop* max_pool_backprop = dynamic_cast<op::MaxPoolBackprop*>(&node);
-
-            reference::max_pool_backprop<T>(args[0]->get_data_ptr<T>(),
-                                            args[1]->get_data_ptr<T>(),
-                                            out[0]->get_data_ptr<T>(),
-                                            args[1]->get_shape(),
-                                            out[0]->get_shape(),
-                                            max_pool_backprop->get_window_shape(),
-                                            max_pool_backprop->get_window_movement_strides(),
-                                            max_pool_backprop->get_padding_below(),
-                                            max_pool_backprop->get_padding_above());
-        }
-        else if (node_op == "Min")
+            const Shape& delta_shape = args[1]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            // The forward input has the shape of the output
+            size_t axis = out_shape[0] == 1 ? 1 : 0;
+            parallel_slabs(out_shape[axis], shape_size(out_shape), [&](size_t begin, size_t end) {
+                reference::max_pool_backprop<T>(
+                    args[0]->get_data_ptr<T>() + slab_offset(out_shape, axis, begin),
+                    args[1]->get_data_ptr<T>() + slab_offset(delta_shape, axis, begin),
+                    out[0]->get_data_ptr<T>() + slab_offset(out_shape, axis, begin),
+                    slab_shape(delta_shape, axis, begin, end),
+                    slab_shape(out_shape, axis, begin, end),
+                    max_pool_backprop->get_window_shape(),
+                    max_pool_backprop->get_window_movement_strides(),
+                    max_pool_backprop->get_padding_below(),
+                    max_pool_backprop->get_padding_above());
+            });
+            break;
+        }
+        case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              args[0]->get_shape(),
-                              out[0]->get_shape(),
-                              min->get_reduction_axes());
-        }
-        else if (node_op == "Minimum")
+            const Shape& arg_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            const AxisSet& reduction_axes = min->get_reduction_axes();
+            bool split = !arg_shape.empty() && reduction_axes.count(0) == 0;
+            parallel_slabs(split ? arg_shape[0] : 1,
+                           shape_size(arg_shape),
+                           [&](size_t begin, size_t end) {
+                               size_t arg_offset = split ? slab_offset(arg_shape, 0, begin) : 0;
+                               size_t out_offset = split ? slab_offset(out_shape, 0, begin) : 0;
+                               reference::min<T>(
+                                   args[0]->get_data_ptr<T>() + arg_offset,
+                                   out[0]->get_data_ptr<T>() + out_offset,
+                                   split ? slab_shape(arg_shape, 0, begin, end) : arg_shape,
+                                   split ? slab_shape(out_shape, 0, begin, end) : out_shape,
+                                   reduction_axes);
+                           });
+            break;
+        }
+        case OP_TYPEID::Minimum:
         {
             reference::minimum<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Multiply")
+        case OP_TYPEID::Multiply:
         {
             reference::multiply<T>(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Negative")
+        case OP_TYPEID::Negative:
         {
             reference::negate<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Not")
+        case OP_TYPEID::Not:
         {
             reference::logical_not(args[0]->get_data_ptr<char>(),
                                    out[0]->get_data_ptr<char>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "NotEqual")
+        case OP_TYPEID::NotEqual:
         {
             reference::not_equal<T>(args[0]->get_data_ptr<T>(),
                                     args[1]->get_data_ptr<T>(),
                                     out[0]->get_data_ptr<char>(),
                                     out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "OneHot")
+        case OP_TYPEID::OneHot:
         {
             auto oh = static_cast<const op::OneHot*>(&node);
             reference::one_hot<T>(args[0]->get_data_ptr<T>(),
@@ -651,18 +865,21 @@ private:
                                   args[0]->get_shape(),
                                   out[0]->get_shape(),
                                   oh->get_one_hot_axis());
+            break;
         }
-        else if (node_op == "Or")
+        case OP_TYPEID::Or:
         {
             reference::logical_or(args[0]->get_data_ptr<char>(),
                                   args[1]->get_data_ptr<char>(),
                                   out[0]->get_data_ptr<char>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Parameter")
+        case OP_TYPEID::Parameter:
         {
+            break;
         }
-        else if (node_op == "Pad")
+        case OP_TYPEID::Pad:
         {
             op::Pad* pad = dynamic_cast<op::Pad*>(&node);
 
@@ -674,24 +891,38 @@ private:
                            pad->get_padding_below(),
                            pad->get_padding_above(),
                            pad->get_padding_interior());
+            break;
         }
-        else if (node_op == "Power")
+        case OP_TYPEID::Power:
         {
             reference::power<T>(args[0]->get_data_ptr<T>(),
                                 args[1]->get_data_ptr<T>(),
                                 out[0]->get_data_ptr<T>(),
                                 out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Product")
+        case OP_TYPEID::Product:
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
-            reference::product<T>(args[0]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  args[0]->get_shape(),
-                                  out[0]->get_shape(),
-                                  product->get_reduction_axes());
-        }
-        else if (node_op == "Reduce")
+            const Shape& arg_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            const AxisSet& reduction_axes = product->get_reduction_axes();
+            bool split = !arg_shape.empty() && reduction_axes.count(0) == 0;
+            parallel_slabs(split ? arg_shape[0] : 1,
+                           shape_size(arg_shape),
+                           [&](size_t begin, size_t end) {
+                               size_t arg_offset = split ? slab_offset(arg_shape, 0, begin) : 0;
+                               size_t out_offset = split ? slab_offset(out_shape, 0, begin) : 0;
+                               reference::product<T>(
+                                   args[0]->get_data_ptr<T>() + arg_offset,
+                                   out[0]->get_data_ptr<T>() + out_offset,
+                                   split ? slab_shape(arg_shape, 0, begin, end) : arg_shape,
+                                   split ? slab_shape(out_shape, 0, begin, end) : out_shape,
+                                   reduction_axes);
+                           });
+            break;
+        }
+        case OP_TYPEID::Reduce:
         {
             op::Reduce* reduce = dynamic_cast<op::Reduce*>(&node);
             std::shared_ptr<Function> reduction_function = reduce->get_functions()[0];
@@ -716,8 +947,9 @@ private:
                               node.get_output_shape(0),
                               reduce->get_reduction_axes(),
                               f);
+            break;
         }
-        else if (node_op == "ReduceWindow")
+        case OP_TYPEID::ReduceWindow:
         {
             op::ReduceWindow* reduce_window = dynamic_cast<op::ReduceWindow*>(&node);
             std::shared_ptr<Function> reduction_function = reduce_window->get_functions()[0];
@@ -743,20 +975,23 @@ private:
                                      f,
                                      reduce_window->get_window_shape(),
                                      reduce_window->get_window_movement_strides());
+            break;
         }
-        else if (node_op == "Relu")
+        case OP_TYPEID::Relu:
         {
             reference::relu<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "ReluBackprop")
+        case OP_TYPEID::ReluBackprop:
         {
             reference::relu_backprop<T>(args[0]->get_data_ptr<T>(),
                                         args[1]->get_data_ptr<T>(),
                                         out[0]->get_data_ptr<T>(),
                                         out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "ReplaceSlice")
+        case OP_TYPEID::ReplaceSlice:
         {
             const op::ReplaceSlice* slice = static_cast<const op::ReplaceSlice*>(&node);
             reference::replace_slice<T>(args[0]->get_data_ptr<T>(),
@@ -767,8 +1002,9 @@ private:
                                         slice->get_upper_bounds(),
                                         slice->get_strides(),
                                         out[0]->get_shape());
+            break;
         }
-        else if (node_op == "Reshape")
+        case OP_TYPEID::Reshape:
         {
             op::Reshape* reshape = dynamic_cast<op::Reshape*>(&node);
             reference::reshape(args[0]->get_data_ptr<T>(),
@@ -776,15 +1012,17 @@ private:
                                args[0]->get_shape(),
                                reshape->get_input_order(),
                                out[0]->get_shape());
+            break;
         }
-        else if (node_op == "Result")
+        case OP_TYPEID::Result:
         {
             op::Result* res = dynamic_cast<op::Result*>(&node);
             reference::result(args[0]->get_data_ptr<T>(),
                               out[0]->get_data_ptr<T>(),
                               shape_size(res->get_shape()));
+            break;
         }
-        else if (node_op == "Reverse")
+        case OP_TYPEID::Reverse:
         {
             op::Reverse* reverse = dynamic_cast<op::Reverse*>(&node);
             reference::reverse(args[0]->get_data_ptr<T>(),
@@ -792,8 +1030,9 @@ private:
                                args[0]->get_shape(),
                                out[0]->get_shape(),
                                reverse->get_reversed_axes());
+            break;
         }
-        else if (node_op == "ReverseSequence")
+        case OP_TYPEID::ReverseSequence:
         {
             op::ReverseSequence* reverse = dynamic_cast<op::ReverseSequence*>(&node);
 
@@ -810,16 +1049,18 @@ private:
             {
                 throw ngraph_error("only int32 indices are supported");
             }
+            break;
         }
-        else if (node_op == "Select")
+        case OP_TYPEID::Select:
         {
             reference::select<T>(args[0]->get_data_ptr<char>(),
                                  args[1]->get_data_ptr<T>(),
                                  args[2]->get_data_ptr<T>(),
                                  out[0]->get_data_ptr<T>(),
                                  out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "SelectAndScatter")
+        case OP_TYPEID::SelectAndScatter:
         {
             ngraph::op::SelectAndScatter* select_and_scatter =
                 dynamic_cast<ngraph::op::SelectAndScatter*>(&node);
@@ -866,23 +1107,27 @@ private:
                                              f_scatter,
                                              select_and_scatter->get_window_shape(),
                                              select_and_scatter->get_window_movement_strides());
+            break;
         }
-        else if (node_op == "Sign")
+        case OP_TYPEID::Sign:
         {
             reference::sign<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sin")
+        case OP_TYPEID::Sin:
         {
             reference::sin<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sinh")
+        case OP_TYPEID::Sinh:
         {
             reference::sinh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Slice")
+        case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
             reference::slice<T>(args[0]->get_data_ptr<T>(),
@@ -892,51 +1137,70 @@ private:
                                 slice->get_upper_bounds(),
                                 slice->get_strides(),
                                 out[0]->get_shape());
+            break;
         }
-        else if (node_op == "Softmax")
+        case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(args[0]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  out[0]->get_shape(),
-                                  softmax->get_axes());
-        }
-        else if (node_op == "Sqrt")
+            const Shape& shape = out[0]->get_shape();
+            const AxisSet& axes = softmax->get_axes();
+            bool split = !shape.empty() && axes.count(0) == 0;
+            parallel_slabs(split ? shape[0] : 1, shape_size(shape), [&](size_t begin, size_t end) {
+                size_t offset = split ? slab_offset(shape, 0, begin) : 0;
+                reference::softmax<T>(args[0]->get_data_ptr<T>() + offset,
+                                      out[0]->get_data_ptr<T>() + offset,
+                                      split ? slab_shape(shape, 0, begin, end) : shape,
+                                      axes);
+            });
+            break;
+        }
+        case OP_TYPEID::Sqrt:
         {
             reference::sqrt<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Subtract")
+        case OP_TYPEID::Subtract:
         {
             reference::subtract<T>(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sum")
+        case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              args[0]->get_shape(),
-                              out[0]->get_shape(),
-                              sum->get_reduction_axes());
-        }
-        else if (node_op == "Tan")
+            const Shape& arg_shape = args[0]->get_shape();
+            const Shape& out_shape = out[0]->get_shape();
+            const AxisSet& reduction_axes = sum->get_reduction_axes();
+            bool split = !arg_shape.empty() && reduction_axes.count(0) == 0;
+            parallel_slabs(split ? arg_shape[0] : 1,
+                           shape_size(arg_shape),
+                           [&](size_t begin, size_t end) {
+                               size_t arg_offset = split ? slab_offset(arg_shape, 0, begin) : 0;
+                               size_t out_offset = split ? slab_offset(out_shape, 0, begin) : 0;
+                               reference::sum<T>(
+                                   args[0]->get_data_ptr<T>() + arg_offset,
+                                   out[0]->get_data_ptr<T>() + out_offset,
+                                   split ? slab_shape(arg_shape, 0, begin, end) : arg_shape,
+                                   split ? slab_shape(out_shape, 0, begin, end) : out_shape,
+                                   reduction_axes);
+                           });
+            break;
+        }
+        case OP_TYPEID::Tan:
         {
             reference::tan<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Tanh")
+        case OP_TYPEID::Tanh:
         {
             reference::tanh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else
-        {
-            std::stringstream ss;
-            ss << "unsupported op " << node_op;
-            throw ngraph_error(ss.str());
         }
     }
 };
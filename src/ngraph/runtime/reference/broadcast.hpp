@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -33,16 +34,15 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
+                // The input is the output projected onto its non-broadcast axes, so it stays
+                // put while the walk moves along a broadcast axis.
+                StridedWalk<2> walk(
+                    out_shape,
+                    {{projected_steps(out_shape, broadcast_axes), row_major_steps(out_shape)}});
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = project(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -36,33 +37,22 @@ namespace ngraph
                 // We will copy the inputs to the output one at a time. As we go, we will move out along the
                 // concatenation axis, starting at 0.
                 size_t concatenation_pos = 0;
+                std::vector<std::ptrdiff_t> out_steps = row_major_steps(out_shape);
 
                 for (size_t i = 0; i < args.size(); i++)
                 {
-                    // The start coordinate for the copy is (0,...,0) except at the concatenation axis.
-                    Coordinate out_start_coord(out_shape.size(), 0);
-                    out_start_coord[concatenation_axis] = concatenation_pos;
-
-                    // The end coordinate for the copy is the same as the output shape except at the
+                    // Each input lands in the output starting at concatenation_pos along the
                     // concatenation axis.
-                    Coordinate out_end_coord = out_shape;
-                    out_end_coord[concatenation_axis] =
-                        concatenation_pos + in_shapes[i][concatenation_axis];
-
-                    CoordinateTransform input_transform(in_shapes[i]);
-                    CoordinateTransform output_chunk_transform(
-                        out_shape, out_start_coord, out_end_coord);
-
-                    CoordinateTransform::Iterator output_chunk_it = output_chunk_transform.begin();
-
-                    for (const Coordinate& input_coord : input_transform)
-                    {
-                        size_t input_index = input_transform.index(input_coord);
-                        size_t output_chunk_index = output_chunk_transform.index(*output_chunk_it);
-                        ++output_chunk_it;
-
-                        out[output_chunk_index] = args[i][input_index];
-                    }
+                    StridedWalk<2> walk(in_shapes[i],
+                                        {{row_major_steps(in_shapes[i]), out_steps}},
+                                        {{0,
+                                          static_cast<std::ptrdiff_t>(concatenation_pos) *
+                                              out_steps[concatenation_axis]}});
+
+                    const T* arg = args[i];
+                    walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                        out[offsets[1]] = arg[offsets[0]];
+                    });
 
                     concatenation_pos += in_shapes[i][concatenation_axis];
                 }
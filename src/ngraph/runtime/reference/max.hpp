@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -38,26 +40,20 @@ namespace ngraph
                                ? -std::numeric_limits<T>::infinity()
                                : std::numeric_limits<T>::min();
 
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), minval);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
+                StridedWalk<2> walk(
+                    in_shape,
+                    {{row_major_steps(in_shape), projected_steps(in_shape, reduction_axes)}});
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = project(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    T x = arg[offsets[0]];
+                    T max = out[offsets[1]];
                     if (x > max)
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        out[offsets[1]] = x;
                     }
-                }
+                });
             }
         }
     }
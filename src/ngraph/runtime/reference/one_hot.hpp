@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -36,20 +39,19 @@ namespace ngraph
                          size_t one_hot_axis)
             {
                 // Step 1: Zero out the output.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
+                std::fill(out, out + shape_size(out_shape), T(0));
 
                 // Step 2: Write ones at needed positions, throwing exceptions when invalid conditions
-                // are encountered.
-                CoordinateTransform input_transform(in_shape);
+                // are encountered. The input axes are the output axes without the one-hot axis,
+                // which is applied per element.
+                std::vector<std::ptrdiff_t> out_steps = row_major_steps(out_shape);
+                std::ptrdiff_t one_hot_step = out_steps[one_hot_axis];
+                out_steps.erase(out_steps.begin() + one_hot_axis);
+
+                StridedWalk<2> walk(in_shape, {{row_major_steps(in_shape), out_steps}});
 
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    T val = arg[input_transform.index(input_coord)];
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    T val = arg[offsets[0]];
 
                     if (std::floor(val) < val || std::floor(val) > val)
                     {
@@ -63,10 +65,8 @@ namespace ngraph
                         throw(std::range_error("One-hot: value is out of category range"));
                     }
 
-                    Coordinate one_hot_coord = inject(input_coord, one_hot_axis, one_hot_pos);
-
-                    out[output_transform.index(one_hot_coord)] = 1;
-                }
+                    out[offsets[1] + static_cast<std::ptrdiff_t>(one_hot_pos) * one_hot_step] = 1;
+                });
             }
         }
     }
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -37,29 +39,20 @@ namespace ngraph
                                const Shape& out_shape)
             {
                 // Step 1: Copy the entire replacement context to the output.
-                CoordinateTransform copy_transform(out_shape);
-
-                for (Coordinate copy_coord : copy_transform)
-                {
-                    out[copy_transform.index(copy_coord)] = arg0[copy_transform.index(copy_coord)];
-                }
+                std::copy(arg0, arg0 + shape_size(out_shape), out);
 
                 // Step 2: Overwrite the slice for replacement.
-                CoordinateTransform input_transform(arg1_shape);
                 CoordinateTransform output_transform(
                     out_shape, lower_bounds, upper_bounds, strides);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg1[input_transform.index(input_coord)];
+                StridedWalk<2> walk(
+                    arg1_shape,
+                    {{row_major_steps(arg1_shape), output_transform.get_source_steps()}},
+                    {{0, output_transform.get_source_origin()}});
 
-                    ++output_it;
-                }
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[1]] = arg1[offsets[0]];
+                });
             }
         }
     }
@@ -20,6 +20,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -42,18 +43,17 @@ namespace ngraph
                 CoordinateTransform input_transform(
                     in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
 
-                CoordinateTransform output_transform(out_shape);
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-
-                    ++output_it;
-                }
+                // The output is written in the order the transposed input is read, so its offset
+                // is simply the position in the walk.
+                const Shape& walk_shape = input_transform.get_target_shape();
+                StridedWalk<2> walk(
+                    walk_shape,
+                    {{input_transform.get_source_steps(), row_major_steps(walk_shape)}},
+                    {{input_transform.get_source_origin(), 0}});
+
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -34,23 +35,23 @@ namespace ngraph
                          const AxisSet& reversed_axes)
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
+                std::vector<std::ptrdiff_t> arg_steps = row_major_steps(arg_shape);
+                std::ptrdiff_t arg_origin = 0;
 
-                for (Coordinate out_coord : output_transform)
+                // Reversed axes are read from their last element with a negated step.
+                for (size_t axis : reversed_axes)
                 {
-                    Coordinate arg_coord = out_coord;
+                    std::ptrdiff_t last = static_cast<std::ptrdiff_t>(arg_shape[axis]) - 1;
+                    arg_origin += last * arg_steps[axis];
+                    arg_steps[axis] = -arg_steps[axis];
+                }
 
-                    for (size_t i = 0; i < arg_coord.size(); i++)
-                    {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
-                    }
+                StridedWalk<2> walk(
+                    out_shape, {{arg_steps, row_major_steps(out_shape)}}, {{arg_origin, 0}});
 
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
-                }
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -36,18 +37,15 @@ namespace ngraph
                        const Shape& out_shape)
             {
                 CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
+                StridedWalk<2> walk(
+                    out_shape,
+                    {{input_transform.get_source_steps(), row_major_steps(out_shape)}},
+                    {{input_transform.get_source_origin(), 0}});
 
-                for (const Coordinate& in_coord : input_transform)
-                {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
-                }
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
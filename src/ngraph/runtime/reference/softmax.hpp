@@ -18,6 +18,7 @@
 
 #include <cmath>
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 
@@ -37,22 +38,18 @@ namespace ngraph
 
                 max(arg, temp_ptr, shape, temp_shape, axes);
 
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = project(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
-                }
+                StridedWalk<2> walk(shape,
+                                    {{row_major_steps(shape), projected_steps(shape, axes)}});
+
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[0]] = std::exp(arg[offsets[0]] - temp_ptr[offsets[1]]);
+                });
 
                 sum(out, temp_ptr, shape, temp_shape, axes);
 
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = project(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
-                }
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[0]] /= temp_ptr[offsets[1]];
+                });
 
                 delete[] temp_ptr;
             }
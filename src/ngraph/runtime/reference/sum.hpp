@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -33,22 +35,17 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
+                // The output is the input projected onto its non-reduced axes, so every input
+                // element along a reduced axis lands on the same output element.
+                StridedWalk<2> walk(
+                    in_shape,
+                    {{row_major_steps(in_shape), projected_steps(in_shape, reduction_axes)}});
 
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = project(input_coord, reduction_axes);
-
-                    out[output_transform.index(output_coord)] +=
-                        arg[input_transform.index(input_coord)];
-                }
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[1]] += arg[offsets[0]];
+                });
             }
         }
     }
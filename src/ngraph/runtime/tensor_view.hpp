@@ -73,6 +73,11 @@ namespace ngraph
             /// @param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t tensor_offset, size_t n) const = 0;
 
+            /// @brief The address of the tensor's storage when the host can access it directly,
+            /// with the elements stored densely in row-major order. Tensors in device memory
+            /// return nullptr.
+            virtual void* get_host_data_ptr() { return nullptr; }
+
         protected:
             std::shared_ptr<ngraph::descriptor::TensorView> m_descriptor;
             bool m_stale;
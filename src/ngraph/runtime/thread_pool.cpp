@@ -0,0 +1,138 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "ngraph/runtime/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::ThreadPool::ThreadPool(size_t thread_count)
+    : m_busy(false)
+    , m_generation(0)
+    , m_active(0)
+    , m_shutdown(false)
+    , m_job(nullptr)
+    , m_count(0)
+    , m_chunk_count(0)
+    , m_next_chunk(0)
+{
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        m_workers.emplace_back(&ThreadPool::run_worker, this);
+    }
+}
+
+runtime::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_start.notify_all();
+    for (thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void runtime::ThreadPool::parallel_for(size_t count, const function<void(size_t, size_t)>& f)
+{
+    bool idle = false;
+    if (count < 2 || m_workers.empty() || !m_busy.compare_exchange_strong(idle, true))
+    {
+        if (count > 0)
+        {
+            f(0, count);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_job = &f;
+        m_count = count;
+        m_chunk_count = min(count, get_thread_count());
+        m_next_chunk = 0;
+        m_exception = nullptr;
+        m_active = m_workers.size();
+        m_generation++;
+    }
+    m_start.notify_all();
+    run_chunks();
+
+    exception_ptr exception;
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_active == 0; });
+        m_job = nullptr;
+        exception = m_exception;
+        m_exception = nullptr;
+    }
+    m_busy = false;
+    if (exception)
+    {
+        rethrow_exception(exception);
+    }
+}
+
+void runtime::ThreadPool::run_worker()
+{
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_start.wait(lock, [&] { return m_shutdown || m_generation != generation; });
+            if (m_shutdown)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+        run_chunks();
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (--m_active == 0)
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+}
+
+void runtime::ThreadPool::run_chunks()
+{
+    for (size_t chunk = m_next_chunk++; chunk < m_chunk_count; chunk = m_next_chunk++)
+    {
+        // Chunk boundaries only depend on count and the thread count
+        size_t begin = chunk * m_count / m_chunk_count;
+        size_t end = (chunk + 1) * m_count / m_chunk_count;
+        try
+        {
+            (*m_job)(begin, end);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = current_exception();
+            }
+        }
+    }
+}
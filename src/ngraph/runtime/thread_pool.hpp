@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ThreadPool;
+    }
+}
+
+/// @brief A fixed set of worker threads that, together with the calling thread, run the
+/// subranges of a parallel_for.
+class ngraph::runtime::ThreadPool
+{
+public:
+    /// @param thread_count The number of threads that run a parallel_for, including the
+    /// calling thread. A pool of one thread runs everything on the caller.
+    ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t get_thread_count() const { return m_workers.size() + 1; }
+    /// @brief Calls f(begin, end) on consecutive subranges that cover [0, count), one per
+    /// thread at most, and returns once all of them have returned. The first exception thrown
+    /// by f is rethrown here. A parallel_for issued while the pool is busy, for instance from
+    /// within f, calls f(0, count) on the calling thread.
+    void parallel_for(size_t count, const std::function<void(size_t, size_t)>& f);
+
+private:
+    void run_worker();
+    void run_chunks();
+
+    std::vector<std::thread> m_workers;
+    std::atomic<bool> m_busy;
+
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+    size_t m_generation;
+    size_t m_active;
+    bool m_shutdown;
+
+    const std::function<void(size_t, size_t)>* m_job;
+    size_t m_count;
+    size_t m_chunk_count;
+    std::atomic<size_t> m_next_chunk;
+    std::exception_ptr m_exception;
+};
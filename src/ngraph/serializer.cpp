@@ -14,8 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <deque>
+#include <fcntl.h>
 #include <fstream>
 #include <functional>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 
 #include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
@@ -94,16 +101,23 @@ using json = nlohmann::json;
 using const_data_callback_t = shared_ptr<Node>(const string&, const element::Type&, const Shape&);
 
 template <typename T>
-T get_or_default(nlohmann::json& j, const std::string& key, const T& default_value)
+T get_or_default(const nlohmann::json& j, const std::string& key, const T& default_value)
 {
     return j.count(key) != 0 ? j.at(key).get<T>() : default_value;
 }
 
+// Literal values of json Constants decoded ahead of building the graph, keyed by the
+// Constant's json node
+using decoded_constants_t = unordered_map<const json*, shared_ptr<void>>;
+
 static std::shared_ptr<ngraph::Function>
     read_function(const json&,
                   std::unordered_map<std::string, std::shared_ptr<Function>>&,
+                  const decoded_constants_t&,
                   function<const_data_callback_t>);
 
+static shared_ptr<Function> read_functions(const json&, function<const_data_callback_t>);
+
 static json write(const ngraph::Function&, bool binary_constant_data);
 static json write(const ngraph::Node&, bool binary_constant_data);
 static string
@@ -173,6 +187,227 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     writer.close();
 }
 
+// A mappable model file is laid out as
+//   MappableHeader
+//   the json model, as written to a CPIO file
+//   the constant index, a json object mapping each Constant's name to [offset, size]
+//   zero padding up to data_offset, which is page aligned
+//   the constant data, each tensor at an offset from data_offset that is a multiple of
+//   s_mappable_tensor_alignment
+struct MappableHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t model_size;
+    uint64_t index_size;
+    uint64_t data_offset;
+};
+
+static const char s_mappable_magic[8] = {'n', 'g', 'r', 'a', 'p', 'h', 'm', 'm'};
+static const uint32_t s_mappable_version = 1;
+static const size_t s_mappable_page_size = 4096;
+static const size_t s_mappable_tensor_alignment = 64;
+
+void ngraph::serialize_mappable(const string& path,
+                                shared_ptr<ngraph::Function> func,
+                                size_t indent)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    if (!out)
+    {
+        throw ngraph_error("Unable to open '" + path + "'");
+    }
+    serialize_mappable(out, func, indent);
+}
+
+void ngraph::serialize_mappable(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+{
+    string model = ::serialize(func, indent, true);
+
+    json index = json::object();
+    vector<shared_ptr<op::Constant>> constants;
+    size_t data_size = 0;
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
+        traverse_nodes(const_cast<Function*>(f.get()), [&](shared_ptr<Node> node) {
+            auto c = dynamic_pointer_cast<op::Constant>(node);
+            if (c && index.count(c->get_name()) == 0)
+            {
+                size_t size = shape_size(c->get_shape()) * c->get_element_type().size();
+                data_size = round_up(data_size, s_mappable_tensor_alignment);
+                index[c->get_name()] = {data_size, size};
+                constants.push_back(c);
+                data_size += size;
+            }
+        });
+    });
+    string index_string = index.dump();
+
+    MappableHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, s_mappable_magic, sizeof(header.magic));
+    header.version = s_mappable_version;
+    header.model_size = model.size();
+    header.index_size = index_string.size();
+    header.data_offset =
+        round_up(sizeof(header) + model.size() + index_string.size(), s_mappable_page_size);
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(model.data(), model.size());
+    out.write(index_string.data(), index_string.size());
+
+    // The data section starts at data_offset even when it is empty
+    string padding(header.data_offset - sizeof(header) - model.size() - index_string.size(),
+                   '\0');
+    out.write(padding.data(), padding.size());
+    size_t position = header.data_offset;
+    for (const shared_ptr<op::Constant>& c : constants)
+    {
+        const json& entry = index.at(c->get_name());
+        size_t offset = header.data_offset + entry[0].get<size_t>();
+        size_t size = entry[1].get<size_t>();
+        padding.assign(offset - position, '\0');
+        out.write(padding.data(), padding.size());
+        out.write(static_cast<const char*>(c->get_data_ptr()), size);
+        position = offset + size;
+    }
+}
+
+static bool is_mappable(istream& in)
+{
+    auto offset = in.tellg();
+    in.seekg(0, ios_base::beg);
+    char magic[sizeof(s_mappable_magic)] = {};
+    in.read(magic, sizeof(magic));
+    bool rc = in.good() && memcmp(magic, s_mappable_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(offset, ios_base::beg);
+    return rc;
+}
+
+static void check_mappable_header(const MappableHeader& header, size_t file_size)
+{
+    if (memcmp(header.magic, s_mappable_magic, sizeof(header.magic)) != 0)
+    {
+        throw ngraph_error("Not a mappable model file");
+    }
+    if (header.version != s_mappable_version)
+    {
+        throw ngraph_error("Unsupported mappable model version " + to_string(header.version));
+    }
+    if (sizeof(header) + header.model_size + header.index_size > header.data_offset ||
+        header.data_offset > file_size)
+    {
+        throw ngraph_error("Mappable model file is truncated");
+    }
+}
+
+// Reads the functions of a mappable model. read_constant(offset, size, type, shape) makes the
+// Constant whose data is at offset from the start of the data section.
+static shared_ptr<Function> read_mappable_model(
+    const string& model,
+    const string& index_string,
+    function<shared_ptr<Node>(size_t, size_t, const element::Type&, const Shape&)>
+        read_constant)
+{
+    json index = json::parse(index_string);
+    return read_functions(
+        json::parse(model),
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            auto it = index.find(const_name);
+            if (it == index.end())
+            {
+                throw ngraph_error("No data for constant '" + const_name + "'");
+            }
+            size_t offset = (*it)[0].get<size_t>();
+            size_t size = (*it)[1].get<size_t>();
+            if (size != shape_size(shape) * et.size())
+            {
+                throw ngraph_error("Data size does not match constant '" + const_name + "'");
+            }
+            return read_constant(offset, size, et, shape);
+        });
+}
+
+static shared_ptr<Function> read_mappable(istream& in)
+{
+    in.seekg(0, ios_base::end);
+    size_t file_size = in.tellg();
+    in.seekg(0, ios_base::beg);
+
+    MappableHeader header;
+    memset(&header, 0, sizeof(header));
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    check_mappable_header(header, file_size);
+
+    string model(header.model_size, '\0');
+    in.read(&model[0], model.size());
+    string index_string(header.index_size, '\0');
+    in.read(&index_string[0], index_string.size());
+
+    return read_mappable_model(
+        model,
+        index_string,
+        [&](size_t offset, size_t size, const element::Type& et, const Shape& shape) {
+            if (header.data_offset + offset + size > file_size)
+            {
+                throw ngraph_error("Mappable model file is truncated");
+            }
+            shared_ptr<void> data(
+                ngraph::aligned_alloc(s_mappable_tensor_alignment,
+                                      round_up(size, s_mappable_tensor_alignment)),
+                ngraph::aligned_free);
+            in.seekg(header.data_offset + offset, ios_base::beg);
+            in.read(static_cast<char*>(data.get()), size);
+            return make_shared<op::Constant>(et, shape, data.get(), data);
+        });
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize_mapped(const string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw ngraph_error("Unable to open '" + path + "'");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(MappableHeader)))
+    {
+        close(fd);
+        throw ngraph_error("'" + path + "' is not a mappable model file");
+    }
+    size_t file_size = st.st_size;
+    void* addr = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        throw ngraph_error("Unable to map '" + path + "'");
+    }
+
+    // Every Constant holds a reference to the mapping, the last one to go unmaps the file.
+    shared_ptr<void> mapping(addr, [file_size](void* p) { munmap(p, file_size); });
+    const char* base = static_cast<const char*>(addr);
+
+    MappableHeader header;
+    memcpy(&header, base, sizeof(header));
+    check_mappable_header(header, file_size);
+
+    const char* model = base + sizeof(header);
+    const char* index_string = model + header.model_size;
+
+    return read_mappable_model(
+        string(model, header.model_size),
+        string(index_string, header.index_size),
+        [&](size_t offset, size_t size, const element::Type& et, const Shape& shape) {
+            if (header.data_offset + offset + size > file_size)
+            {
+                throw ngraph_error("Mappable model file is truncated");
+            }
+            return make_shared<op::Constant>(
+                et, shape, base + header.data_offset + offset, mapping);
+        });
+}
+
 static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data)
 {
     json j;
@@ -217,38 +452,36 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
             reader.read(file_info[0].get_name(), data, size);
             string jstr(data, size);
             delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
+            rc = read_functions(
+                json::parse(jstr),
+                [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                    shared_ptr<Node> const_node;
+                    for (const cpio::FileInfo& info : file_info)
+                    {
+                        if (info.get_name() == const_name)
                         {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                free(const_data);
-                                break;
-                            }
+                            // Read straight into the buffer the Constant will own
+                            shared_ptr<void> const_data(
+                                ngraph::aligned_alloc(et.size(), info.get_size()),
+                                ngraph::aligned_free);
+                            reader.read(const_name, const_data.get(), info.get_size());
+                            const_node =
+                                make_shared<op::Constant>(et, shape, const_data.get(), const_data);
+                            break;
                         }
-                        return const_node;
-                    });
-                rc = f;
-            }
+                    }
+                    return const_node;
+                });
         }
     }
+    else if (is_mappable(in))
+    {
+        rc = read_mappable(in);
+    }
     else
     {
         // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        rc = read_functions(json::parse(in), nullptr);
     }
     return rc;
 }
@@ -264,13 +497,7 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     }
     else
     {
-        json js = json::parse(s);
-        unordered_map<string, shared_ptr<Function>> function_map;
-        for (json func : js)
-        {
-            shared_ptr<Function> f = read_function(func, function_map, nullptr);
-            rc = f;
-        }
+        rc = read_functions(json::parse(s), nullptr);
     }
 
     return rc;
@@ -337,9 +564,210 @@ static json write(const Function& f, bool binary_constant_data)
     return function;
 }
 
+// Parses the literals of one json Constant into out, in the same way as the Constant
+// constructor that takes strings. Returns false if any literal is not a string holding a
+// number, in which case that constructor is left to report the error.
+template <typename T>
+static bool decode_literals(const json& values, size_t begin, size_t end, void* out)
+{
+    T* p = static_cast<T*>(out);
+    for (size_t i = begin; i < end; i++)
+    {
+        const json& value = values[i];
+        if (!value.is_string())
+        {
+            return false;
+        }
+        const char* literal = value.get_ref<const string&>().c_str();
+        char* literal_end;
+        double d = strtod(literal, &literal_end);
+        if (*literal_end != 0)
+        {
+            return false;
+        }
+        p[i] = static_cast<T>(d);
+    }
+    return true;
+}
+
+static bool decode_literals(
+    const element::Type& et, const json& values, size_t begin, size_t end, void* out)
+{
+    if (et == element::boolean)
+    {
+        return decode_literals<char>(values, begin, end, out);
+    }
+    else if (et == element::f32)
+    {
+        return decode_literals<float>(values, begin, end, out);
+    }
+    else if (et == element::f64)
+    {
+        return decode_literals<double>(values, begin, end, out);
+    }
+    else if (et == element::i8)
+    {
+        return decode_literals<int8_t>(values, begin, end, out);
+    }
+    else if (et == element::i16)
+    {
+        return decode_literals<int16_t>(values, begin, end, out);
+    }
+    else if (et == element::i32)
+    {
+        return decode_literals<int32_t>(values, begin, end, out);
+    }
+    else if (et == element::i64)
+    {
+        return decode_literals<int64_t>(values, begin, end, out);
+    }
+    else if (et == element::u8)
+    {
+        return decode_literals<uint8_t>(values, begin, end, out);
+    }
+    else if (et == element::u16)
+    {
+        return decode_literals<uint16_t>(values, begin, end, out);
+    }
+    else if (et == element::u32)
+    {
+        return decode_literals<uint32_t>(values, begin, end, out);
+    }
+    else if (et == element::u64)
+    {
+        return decode_literals<uint64_t>(values, begin, end, out);
+    }
+    return false;
+}
+
+// Decodes the literal values of every Constant in the json functions, which is most of the
+// work of reading a model with large constants. Literals are parsed straight from the json
+// into the buffers the Constants will own, split into chunks that are spread over threads.
+// Constants that cannot be decoded are left out; building them the usual way reports why.
+static decoded_constants_t decode_constants(const json& js)
+{
+    struct Chunk
+    {
+        size_t constant;
+        size_t begin;
+        size_t end;
+    };
+    struct Pending
+    {
+        const json* node_js;
+        const json* values;
+        element::Type et;
+        shared_ptr<void> data;
+        atomic<bool> failed;
+    };
+    const size_t chunk_size = 16384;
+
+    deque<Pending> constants;
+    vector<Chunk> chunks;
+    size_t total_count = 0;
+    for (const json& func : js)
+    {
+        for (const json& node_js : func.at("ops"))
+        {
+            auto op_it = node_js.find("op");
+            auto value_it = node_js.find("value");
+            if (op_it == node_js.end() || *op_it != "Constant" || value_it == node_js.end() ||
+                !value_it->is_array())
+            {
+                continue;
+            }
+            element::Type et;
+            size_t count;
+            try
+            {
+                const json& type_node_js =
+                    node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
+                et = read_element_type(type_node_js.at("element_type"));
+                count = shape_size(type_node_js.at("shape").get<Shape>());
+            }
+            catch (...)
+            {
+                // read_function reports malformed nodes
+                continue;
+            }
+            if (value_it->size() != count || count == 0)
+            {
+                continue;
+            }
+
+            constants.emplace_back();
+            Pending& pending = constants.back();
+            pending.node_js = &node_js;
+            pending.values = &*value_it;
+            pending.et = et;
+            pending.data = shared_ptr<void>(ngraph::aligned_alloc(et.size(), count * et.size()),
+                                            ngraph::aligned_free);
+            pending.failed = false;
+            total_count += count;
+            for (size_t begin = 0; begin < count; begin += chunk_size)
+            {
+                chunks.push_back({constants.size() - 1, begin, min(begin + chunk_size, count)});
+            }
+        }
+    }
+
+    atomic<size_t> next_chunk(0);
+    auto worker = [&]() {
+        for (size_t i = next_chunk++; i < chunks.size(); i = next_chunk++)
+        {
+            Pending& pending = constants[chunks[i].constant];
+            if (!decode_literals(pending.et,
+                                 *pending.values,
+                                 chunks[i].begin,
+                                 chunks[i].end,
+                                 pending.data.get()))
+            {
+                pending.failed = true;
+            }
+        }
+    };
+    size_t thread_count = min<size_t>(thread::hardware_concurrency(), total_count / chunk_size);
+    vector<thread> threads;
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        threads.push_back(thread(worker));
+    }
+    worker();
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    decoded_constants_t rc;
+    for (Pending& pending : constants)
+    {
+        if (!pending.failed)
+        {
+            rc.insert({pending.node_js, pending.data});
+        }
+    }
+    return rc;
+}
+
+// Reads every function in js. Functions are listed callees first, so the last one read is
+// the one that was serialized.
+static shared_ptr<Function> read_functions(const json& js,
+                                           function<const_data_callback_t> const_data_callback)
+{
+    decoded_constants_t decoded_constants = decode_constants(js);
+    unordered_map<string, shared_ptr<Function>> function_map;
+    shared_ptr<Function> rc;
+    for (const json& func : js)
+    {
+        rc = read_function(func, function_map, decoded_constants, const_data_callback);
+    }
+    return rc;
+}
+
 static shared_ptr<ngraph::Function>
     read_function(const json& func_js,
                   unordered_map<string, shared_ptr<Function>>& function_map,
+                  const decoded_constants_t& decoded_constants,
                   function<const_data_callback_t> const_data_callback)
 {
     shared_ptr<ngraph::Function> rc;
@@ -348,7 +776,7 @@ static shared_ptr<ngraph::Function>
     vector<string> func_parameters = func_js.at("parameters").get<vector<string>>();
     vector<string> func_result = func_js.at("result").get<vector<string>>();
     unordered_map<string, shared_ptr<Node>> node_map;
-    for (json node_js : func_js.at("ops"))
+    for (const json& node_js : func_js.at("ops"))
     {
         try
         {
@@ -467,18 +895,27 @@ static shared_ptr<ngraph::Function>
             }
             else if (node_op == "Constant")
             {
-                auto type_node_js =
+                const json& type_node_js =
                     node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
                 auto element_type = read_element_type(type_node_js.at("element_type"));
                 auto shape = type_node_js.at("shape");
-                try
+                auto decoded = decoded_constants.find(&node_js);
+                if (decoded != decoded_constants.end())
                 {
-                    auto value = node_js.at("value").get<vector<string>>();
-                    node = make_shared<op::Constant>(element_type, shape, value);
+                    node = make_shared<op::Constant>(
+                        element_type, shape, decoded->second.get(), decoded->second);
                 }
-                catch (...)
+                else
                 {
-                    node = const_data_callback(node_name, element_type, shape);
+                    try
+                    {
+                        auto value = node_js.at("value").get<vector<string>>();
+                        node = make_shared<op::Constant>(element_type, shape, value);
+                    }
+                    catch (...)
+                    {
+                        node = const_data_callback(node_name, element_type, shape);
+                    }
                 }
             }
             else if (node_op == "Convert")
@@ -497,10 +934,12 @@ static shared_ptr<ngraph::Function>
 
                 // For backwards compatibility, we accept "image_dilation_strides" in place of
                 // "data_dilation_strides", and we also allow it to be omitted altogether.
-                auto data_dilation_strides_maybe = node_js["data_dilation_strides"];
+                auto data_dilation_strides_maybe =
+                    get_or_default<json>(node_js, "data_dilation_strides", json());
                 if (data_dilation_strides_maybe.empty())
                 {
-                    data_dilation_strides_maybe = node_js["image_dilation_strides"];
+                    data_dilation_strides_maybe =
+                        get_or_default<json>(node_js, "image_dilation_strides", json());
                 }
 
                 if (data_dilation_strides_maybe.empty())
@@ -583,7 +1022,7 @@ static shared_ptr<ngraph::Function>
             else if (node_op == "Dot")
             {
                 // For backwards compatibility, reduction_axes_count is optional.
-                auto obj = node_js["reduction_axes_count"];
+                auto obj = get_or_default<json>(node_js, "reduction_axes_count", json());
                 if (obj.empty())
                 {
                     node = make_shared<op::Dot>(args[0], args[1]);
@@ -648,8 +1087,8 @@ static shared_ptr<ngraph::Function>
                     node_js.at("window_movement_strides").get<vector<size_t>>();
                 // For backwards compatibility, both (but not just one) of the padding_ fields may be
                 // omitted.
-                auto padding_below_maybe = node_js["padding_below"];
-                auto padding_above_maybe = node_js["padding_above"];
+                auto padding_below_maybe = get_or_default<json>(node_js, "padding_below", json());
+                auto padding_above_maybe = get_or_default<json>(node_js, "padding_above", json());
                 if (padding_below_maybe.empty() && !padding_above_maybe.empty())
                 {
                     throw runtime_error(
@@ -48,8 +48,34 @@ namespace ngraph
     //    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    // @brief Serialize a Function to a mappable model file. The json model is followed by the
+    //    constant data, with every tensor aligned so that it can be used in place once the file
+    //    is memory mapped (see deserialize_mapped).
+    // @param out The output stream to which the data is serialized.
+    // @param func The Function to serialize
+    // @param indent If 0 then there is no formatting applied and the json is the
+    //    most compact representation. If non-zero then the json is formatted with the
+    //    indent level specified.
+    void serialize_mappable(std::ostream& out,
+                            std::shared_ptr<ngraph::Function> func,
+                            size_t indent = 0);
+
+    // @brief Serialize a Function to a mappable model file
+    // @param path The path to the output file
+    // @param func The Function to serialize
+    // @param indent See serialize_mappable(std::ostream&, ...)
+    void serialize_mappable(const std::string& path,
+                            std::shared_ptr<ngraph::Function> func,
+                            size_t indent = 0);
+
+    // @brief Deserialize a Function from a mappable model file without copying constant data.
+    //    The file is mapped read-only and every Constant points into the mapping, which stays
+    //    alive as long as any of them. Processes mapping the same file share its pages.
+    // @param path The path to a file written by serialize_mappable
+    std::shared_ptr<ngraph::Function> deserialize_mapped(const std::string& path);
+
     // @brief Deserialize a Function
-    // @param in An isteam to the input data
+    // @param in An isteam to the input data. JSON, CPIO and mappable models are recognized.
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     // @brief Deserialize a Function
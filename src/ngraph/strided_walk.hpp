@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    /// \brief Walks a shape in row-major order while keeping a linear offset into each of N
+    ///        buffers up to date, by adding per-axis steps rather than materializing and
+    ///        re-indexing a Coordinate for every element.
+    ///
+    /// The walk is handed out as innermost runs: the offset of a run's first element in each
+    /// buffer, and the run length. Within a run, buffer i advances by get_inner_step(i). Axes of
+    /// extent 1 are dropped and adjacent axes that every buffer steps through uniformly are
+    /// merged, so for instance a dense copy is a single run.
+    template <size_t N>
+    class StridedWalk
+    {
+    public:
+        using Offsets = std::array<std::ptrdiff_t, N>;
+        using Steps = std::vector<std::ptrdiff_t>;
+
+        /// \param shape The shape to walk.
+        /// \param steps For each buffer, its offset step along each axis of shape.
+        /// \param origins For each buffer, its offset at coordinate (0,...,0).
+        StridedWalk(const Shape& shape,
+                    const std::array<Steps, N>& steps,
+                    const Offsets& origins = Offsets())
+            : m_origins(origins)
+            , m_inner_length(1)
+            , m_empty(false)
+        {
+            m_inner_steps.fill(0);
+            for (size_t axis = 0; axis < shape.size(); axis++)
+            {
+                size_t extent = shape[axis];
+                if (extent == 0)
+                {
+                    m_empty = true;
+                }
+                if (extent <= 1)
+                {
+                    continue;
+                }
+
+                Offsets axis_steps;
+                bool mergeable = !m_extents.empty();
+                for (size_t i = 0; i < N; i++)
+                {
+                    axis_steps[i] = steps[i].at(axis);
+                    std::ptrdiff_t span = axis_steps[i] * static_cast<std::ptrdiff_t>(extent);
+                    mergeable = mergeable && m_steps.back()[i] == span;
+                }
+                if (mergeable)
+                {
+                    m_extents.back() *= extent;
+                    m_steps.back() = axis_steps;
+                }
+                else
+                {
+                    m_extents.push_back(extent);
+                    m_steps.push_back(axis_steps);
+                }
+            }
+
+            if (!m_extents.empty())
+            {
+                m_inner_length = m_extents.back();
+                m_inner_steps = m_steps.back();
+                m_extents.pop_back();
+                m_steps.pop_back();
+            }
+        }
+
+        /// Length of every run.
+        size_t get_run_length() const { return m_inner_length; }
+        /// Offset step between consecutive elements of a run in the given buffer.
+        std::ptrdiff_t get_inner_step(size_t buffer) const { return m_inner_steps[buffer]; }
+        /// Calls f(offsets, length) for each run, in order.
+        template <typename F>
+        void for_each_run(F f) const
+        {
+            if (m_empty)
+            {
+                return;
+            }
+
+            Offsets offsets = m_origins;
+            std::vector<size_t> coordinate(m_extents.size(), 0);
+            while (true)
+            {
+                f(static_cast<const Offsets&>(offsets), m_inner_length);
+
+                // Carry through the outer axes, innermost first.
+                size_t axis = m_extents.size();
+                while (true)
+                {
+                    if (axis == 0)
+                    {
+                        return;
+                    }
+                    axis--;
+                    for (size_t i = 0; i < N; i++)
+                    {
+                        offsets[i] += m_steps[axis][i];
+                    }
+                    if (++coordinate[axis] < m_extents[axis])
+                    {
+                        break;
+                    }
+                    std::ptrdiff_t extent = static_cast<std::ptrdiff_t>(m_extents[axis]);
+                    for (size_t i = 0; i < N; i++)
+                    {
+                        offsets[i] -= m_steps[axis][i] * extent;
+                    }
+                    coordinate[axis] = 0;
+                }
+            }
+        }
+
+        /// Calls f(offsets) for each element, in order.
+        template <typename F>
+        void for_each(F f) const
+        {
+            for_each_run([&](const Offsets& first, size_t length) {
+                Offsets offsets = first;
+                for (size_t j = 0; j < length; j++)
+                {
+                    f(static_cast<const Offsets&>(offsets));
+                    for (size_t i = 0; i < N; i++)
+                    {
+                        offsets[i] += m_inner_steps[i];
+                    }
+                }
+            });
+        }
+
+    private:
+        Offsets m_origins;
+        std::vector<size_t> m_extents;
+        std::vector<Offsets> m_steps;
+        size_t m_inner_length;
+        Offsets m_inner_steps;
+        bool m_empty;
+    };
+
+    /// Offset steps along each axis of a row-major buffer with the given shape.
+    inline std::vector<std::ptrdiff_t> row_major_steps(const Shape& shape)
+    {
+        std::vector<size_t> strides = row_major_strides(shape);
+        return std::vector<std::ptrdiff_t>(strides.begin(), strides.end());
+    }
+
+    /// Offset steps along each axis of shape for a row-major buffer holding
+    /// project(shape, axes). The projected-away axes step by 0, so walking shape revisits the
+    /// same element of the buffer along them.
+    inline std::vector<std::ptrdiff_t> projected_steps(const Shape& shape, const AxisSet& axes)
+    {
+        std::vector<std::ptrdiff_t> steps(shape.size(), 0);
+        std::ptrdiff_t step = 1;
+        for (size_t axis = shape.size(); axis-- > 0;)
+        {
+            if (axes.count(axis) == 0)
+            {
+                steps[axis] = step;
+                step *= static_cast<std::ptrdiff_t>(shape[axis]);
+            }
+        }
+        return steps;
+    }
+}
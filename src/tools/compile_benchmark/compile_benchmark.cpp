@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <fstream>
+#include <thread>
 #include <ngraph/codegen/compiler.hpp>
 #include <ngraph/codegen/execution_engine.hpp>
 #include <ngraph/file_util.hpp>
@@ -30,14 +31,24 @@ void help()
 DESCRIPTION
     Benchmark compile process identical to ngraph JIT.
 
+    When several files are given they are compiled as separate modules of one execution
+    engine, like the split sources the CPU backend writes to cpu_codegen/ for large functions
+    (<name>_codegen.cpp plus <name>_codegen_<n>.cpp), and compile time is reported for each
+    thread count.
+
 SYNOPSIS
-        compile_benchmark <filename>
+        compile_benchmark [-t <threads>[,<threads>...]] <filename> [<filename>...]
+
+OPTIONS
+        -t|--threads    Comma separated compiler thread counts to time (default: 1 and the
+                        number of hardware threads)
 )###" << endl;
 }
 
 int main(int argc, char** argv)
 {
-    string source_path;
+    vector<string> source_paths;
+    vector<size_t> thread_counts;
     for (size_t i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -45,33 +56,77 @@ int main(int argc, char** argv)
         {
             help();
         }
+        else if ((arg == "-t" || arg == "--threads") && i + 1 < argc)
+        {
+            for (const string& count : split(argv[++i], ','))
+            {
+                thread_counts.push_back(stoul(count));
+            }
+        }
         else
         {
-            source_path = arg;
+            source_paths.push_back(arg);
         }
     }
 
-    if (!file_util::exists(source_path))
+    if (source_paths.empty())
     {
-        cout << "file '" << source_path << "' not found\n";
         help();
         return 1;
     }
-    else
+    vector<string> sources;
+    for (const string& source_path : source_paths)
+    {
+        if (!file_util::exists(source_path))
+        {
+            cout << "file '" << source_path << "' not found\n";
+            help();
+            return 1;
+        }
+        sources.push_back(file_util::read_file_to_string(source_path));
+    }
+    if (thread_counts.empty())
+    {
+        thread_counts.push_back(1);
+        if (thread::hardware_concurrency() > 1 && sources.size() > 1)
+        {
+            thread_counts.push_back(thread::hardware_concurrency());
+        }
+    }
+
+    double baseline_ms = 0;
+    for (size_t thread_count : thread_counts)
     {
         stopwatch timer;
 
-        const string source_string = file_util::read_file_to_string(source_path);
         codegen::Compiler compiler;
         codegen::ExecutionEngine engine;
+        // Time the compiler itself rather than the module cache
+        compiler.set_cache_directory("");
+        compiler.set_thread_count(thread_count);
 
         timer.start();
-        auto module = compiler.compile(source_string);
+        auto modules = compiler.compile_modules(sources);
         timer.stop();
-        cout << "compile took " << timer.get_milliseconds() << "ms\n";
+        double compile_ms = timer.get_milliseconds();
+        if (baseline_ms == 0)
+        {
+            baseline_ms = compile_ms;
+        }
+        cout << "compile of " << sources.size() << " module(s) on " << thread_count
+             << " thread(s) took " << compile_ms << "ms (" << baseline_ms / compile_ms
+             << "x)\n";
 
         timer.start();
-        engine.add_module(module);
+        for (auto& module : modules)
+        {
+            if (!module)
+            {
+                cout << "compile failed\n";
+                return 1;
+            }
+            engine.add_module(module);
+        }
         engine.finalize();
         timer.stop();
         cout << "execution engine took " << timer.get_milliseconds() << "ms\n";
@@ -14,6 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
@@ -34,3 +41,154 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+namespace
+{
+    // A backend whose calls block until the test releases them, so that the test decides how
+    // many calls are in flight
+    class GatedBackend : public runtime::Backend
+    {
+    public:
+        GatedBackend(bool concurrent = true)
+            : m_concurrent(concurrent)
+        {
+        }
+        ~GatedBackend() override { wait_for_async_calls(); }
+        using Backend::wait_for_async_calls;
+
+        bool supports_concurrent_calls() const override { return m_concurrent; }
+
+        shared_ptr<runtime::TensorView> create_tensor(const element::Type& element_type,
+                                                      const Shape& shape) override
+        {
+            return nullptr;
+        }
+
+        shared_ptr<runtime::TensorView> create_tensor(const element::Type& element_type,
+                                                      const Shape& shape,
+                                                      void* memory_pointer) override
+        {
+            return nullptr;
+        }
+
+        bool compile(shared_ptr<Function> func) override { return true; }
+        bool call(shared_ptr<Function> func,
+                  const vector<shared_ptr<runtime::TensorView>>& outputs,
+                  const vector<shared_ptr<runtime::TensorView>>& inputs) override
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_running++;
+            m_changed.notify_all();
+            m_changed.wait(lock, [this]() { return m_released > 0; });
+            m_released--;
+            m_running--;
+            return true;
+        }
+
+        // Notifies under the lock, so that a call released here can't finish and let the
+        // backend be destroyed before this returns
+        void release(size_t count)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_released += count;
+            m_changed.notify_all();
+        }
+
+        void wait_for_running(size_t count)
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_changed.wait(lock, [this, count]() { return m_running == count; });
+        }
+
+    private:
+        bool m_concurrent;
+        size_t m_running = 0;
+        size_t m_released = 0;
+        mutex m_mutex;
+        condition_variable m_changed;
+    };
+}
+
+TEST(backend_api, call_async_in_flight_limit)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), op::ParameterVector{A});
+    weak_ptr<Function> weak_f = f;
+
+    GatedBackend backend;
+    backend.set_max_in_flight_calls(f, 2);
+    future<bool> first = backend.call_async(f, {}, {});
+    future<bool> second = backend.call_async(f, {}, {});
+    backend.wait_for_running(2);
+
+    // A third call waits for one of the two in flight to finish
+    atomic<bool> submitted{false};
+    future<bool> third;
+    thread producer([&]() {
+        third = backend.call_async(f, {}, {});
+        submitted = true;
+    });
+    this_thread::sleep_for(chrono::milliseconds(100));
+    EXPECT_FALSE(submitted);
+    backend.release(1);
+    producer.join();
+    EXPECT_TRUE(submitted);
+
+    backend.release(2);
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+    EXPECT_TRUE(third.get());
+
+    // Once its calls are done, the backend no longer holds the function
+    backend.wait_for_async_calls();
+    f.reset();
+    EXPECT_TRUE(weak_f.expired());
+}
+
+TEST(backend_api, call_async_serial_backend)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), op::ParameterVector{A});
+
+    GatedBackend backend(false);
+    EXPECT_EQ(1, backend.get_max_in_flight_calls(f));
+    EXPECT_THROW(backend.set_max_in_flight_calls(f, 2), runtime_error);
+    future<bool> first = backend.call_async(f, {}, {});
+    backend.wait_for_running(1);
+
+    // A backend without concurrent calls never runs a second call of f next to the first
+    atomic<bool> submitted{false};
+    future<bool> second;
+    thread producer([&]() {
+        second = backend.call_async(f, {}, {});
+        submitted = true;
+    });
+    this_thread::sleep_for(chrono::milliseconds(100));
+    EXPECT_FALSE(submitted);
+    backend.release(2);
+    producer.join();
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+}
+
+TEST(backend_api, call_async_drained_by_destructor)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), op::ParameterVector{A});
+
+    future<bool> result;
+    thread releaser;
+    {
+        GatedBackend backend;
+        result = backend.call_async(f, {}, {});
+        backend.wait_for_running(1);
+        releaser = thread([&backend]() {
+            this_thread::sleep_for(chrono::milliseconds(50));
+            backend.release(1);
+        });
+        // The destructor waits for the call, which runs on the backend
+    }
+    releaser.join();
+    EXPECT_EQ(future_status::ready, result.wait_for(chrono::seconds(0)));
+    EXPECT_TRUE(result.get());
+}
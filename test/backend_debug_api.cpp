@@ -14,15 +14,18 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/random.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -73,3 +76,231 @@ TEST(INTERPRETER, nan_check_output)
     ibackend->set_nan_check(f, true);
     EXPECT_ANY_THROW(ibackend->call(f, {result}, {a, b}));
 }
+
+TEST(INTERPRETER, repeated_calls)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto sum = A + B;
+    auto product = (sum * (sum - C)) * B;
+    auto f = make_shared<Function>(NodeVector{product, sum, A}, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto result_sum = backend->create_tensor(element::f32, shape);
+    auto result_a = backend->create_tensor(element::f32, shape);
+
+    // Intermediates are reused between calls, the caller's tensors are bound anew
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    backend->call(f, {result, result_sum, result_a}, {a, b});
+    EXPECT_EQ((vector<float>{150, 336, 630, 1056}), read_vector<float>(result));
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(result_sum));
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), read_vector<float>(result_a));
+
+    auto b2 = backend->create_tensor(element::f32, shape);
+    copy_data(b2, vector<float>{1, 1, 1, 1});
+    backend->call(f, {result_a, result_sum, result}, {b, b2});
+    EXPECT_EQ((vector<float>{30, 42, 56, 72}), read_vector<float>(result_a));
+    EXPECT_EQ((vector<float>{6, 7, 8, 9}), read_vector<float>(result_sum));
+    EXPECT_EQ((vector<float>{5, 6, 7, 8}), read_vector<float>(result));
+}
+
+TEST(INTERPRETER, graph_rewritten_after_compile)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::Add>(A, B);
+    auto f = make_shared<Function>(sum * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    backend->enable_performance_data(f, true);
+    backend->compile(f);
+
+    // The compiled plan keeps the ops it was built from, so replacing one in the graph
+    // neither frees it under the plan nor changes what the plan computes
+    replace_node(sum, make_shared<op::Subtract>(A, B));
+    sum.reset();
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{30, 48, 70, 96}), read_vector<float>(result));
+    EXPECT_EQ(f->get_ordered_ops().size() - 2, backend->get_performance_data(f).size());
+
+    backend->remove_compiled_function(f);
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ((vector<float>{-20, -24, -28, -32}), read_vector<float>(result));
+}
+
+TEST(INTERPRETER, concurrent_calls)
+{
+    Shape shape{1 << 14};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, op::ParameterVector{A, B});
+    auto g = make_shared<Function>(A * B - A, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+
+    // Each thread calls both functions with its own tensors, so calls of the same function
+    // and of different functions overlap
+    size_t thread_count = 4;
+    vector<size_t> mismatches(thread_count, 0);
+    vector<thread> threads;
+    for (size_t t = 0; t < thread_count; t++)
+    {
+        threads.emplace_back([&, t] {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            copy_data(a, vector<float>(shape_size(shape), t));
+            copy_data(b, vector<float>(shape_size(shape), 2));
+            for (size_t i = 0; i < 50; i++)
+            {
+                bool use_f = (i + t) % 2 == 0;
+                backend->call(use_f ? f : g, {result}, {a, b});
+                float expected = use_f ? (t + 2.0f) * 2.0f : t * 2.0f - t;
+                if (read_vector<float>(result) != vector<float>(shape_size(shape), expected))
+                {
+                    mismatches[t]++;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    EXPECT_EQ(vector<size_t>(thread_count, 0), mismatches);
+}
+
+TEST(INTERPRETER, parallel_kernels_match_serial)
+{
+    // The slow convolutions get a small image, the other kernels a large one
+    auto make_function = [](size_t batch, size_t small_image, size_t large_image) {
+        auto X =
+            make_shared<op::Parameter>(element::f32, Shape{batch, 4, small_image, small_image});
+        auto W = make_shared<op::Parameter>(element::f32, Shape{8, 4, 3, 3});
+        auto Y =
+            make_shared<op::Parameter>(element::f32, Shape{batch, 16, large_image, large_image});
+        auto M = make_shared<op::Parameter>(element::f32, Shape{large_image, 10});
+        auto conv = make_shared<op::Convolution>(X, W);
+        Shape window{2, 2};
+        Strides strides{2, 2};
+        Shape padding{0, 0};
+        auto max_pool = make_shared<op::MaxPool>(Y, window, strides);
+        auto avg_pool = make_shared<op::AvgPool>(Y, window, strides);
+        NodeVector results{
+            conv,
+            make_shared<op::ConvolutionBackpropData>(X->get_shape(),
+                                                     W,
+                                                     conv,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{0, 0},
+                                                     CoordinateDiff{0, 0},
+                                                     Strides{1, 1}),
+            max_pool,
+            avg_pool,
+            make_shared<op::MaxPoolBackprop>(Y, max_pool, window, strides, padding, padding),
+            make_shared<op::AvgPoolBackprop>(
+                Y->get_shape(), avg_pool, window, strides, padding, padding, false),
+            make_shared<op::Dot>(Y, M),
+            make_shared<op::Sum>(Y, AxisSet{1}),
+            make_shared<op::Sum>(Y, AxisSet{0, 2}),
+            make_shared<op::Max>(Y, AxisSet{2, 3}),
+            make_shared<op::Min>(Y, AxisSet{1, 3}),
+            make_shared<op::Product>(Y, AxisSet{0}),
+            make_shared<op::Softmax>(Y, AxisSet{1}),
+            make_shared<op::Broadcast>(M, Shape{large_image, 10, 256}, AxisSet{2}),
+            make_shared<op::Broadcast>(W, Shape{128, 8, 4, 3, 3}, AxisSet{0})};
+        return make_shared<Function>(results, op::ParameterVector{X, W, Y, M});
+    };
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto ibackend = static_pointer_cast<runtime::interpreter::INTBackend>(backend);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+
+    // A batch is split by image, a single image by channel
+    for (size_t batch : {4, 1})
+    {
+        auto f = batch == 1 ? make_function(batch, 24, 64) : make_function(batch, 12, 32);
+
+        vector<shared_ptr<runtime::TensorView>> inputs;
+        for (auto param : f->get_parameters())
+        {
+            inputs.push_back(rng.initialize(
+                backend->create_tensor(param->get_element_type(), param->get_shape())));
+        }
+        auto run = [&](size_t thread_count) {
+            ibackend->set_thread_count(thread_count);
+            vector<shared_ptr<runtime::TensorView>> outputs;
+            for (size_t i = 0; i < f->get_output_size(); i++)
+            {
+                outputs.push_back(
+                    backend->create_tensor(f->get_output_element_type(i), f->get_output_shape(i)));
+            }
+            backend->call(f, outputs, inputs);
+            vector<vector<float>> values;
+            for (auto output : outputs)
+            {
+                values.push_back(read_vector<float>(output));
+            }
+            return values;
+        };
+
+        auto serial = run(1);
+        auto parallel = run(3);
+        for (size_t i = 0; i < serial.size(); i++)
+        {
+            EXPECT_EQ(serial[i], parallel[i]) << f->get_output_op(i)->get_argument(0)->get_name();
+        }
+    }
+    ibackend->set_thread_count(1);
+}
+
+TEST(INTERPRETER, set_thread_count_during_calls)
+{
+    auto M = make_shared<op::Parameter>(element::f32, Shape{1024});
+    auto f = make_shared<Function>(make_shared<op::Broadcast>(M, Shape{64, 1024}, AxisSet{0}),
+                                   op::ParameterVector{M});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto ibackend = static_pointer_cast<runtime::interpreter::INTBackend>(backend);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto m = rng.initialize(backend->create_tensor(element::f32, Shape{1024}));
+    vector<float> row = read_vector<float>(m);
+    vector<float> expected;
+    for (size_t i = 0; i < 64; i++)
+    {
+        expected.insert(expected.end(), row.begin(), row.end());
+    }
+
+    // Calls running on a pool keep it while it is replaced
+    atomic<bool> done{false};
+    thread resizer([&]() {
+        for (size_t i = 0; !done; i++)
+        {
+            ibackend->set_thread_count(1 + i % 3);
+        }
+    });
+    auto result = backend->create_tensor(element::f32, Shape{64, 1024});
+    for (size_t i = 0; i < 200; i++)
+    {
+        backend->call(f, {result}, {m});
+        EXPECT_EQ(expected, read_vector<float>(result));
+    }
+    done = true;
+    resizer.join();
+    ibackend->set_thread_count(1);
+}
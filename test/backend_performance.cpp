@@ -14,8 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <malloc.h>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -23,11 +32,37 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/ngraph.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/pass/core_fusion.hpp"
+#include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/result_copy_elimination.hpp"
+#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/label.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/reference/one_hot.hpp"
+#include "ngraph/runtime/reference/pad.hpp"
+#include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "util/all_close.hpp"
 #include "util/benchmark.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
@@ -194,3 +229,958 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Runs one replica of a memory bound graph per NUMA node at the same time, with each replica's
+// threads (the caller, its Eigen pool and its OpenMP workers), constants, temporaries and
+// tensors placed on its node and then with the same thread counts but nothing placed. Without
+// NUMA it runs a single replica on node 0.
+//
+// NGRAPH_BENCHMARK_FAKE_NUMA_NODES=n splits the CPUs into n nodes instead, to exercise the
+// replicas on a machine without NUMA. Placing a replica then only pins its threads to the CPUs
+// of its node, its memory stays where it is allocated.
+//
+TEST(benchmark, cpu_numa_replicas)
+{
+    const size_t iterations = 20;
+    Shape shape{1 << 22};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C =
+            op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 0.5f));
+        return make_shared<Function>((A + B) * C - A, op::ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    vector<runtime::cpu::numa::Node> nodes = runtime::cpu::numa::get_nodes();
+    const char* fake_node_count = getenv("NGRAPH_BENCHMARK_FAKE_NUMA_NODES");
+    if (fake_node_count != nullptr)
+    {
+        vector<int> cpus;
+        for (const auto& node : nodes)
+        {
+            cpus.insert(cpus.end(), node.m_cpus.begin(), node.m_cpus.end());
+        }
+        size_t node_count = min(static_cast<size_t>(max(atoi(fake_node_count), 1)), cpus.size());
+        nodes.assign(node_count, runtime::cpu::numa::Node{});
+        for (size_t i = 0; i < cpus.size(); i++)
+        {
+            size_t node_id = i * node_count / cpus.size();
+            nodes[node_id].m_id = node_id;
+            nodes[node_id].m_cpus.push_back(cpus[i]);
+        }
+    }
+    vector<float> input(shape_size(shape), 1.0f);
+
+    for (bool placed : {true, false})
+    {
+        vector<shared_ptr<Function>> replicas;
+        vector<vector<shared_ptr<runtime::TensorView>>> args;
+        vector<shared_ptr<runtime::TensorView>> results;
+        for (const auto& node : nodes)
+        {
+            auto f = make_function();
+            auto create_tensor = [&]() {
+                return placed && fake_node_count == nullptr
+                           ? cpu_backend->create_tensor_on_node(element::f32, shape, node.m_id)
+                           : backend->create_tensor(element::f32, shape);
+            };
+            shared_ptr<runtime::cpu::CPUExecutor> executor;
+            if (!placed)
+            {
+                executor = make_shared<runtime::cpu::CPUExecutor>(node.m_cpus.size());
+            }
+            else if (fake_node_count != nullptr)
+            {
+                executor =
+                    make_shared<runtime::cpu::CPUExecutor>(node.m_cpus.size(), node.m_cpus);
+            }
+            else
+            {
+                executor = runtime::cpu::CPUExecutor::create_for_numa_node(node.m_id);
+            }
+            cpu_backend->set_executor(f, executor);
+            backend->compile(f);
+            replicas.push_back(f);
+            args.push_back({create_tensor(), create_tensor()});
+            copy_data(args.back()[0], input);
+            copy_data(args.back()[1], input);
+            results.push_back(create_tensor());
+        }
+
+        stopwatch timer;
+        timer.start();
+        vector<thread> threads;
+        for (size_t i = 0; i < replicas.size(); i++)
+        {
+            threads.emplace_back([&, i]() {
+                for (size_t j = 0; j < iterations; j++)
+                {
+                    backend->call(replicas[i], {results[i]}, args[i]);
+                }
+            });
+        }
+        for (auto& th : threads)
+        {
+            th.join();
+        }
+        timer.stop();
+
+        string label = "Unplaced:    ";
+        if (placed)
+        {
+            label = (fake_node_count != nullptr ? "Pinned:      " : "NUMA placed: ");
+        }
+        cout << label << replicas.size() << " replicas x " << iterations << " calls in "
+             << timer.get_milliseconds() << "ms (" << timer.get_microseconds() / iterations
+             << " us/call)" << endl;
+        for (auto result : results)
+        {
+            EXPECT_EQ(vector<float>(shape_size(shape), 0.0f), read_vector<float>(result));
+        }
+    }
+}
+
+//
+// Serves a stream of requests whose inputs are copied from host memory into the backend's
+// tensors, first with call and then pipelined with call_async, which stages the inputs of a
+// request while the previous one computes.
+//
+TEST(benchmark, call_async_pipelining)
+{
+    const size_t request_count = 100;
+    const size_t in_flight = 2;
+    Shape shape{256, 256};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Tanh>(make_shared<op::Dot>(A, B)) + B,
+                                     op::ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> request_inputs;
+    for (size_t i = 0; i < 4; i++)
+    {
+        vector<float> input(shape_size(shape));
+        rng.initialize(input);
+        request_inputs.push_back(input);
+    }
+
+    vector<string> backend_names{"CPU"};
+#ifdef NGRAPH_INTERPRETER_ENABLE
+    backend_names.push_back("INTERPRETER");
+#endif
+    for (const string& backend_name : backend_names)
+    {
+        auto backend = runtime::Backend::create(backend_name);
+        auto f = make_function();
+        backend->set_max_in_flight_calls(f, in_flight);
+        backend->compile(f);
+
+        vector<vector<float>> checksums;
+        for (bool pipelined : {false, true})
+        {
+            struct Slot
+            {
+                shared_ptr<runtime::TensorView> a, b, result;
+                future<bool> call;
+            };
+            vector<Slot> slots(in_flight);
+            for (Slot& slot : slots)
+            {
+                slot.a = backend->create_tensor(element::f32, shape);
+                slot.b = backend->create_tensor(element::f32, shape);
+                slot.result = backend->create_tensor(element::f32, shape);
+            }
+            vector<float> checksum;
+            auto finish = [&](Slot& slot) {
+                if (slot.call.valid())
+                {
+                    slot.call.get();
+                }
+                vector<float> result = read_vector<float>(slot.result);
+                checksum.push_back(accumulate(result.begin(), result.end(), 0.0f));
+            };
+
+            stopwatch timer;
+            timer.start();
+            for (size_t i = 0; i < request_count; i++)
+            {
+                Slot& slot = slots[i % in_flight];
+                if (i >= in_flight && pipelined)
+                {
+                    finish(slot);
+                }
+                copy_data(slot.a, request_inputs[i % request_inputs.size()]);
+                copy_data(slot.b, request_inputs[(i + 1) % request_inputs.size()]);
+                if (pipelined)
+                {
+                    slot.call = backend->call_async(f, {slot.result}, {slot.a, slot.b});
+                }
+                else
+                {
+                    backend->call(f, {slot.result}, {slot.a, slot.b});
+                    finish(slot);
+                }
+            }
+            for (size_t i = request_count; pipelined && i < request_count + in_flight; i++)
+            {
+                finish(slots[i % in_flight]);
+            }
+            timer.stop();
+
+            cout << backend_name << (pipelined ? " call_async: " : " call:       ")
+                 << request_count << " requests in " << timer.get_milliseconds() << "ms ("
+                 << request_count * 1000000.0 / timer.get_microseconds() << " requests/s)"
+                 << endl;
+            checksums.push_back(checksum);
+        }
+        EXPECT_TRUE(test::all_close(checksums[0], checksums[1]));
+        backend->remove_compiled_function(f);
+    }
+}
+
+//
+// Drives single-sample MLP requests at a fixed arrival rate through a BatchingExecutor and
+// reports latency percentiles and throughput, unbatched and batched. The rates are set relative
+// to the unbatched capacity measured first, so one run is below it and one above it.
+//
+TEST(benchmark, batching_executor)
+{
+    const size_t request_count = 400;
+    const size_t input_size = 64;
+    const size_t hidden_size = 64;
+    const size_t output_size = 16;
+    test::Uniform<float> rng(-0.1f, 0.1f);
+    vector<float> w1(input_size * hidden_size);
+    vector<float> w2(hidden_size * output_size);
+    rng.initialize(w1);
+    rng.initialize(w2);
+    auto make_function = [&](size_t batch_size) {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{batch_size, input_size});
+        auto W1 = op::Constant::create(element::f32, Shape{input_size, hidden_size}, w1);
+        auto W2 = op::Constant::create(element::f32, Shape{hidden_size, output_size}, w2);
+        auto hidden = make_shared<op::Relu>(make_shared<op::Dot>(X, W1));
+        return make_shared<Function>(make_shared<op::Tanh>(make_shared<op::Dot>(hidden, W2)),
+                                     op::ParameterVector{X});
+    };
+
+    vector<string> backend_names{"CPU"};
+#ifdef NGRAPH_INTERPRETER_ENABLE
+    backend_names.push_back("INTERPRETER");
+#endif
+    for (const string& backend_name : backend_names)
+    {
+        auto backend = runtime::Backend::create(backend_name);
+        vector<shared_ptr<runtime::TensorView>> inputs;
+        vector<shared_ptr<runtime::TensorView>> outputs;
+        for (size_t i = 0; i < request_count; i++)
+        {
+            vector<float> input(input_size);
+            rng.initialize(input);
+            inputs.push_back(backend->create_tensor(element::f32, Shape{input_size}));
+            copy_data(inputs.back(), input);
+            outputs.push_back(backend->create_tensor(element::f32, Shape{output_size}));
+        }
+
+        // Submits the requests every interval and returns each one's latency in microseconds
+        auto run_load = [&](runtime::BatchingExecutor& executor, chrono::microseconds interval) {
+            vector<future<void>> done(request_count);
+            vector<chrono::steady_clock::time_point> arrivals(request_count);
+            vector<double> latencies(request_count);
+            atomic<size_t> submitted(0);
+            // Batches complete in arrival order, so waiting in order stamps each completion
+            thread collector([&]() {
+                for (size_t i = 0; i < request_count; i++)
+                {
+                    while (submitted.load(memory_order_acquire) <= i)
+                    {
+                        this_thread::yield();
+                    }
+                    done[i].get();
+                    latencies[i] = chrono::duration<double, micro>(chrono::steady_clock::now() -
+                                                                   arrivals[i])
+                                       .count();
+                }
+            });
+            auto start = chrono::steady_clock::now();
+            for (size_t i = 0; i < request_count; i++)
+            {
+                this_thread::sleep_until(start + i * interval);
+                arrivals[i] = chrono::steady_clock::now();
+                done[i] = executor.submit({outputs[i]}, {inputs[i]});
+                submitted.store(i + 1, memory_order_release);
+            }
+            collector.join();
+            return latencies;
+        };
+
+        // The time of an unbatched call, from back-to-back requests
+        double call_us;
+        {
+            runtime::BatchingExecutor executor(
+                backend, make_function, {1}, chrono::microseconds(0));
+            stopwatch timer;
+            timer.start();
+            run_load(executor, chrono::microseconds(0));
+            timer.stop();
+            call_us = double(timer.get_microseconds()) / request_count;
+        }
+
+        for (double load : {0.5, 2.0})
+        {
+            auto interval = chrono::microseconds(max<int64_t>(1, int64_t(call_us / load)));
+            for (bool batched : {false, true})
+            {
+                vector<size_t> batch_sizes{1};
+                if (batched)
+                {
+                    batch_sizes = {1, 2, 4, 8, 16};
+                }
+                auto timeout = chrono::microseconds(batched ? int64_t(2 * call_us) : 0);
+                runtime::BatchingExecutor executor(backend, make_function, batch_sizes, timeout);
+
+                stopwatch timer;
+                timer.start();
+                vector<double> latencies = run_load(executor, interval);
+                timer.stop();
+                sort(latencies.begin(), latencies.end());
+
+                cout << backend_name << (batched ? " batched:   " : " unbatched: ") << load
+                     << "x load, p50 " << latencies[request_count / 2] << "us, p99 "
+                     << latencies[request_count * 99 / 100] << "us, "
+                     << request_count * 1000000.0 / timer.get_microseconds()
+                     << " requests/s in " << executor.get_batch_count() << " calls" << endl;
+            }
+        }
+    }
+}
+
+//
+// Times a graph of many small ops, which spends its time in the interpreter's per-op overhead.
+//
+TEST(benchmark, interpreter_small_ops)
+{
+    const size_t ops = 1000;
+    const size_t iterations = 100;
+
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> node = A;
+    for (size_t i = 0; i < ops; i++)
+    {
+        node = i % 2 ? node * B : node + B;
+    }
+    auto f = make_shared<Function>(node, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0, 0, 0, 0});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    auto result = backend->create_tensor(element::f32, shape);
+    backend->call(f, {result}, {a, b});
+
+    stopwatch timer;
+    timer.start();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        backend->call(f, {result}, {a, b});
+    }
+    timer.stop();
+    cout << ops << " ops: " << timer.get_microseconds() / iterations << "us per call" << endl;
+    EXPECT_EQ((vector<float>{500, 500, 500, 500}), read_vector<float>(result));
+}
+
+//
+// Compares compile time and call latency of the CPU backend's codegen and direct execution
+// (NGRAPH_DEX) modes over every serialized model in the test zoo.
+//
+TEST(benchmark, cpu_dex_vs_codegen)
+{
+    const size_t iterations = 10;
+
+    for (const string& model : get_serialized_models())
+    {
+        stringstream ss(file_util::read_file_to_string(model));
+        shared_ptr<Function> f = deserialize(ss);
+
+        for (bool dex : {false, true})
+        {
+            ScopedEnvironmentVariable execution_mode("NGRAPH_DEX", dex ? "1" : nullptr);
+
+            // Each mode compiles a private copy so that neither reuses the other's state
+            auto g = clone_function(*f);
+            auto backend = runtime::Backend::create("CPU");
+
+            vector<shared_ptr<runtime::TensorView>> args;
+            for (shared_ptr<op::Parameter> param : g->get_parameters())
+            {
+                args.push_back(
+                    backend->create_tensor(param->get_element_type(), param->get_shape()));
+            }
+            vector<shared_ptr<runtime::TensorView>> results;
+            for (shared_ptr<Node> out : g->get_results())
+            {
+                results.push_back(
+                    backend->create_tensor(out->get_element_type(), out->get_shape()));
+            }
+
+            stopwatch compile_timer;
+            compile_timer.start();
+            backend->compile(g);
+            compile_timer.stop();
+
+            stopwatch call_timer;
+            call_timer.start();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                backend->call(g, results, args);
+            }
+            call_timer.stop();
+
+            cout << file_util::get_file_name(model) << (dex ? " DEX" : " codegen")
+                 << ": compile " << compile_timer.get_milliseconds() << "ms, "
+                 << call_timer.get_microseconds() / iterations << "us per call" << endl;
+        }
+    }
+}
+
+//
+// Compiles a chain of 20000 ops on the CPU backend in direct execution mode with and without
+// the task graph, which orders every reuse of a pool buffer after the previous users of the
+// buffer. The chain reuses the same two buffers throughout.
+//
+TEST(benchmark, cpu_large_graph_compile)
+{
+    Shape shape{16};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> x = a;
+    for (size_t i = 0; i < 20000; i++)
+    {
+        x = make_shared<op::Negative>(x);
+    }
+    auto f = make_shared<Function>(x, op::ParameterVector{a});
+
+    vector<float> input(shape_size(shape));
+    iota(input.begin(), input.end(), 1.0f);
+    for (bool task_graph : {false, true})
+    {
+        ScopedEnvironmentVariable execution_mode("NGRAPH_DEX", "1");
+        ScopedEnvironmentVariable task_graph_mode("NGRAPH_CPU_USE_TASK_GRAPH",
+                                                  task_graph ? "1" : nullptr);
+
+        auto g = clone_function(*f);
+        auto backend = runtime::Backend::create("CPU");
+        auto arg = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(arg, input);
+
+        stopwatch timer;
+        timer.start();
+        backend->compile(g);
+        timer.stop();
+        backend->call(g, {result}, {arg});
+
+        cout << "DEX" << (task_graph ? " with task graph" : "") << ": compile "
+             << timer.get_milliseconds() << "ms for " << g->get_ops().size() << " ops" << endl;
+        EXPECT_EQ(input, read_vector<float>(result));
+    }
+}
+
+//
+// Times the CPU backend's generic kernels against the reference kernels they replace in the
+// code generator's fallback paths, and checks that both produce the same result.
+//
+TEST(benchmark, cpu_kernels_vs_reference)
+{
+    const size_t iterations = 10;
+
+    auto compare = [&](const string& name,
+                       std::function<void()> reference_kernel,
+                       std::function<void()> cpu_kernel,
+                       std::function<bool()> results_match) {
+        stopwatch reference_timer;
+        reference_timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            reference_kernel();
+        }
+        reference_timer.stop();
+
+        stopwatch cpu_timer;
+        cpu_timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            cpu_kernel();
+        }
+        cpu_timer.stop();
+
+        double reference_us = reference_timer.get_microseconds() / iterations;
+        double cpu_us = cpu_timer.get_microseconds() / iterations;
+        cout << name << ": reference " << reference_us << "us, cpu " << cpu_us << "us ("
+             << reference_us / max(cpu_us, 1.0) << "x)" << endl;
+        EXPECT_TRUE(results_match()) << name;
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+
+    Shape shape{16, 32, 28, 28};
+    vector<float> input(shape_size(shape));
+    rng.initialize(input);
+    const float* in = input.data();
+    vector<float> expected(shape_size(shape));
+    vector<float> actual(shape_size(shape));
+
+    AxisSet reversed{1, 3};
+    compare("reverse",
+            [&]() { runtime::reference::reverse(in, expected.data(), shape, shape, reversed); },
+            [&]() {
+                runtime::cpu::kernel::reverse_nd(in, actual.data(), 4, shape, reversed);
+            },
+            [&]() { return expected == actual; });
+
+    Shape padded{16, 32, 58, 58};
+    Shape below{0, 0, 1, 1};
+    Shape above{0, 0, 2, 2};
+    Shape interior{0, 0, 1, 1};
+    float pad_value = 0.5f;
+    vector<float> padded_expected(shape_size(padded));
+    vector<float> padded_actual(shape_size(padded));
+    compare("pad",
+            [&]() {
+                runtime::reference::pad(in,
+                                        &pad_value,
+                                        padded_expected.data(),
+                                        shape,
+                                        padded,
+                                        below,
+                                        above,
+                                        interior);
+            },
+            [&]() {
+                runtime::cpu::kernel::pad_nd(
+                    in, &pad_value, padded_actual.data(), 4, shape, padded, below, interior);
+            },
+            [&]() { return padded_expected == padded_actual; });
+
+    AxisSet reduction_axes{0, 2};
+    Shape reduced{32, 28};
+    vector<float> reduced_expected(shape_size(reduced));
+    vector<float> reduced_actual(shape_size(reduced));
+    compare("max",
+            [&]() {
+                runtime::reference::max(
+                    in, reduced_expected.data(), shape, reduced, reduction_axes);
+            },
+            [&]() {
+                runtime::cpu::kernel::reduce_max_nd(
+                    in, reduced_actual.data(), shape, reduction_axes);
+            },
+            [&]() { return reduced_expected == reduced_actual; });
+    compare("min",
+            [&]() {
+                runtime::reference::min(
+                    in, reduced_expected.data(), shape, reduced, reduction_axes);
+            },
+            [&]() {
+                runtime::cpu::kernel::reduce_min_nd(
+                    in, reduced_actual.data(), shape, reduction_axes);
+            },
+            [&]() { return reduced_expected == reduced_actual; });
+    compare("product",
+            [&]() {
+                runtime::reference::product(
+                    in, reduced_expected.data(), shape, reduced, reduction_axes);
+            },
+            [&]() {
+                runtime::cpu::kernel::reduce_product_nd(
+                    in, reduced_actual.data(), shape, reduction_axes);
+            },
+            [&]() { return reduced_expected == reduced_actual; });
+
+    Shape window{3, 3};
+    Strides strides{2, 2};
+    Shape padding{1, 1};
+    Shape pooled{16, 32, 14, 14};
+    vector<float> pooled_expected(shape_size(pooled));
+    vector<float> pooled_actual(shape_size(pooled));
+    compare("max_pool",
+            [&]() {
+                runtime::reference::max_pool(
+                    in, pooled_expected.data(), shape, pooled, window, strides, padding, padding);
+            },
+            [&]() {
+                runtime::cpu::kernel::max_pool_nd(
+                    in, pooled_actual.data(), shape, pooled, window, strides, padding);
+            },
+            [&]() { return pooled_expected == pooled_actual; });
+    compare("avg_pool",
+            [&]() {
+                runtime::reference::avg_pool(in,
+                                             pooled_expected.data(),
+                                             shape,
+                                             pooled,
+                                             window,
+                                             strides,
+                                             padding,
+                                             padding,
+                                             false);
+            },
+            [&]() {
+                runtime::cpu::kernel::avg_pool_nd(
+                    in, pooled_actual.data(), shape, pooled, window, strides, padding, false);
+            },
+            [&]() { return pooled_expected == pooled_actual; });
+
+    // Integer dot products accumulate in the same order as the reference and match exactly.
+    Shape arg0_shape{64, 8, 32};
+    Shape arg1_shape{8, 32, 256};
+    Shape dot_shape{64, 256};
+    vector<int32_t> arg0(shape_size(arg0_shape));
+    vector<int32_t> arg1(shape_size(arg1_shape));
+    for (size_t i = 0; i < arg0.size(); i++)
+    {
+        arg0[i] = static_cast<int32_t>(i % 7) - 3;
+    }
+    for (size_t i = 0; i < arg1.size(); i++)
+    {
+        arg1[i] = static_cast<int32_t>(i % 5) - 2;
+    }
+    vector<int32_t> dot_expected(shape_size(dot_shape));
+    vector<int32_t> dot_actual(shape_size(dot_shape));
+    compare("dot",
+            [&]() {
+                runtime::reference::dot(arg0.data(),
+                                        arg1.data(),
+                                        dot_expected.data(),
+                                        arg0_shape,
+                                        arg1_shape,
+                                        dot_shape,
+                                        2);
+            },
+            [&]() {
+                runtime::cpu::kernel::dot_nd(
+                    arg0.data(), arg1.data(), dot_actual.data(), arg0_shape, arg1_shape, 2);
+            },
+            [&]() { return dot_expected == dot_actual; });
+
+    Shape indices_shape{64, 1024};
+    Shape one_hot_shape{64, 16, 1024};
+    vector<int32_t> indices(shape_size(indices_shape));
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = static_cast<int32_t>(i % 16);
+    }
+    vector<int32_t> one_hot_expected(shape_size(one_hot_shape));
+    vector<int32_t> one_hot_actual(shape_size(one_hot_shape));
+    compare("one_hot",
+            [&]() {
+                runtime::reference::one_hot(
+                    indices.data(), one_hot_expected.data(), indices_shape, one_hot_shape, 1);
+            },
+            [&]() {
+                runtime::cpu::kernel::one_hot_nd(
+                    indices.data(), one_hot_actual.data(), indices_shape, one_hot_shape, 1);
+            },
+            [&]() { return one_hot_expected == one_hot_actual; });
+}
+
+//
+// Reports the temporary pool of the test/models networks with and without memory sharing.
+//
+TEST(benchmark, memory_layout_sharing)
+{
+    for (const string& model : get_serialized_models())
+    {
+        size_t pool_size[2];
+        for (bool disable_memory_sharing : {false, true})
+        {
+            shared_ptr<Function> f = deserialize(file_util::read_file_to_string(model));
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.register_pass<pass::MemoryLayout>(64, disable_memory_sharing);
+            pass_manager.run_passes(f);
+            pool_size[disable_memory_sharing] = f->get_temporary_pool_size();
+        }
+        cout << file_util::get_file_name(model) << ": " << pool_size[1] << " -> " << pool_size[0]
+             << " bytes" << endl;
+    }
+}
+
+//
+// Annotates the ops the CPU backend runs in place and reports pool size and copy traffic
+// for an MLP and a CNN with and without the annotations.
+//
+TEST(benchmark, memory_layout_in_place)
+{
+    for (const string& model : vector<string>{"mxnet/mnist_mlp_forward.json", "conv_bias.json"})
+    {
+        size_t pool_size[2];
+        size_t copied_bytes[2];
+        for (bool in_place : {false, true})
+        {
+            const string path = file_util::path_join(SERIALIZED_ZOO, model);
+            shared_ptr<Function> f = deserialize(file_util::read_file_to_string(path));
+            pass::Manager fusion_manager;
+            fusion_manager.register_pass<pass::CoreFusion>();
+            if (in_place)
+            {
+                fusion_manager.register_pass<pass::ResultCopyElimination>();
+            }
+            fusion_manager.run_passes(f);
+
+            for (const shared_ptr<Node>& node : f->get_ordered_ops())
+            {
+                auto op_annotations = make_shared<op::util::OpAnnotations>();
+                if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+                {
+                    auto order = reshape->get_input_order();
+                    if (!is_sorted(order.begin(), order.end()))
+                    {
+                        continue;
+                    }
+                    op_annotations->add_in_place_oi_pair({0, 0, false});
+                }
+                else if (dynamic_pointer_cast<op::Relu>(node))
+                {
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                }
+                else if (dynamic_pointer_cast<op::Add>(node) ||
+                         dynamic_pointer_cast<op::Maximum>(node))
+                {
+                    op_annotations->add_in_place_oi_pair({0, 0, true});
+                    op_annotations->add_in_place_oi_pair({0, 1, true});
+                }
+                else
+                {
+                    continue;
+                }
+                if (in_place)
+                {
+                    static_pointer_cast<op::Op>(node)->set_op_annotations(op_annotations);
+                }
+            }
+
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.register_pass<pass::MemoryLayout>(64);
+            pass_manager.run_passes(f);
+            pool_size[in_place] = f->get_temporary_pool_size();
+
+            // Identity reshapes and results are plain copies unless they alias their argument
+            copied_bytes[in_place] = 0;
+            for (const shared_ptr<Node>& node : f->get_ordered_ops())
+            {
+                auto result = dynamic_pointer_cast<op::Result>(node);
+                auto reshape = dynamic_pointer_cast<op::Reshape>(node);
+                if (result && result->needs_copy())
+                {
+                    copied_bytes[in_place] += node->get_output_tensor().size();
+                }
+                else if (reshape && is_sorted(reshape->get_input_order().begin(),
+                                              reshape->get_input_order().end()))
+                {
+                    descriptor::Tensor& input = node->get_inputs().at(0).get_tensor();
+                    descriptor::Tensor& output = node->get_output_tensor();
+                    bool view = reshape->get_op_annotations() &&
+                                (node->liveness_new_list.count(&output) == 0 ||
+                                 (node->liveness_free_list.count(&input) != 0 &&
+                                  input.get_pool_offset() == output.get_pool_offset()));
+                    if (!view)
+                    {
+                        copied_bytes[in_place] += output.size();
+                    }
+                }
+            }
+        }
+        cout << model << ": pool " << pool_size[0] << " -> " << pool_size[1] << " bytes, copies "
+             << copied_bytes[0] << " -> " << copied_bytes[1] << " bytes" << endl;
+    }
+}
+
+//
+// Compares peak pool size and planning time of the online and offline memory layouts on the
+// test/models networks and on 100k synthetic lifetimes.
+//
+TEST(benchmark, memory_layout_planners)
+{
+    for (const string& model : get_serialized_models())
+    {
+        shared_ptr<Function> f = deserialize(file_util::read_file_to_string(model));
+        pass::Manager liveness_manager;
+        liveness_manager.register_pass<pass::Liveness>();
+        liveness_manager.run_passes(f);
+
+        size_t pool_size[2];
+        size_t planning_us[2];
+        for (auto scheme : {pass::MemoryLayout::planning_scheme::ONLINE,
+                            pass::MemoryLayout::planning_scheme::OFFLINE})
+        {
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::MemoryLayout>(64, false, scheme);
+            stopwatch timer;
+            timer.start();
+            pass_manager.run_passes(f);
+            timer.stop();
+            size_t index = scheme == pass::MemoryLayout::planning_scheme::OFFLINE;
+            pool_size[index] = f->get_temporary_pool_size();
+            planning_us[index] = timer.get_microseconds();
+        }
+        cout << file_util::get_file_name(model) << ": " << pool_size[0] << " -> "
+             << pool_size[1] << " bytes, " << planning_us[0] << " -> " << planning_us[1]
+             << " us" << endl;
+    }
+
+    vector<BufferLifetime> lifetimes = make_buffer_lifetimes(100000, 0);
+    stopwatch online_timer;
+    online_timer.start();
+    size_t online_size = plan_buffers_online(lifetimes, 64);
+    online_timer.stop();
+
+    stopwatch offline_timer;
+    offline_timer.start();
+    pass::MemoryPlanner planner(64);
+    for (const BufferLifetime& lifetime : lifetimes)
+    {
+        planner.add_buffer(lifetime.size, lifetime.begin, lifetime.end);
+    }
+    planner.plan();
+    offline_timer.stop();
+    cout << "100000 synthetic lifetimes: " << online_size << " -> " << planner.max_allocated()
+         << " bytes, " << online_timer.get_milliseconds() << " -> "
+         << offline_timer.get_milliseconds() << " ms" << endl;
+}
+
+//
+// Compiles the test/models networks on INTERPRETER, which does not run CSE itself, with and
+// without CommonSubexpressionElimination applied first, and reports the ops left, the time of
+// CSE plus compile, and the memory held by the compiled function.
+//
+TEST(benchmark, cse_compile)
+{
+    for (const string& model : get_serialized_models())
+    {
+        size_t op_count[2];
+        size_t compile_ms[2];
+        long rss_kb[2];
+        for (bool cse : {false, true})
+        {
+            // Hand memory freed by earlier compiles back so that it is not silently reused
+            malloc_trim(0);
+            long rss_before = get_rss_kb("VmRSS");
+            shared_ptr<Function> f = deserialize(file_util::read_file_to_string(model));
+            auto backend = runtime::Backend::create("INTERPRETER");
+            stopwatch timer;
+            timer.start();
+            if (cse)
+            {
+                pass::Manager pass_manager;
+                pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+                pass_manager.run_passes(f);
+            }
+            backend->compile(f);
+            timer.stop();
+            op_count[cse] = f->get_ops().size();
+            compile_ms[cse] = timer.get_milliseconds();
+            rss_kb[cse] = get_rss_kb("VmRSS") - rss_before;
+            backend->remove_compiled_function(f);
+        }
+        cout << file_util::get_file_name(model) << ": " << op_count[0] << " -> " << op_count[1]
+             << " ops, compile " << compile_ms[0] << " -> " << compile_ms[1] << "ms, RSS +"
+             << rss_kb[0] << " -> +" << rss_kb[1] << "KiB" << endl;
+    }
+}
+
+//
+// Removes chains of additions of zero, each chain in one recurrent match.
+//
+class AddZeroElimination : public pass::RecurrentGraphRewrite
+{
+public:
+    AddZeroElimination()
+    {
+        auto zero = op::Constant::create(element::i32, Shape{}, {0});
+        auto zero_label = make_shared<pattern::op::Label>(zero, nullptr, NodeVector{zero});
+        auto term = make_shared<pattern::op::Label>(element::i32, Shape{});
+        auto add = zero_label + term;
+
+        pattern::recurrent_graph_rewrite_callback callback = [zero_label,
+                                                              term](pattern::RecurrentMatcher& rm) {
+            auto zeros = rm.get_bound_nodes_for_pattern(zero_label);
+            auto is_zero = [](shared_ptr<Node> n) { return ngraph::is_zero(n); };
+            if (!all_of(zeros.begin(), zeros.end(), is_zero))
+            {
+                return false;
+            }
+            // Matches are in reverse order, so the last term is the start of the chain
+            auto terms = rm.get_bound_nodes_for_pattern(term);
+            ngraph::replace_node(rm.get_match_root(),
+                                 terms.at(rm.get_number_of_recurrent_matches() - 1));
+            return true;
+        };
+        add_matcher(make_shared<pattern::RecurrentMatcher>(
+            add, term, set<shared_ptr<pattern::op::Label>>{}, callback));
+    }
+};
+
+//
+// Times CoreFusion and a recurrent rewrite on graphs of tens of thousands of nodes.
+//
+TEST(benchmark, graph_rewrite_large_graph)
+{
+    // 1600 chains of 10 Relus written as Maximum(Broadcast(0), x * b), about 50000 nodes
+    Shape shape{4};
+    auto make_relu_chains = [&shape]() {
+        auto a = make_shared<op::Parameter>(element::i32, shape);
+        auto b = make_shared<op::Parameter>(element::i32, shape);
+        auto zero = op::Constant::create(element::i32, Shape{}, {0});
+        NodeVector results;
+        for (size_t i = 0; i < 1600; i++)
+        {
+            shared_ptr<Node> x = a;
+            for (size_t j = 0; j < 10; j++)
+            {
+                auto broadcast = make_shared<op::Broadcast>(zero, shape, AxisSet{0});
+                x = make_shared<op::Maximum>(broadcast, x * b);
+            }
+            results.push_back(x);
+        }
+        return make_shared<Function>(results, op::ParameterVector{a, b});
+    };
+
+    auto f = make_relu_chains();
+    size_t ops = f->get_ops().size();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    stopwatch timer;
+    timer.start();
+    pass_manager.run_passes(f);
+    timer.stop();
+    cout << "CoreFusion on " << ops << " ops: " << timer.get_milliseconds() << " ms, "
+         << count_ops_of_type<op::Relu>(f) << " Relus" << endl;
+
+    // 5000 chains of a + 0 + 0 + 0 for the recurrent rewrite to remove, about 30000 nodes
+    auto iconst0 = op::Constant::create(element::i32, Shape{}, {0});
+    op::ParameterVector params;
+    NodeVector results;
+    for (size_t i = 0; i < 5000; i++)
+    {
+        auto a = make_shared<op::Parameter>(element::i32, Shape{});
+        params.push_back(a);
+        results.push_back(make_shared<op::Abs>(a + iconst0 + iconst0 + iconst0));
+    }
+    auto g = make_shared<Function>(results, params);
+    ops = g->get_ops().size();
+    pass::Manager recurrent_pass_manager;
+    recurrent_pass_manager.register_pass<AddZeroElimination>();
+    timer.start();
+    recurrent_pass_manager.run_passes(g);
+    timer.stop();
+    cout << "RecurrentGraphRewrite on " << ops << " ops: " << timer.get_milliseconds() << " ms, "
+         << count_ops_of_type<op::Add>(g) << " Adds left" << endl;
+}
@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <future>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -210,6 +211,62 @@ NGRAPH_TEST(${BACKEND_NAME}, abc)
               (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector());
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    size_t default_in_flight = (backend->supports_concurrent_calls() ? 2 : 1);
+    EXPECT_EQ(default_in_flight, backend->get_max_in_flight_calls(f));
+    EXPECT_THROW(backend->set_max_in_flight_calls(f, 0), runtime_error);
+    if (backend->supports_concurrent_calls())
+    {
+        backend->set_max_in_flight_calls(f, 3);
+        EXPECT_EQ(3, backend->get_max_in_flight_calls(f));
+    }
+    else
+    {
+        EXPECT_THROW(backend->set_max_in_flight_calls(f, 3), runtime_error);
+    }
+
+    // Each call's inputs are staged while the earlier calls run
+    const size_t call_count = 16;
+    vector<vector<shared_ptr<runtime::TensorView>>> args;
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < call_count; i++)
+    {
+        float v = static_cast<float>(i);
+        args.push_back({backend->create_tensor(element::f32, shape),
+                        backend->create_tensor(element::f32, shape),
+                        backend->create_tensor(element::f32, shape)});
+        copy_data(args[i][0], vector<float>{v, 1, 2, 3});
+        copy_data(args[i][1], vector<float>{1, v, 3, 4});
+        copy_data(args[i][2], vector<float>{2, 2, v, 1});
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(backend->call_async(f, {results[i]}, args[i]));
+    }
+    for (size_t i = 0; i < call_count; i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        float v = static_cast<float>(i);
+        EXPECT_EQ((vector<float>{(v + 1) * 2, (1 + v) * 2, 5 * v, 7}),
+                  read_vector<float>(results[i]));
+    }
+
+    // Errors are thrown by the future
+    auto wrong_shape = backend->create_tensor(element::f32, Shape{4});
+    auto failed = backend->call_async(f, {results[0]}, {wrong_shape, args[0][1], args[0][2]});
+    EXPECT_THROW(failed.get(), runtime_error);
+
+    backend->remove_compiled_function(f);
+    EXPECT_EQ(default_in_flight, backend->get_max_in_flight_calls(f));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, abc_int64)
 {
     Shape shape{2, 2};
@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Rows of A times B plus C, with the batch on axis 0 of A and of the result
+static shared_ptr<Function> make_affine(size_t batch_size)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{batch_size, 2});
+    auto B = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{batch_size, 3});
+    return make_shared<Function>(make_shared<op::Dot>(A, B) + C, op::ParameterVector{A, C});
+}
+
+TEST(batching_executor, results)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(
+        backend, make_affine, {1, 2, 4}, chrono::microseconds(100000));
+    EXPECT_EQ(executor.get_max_batch_size(), 4);
+
+    const size_t request_count = 9;
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<void>> done;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{2});
+        copy_data(a, vector<float>{float(i), 1});
+        auto c = backend->create_tensor(element::f32, Shape{3});
+        copy_data(c, vector<float>{0, 0, float(i)});
+        auto result = backend->create_tensor(element::f32, Shape{3});
+        done.push_back(executor.submit({result}, {a, c}));
+        results.push_back(result);
+    }
+    for (size_t i = 0; i < request_count; i++)
+    {
+        done[i].get();
+        float x = float(i);
+        EXPECT_EQ((vector<float>{x + 4, 2 * x + 5, 4 * x + 6}), read_vector<float>(results[i]));
+    }
+    EXPECT_LT(executor.get_batch_count(), request_count);
+    EXPECT_GE(executor.get_batch_count(), 3);
+}
+
+TEST(batching_executor, partial_batch)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(backend, make_affine, {4}, chrono::microseconds(1000));
+
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<void>> done;
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto a = backend->create_tensor(element::f32, Shape{2});
+        copy_data(a, vector<float>{1, float(i)});
+        auto c = backend->create_tensor(element::f32, Shape{3});
+        copy_data(c, vector<float>{0, 0, 0});
+        auto result = backend->create_tensor(element::f32, Shape{3});
+        done.push_back(executor.submit({result}, {a, c}));
+        results.push_back(result);
+    }
+    for (size_t i = 0; i < 3; i++)
+    {
+        done[i].get();
+        float x = float(i);
+        EXPECT_EQ((vector<float>{1 + 4 * x, 2 + 5 * x, 3 + 6 * x}),
+                  read_vector<float>(results[i]));
+    }
+}
+
+TEST(batching_executor, invalid_request)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(backend, make_affine, {1, 2}, chrono::microseconds(0));
+
+    auto a = backend->create_tensor(element::f32, Shape{2});
+    auto c = backend->create_tensor(element::f32, Shape{3});
+    auto result = backend->create_tensor(element::f32, Shape{3});
+    auto batched = backend->create_tensor(element::f32, Shape{1, 3});
+    auto wrong_type = backend->create_tensor(element::i32, Shape{2});
+    EXPECT_THROW(executor.submit({result}, {a}), runtime_error);
+    EXPECT_THROW(executor.submit({batched}, {a, c}), runtime_error);
+    EXPECT_THROW(executor.submit({result}, {wrong_type, c}), runtime_error);
+    EXPECT_NO_THROW(executor.submit({result}, {a, c}).get());
+}
+
+TEST(batching_executor, invalid_function)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto unbatched = [](size_t) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{3});
+        return make_shared<Function>(-A, op::ParameterVector{A});
+    };
+    EXPECT_THROW(runtime::BatchingExecutor(backend, unbatched, {2}, chrono::microseconds(0)),
+                 runtime_error);
+    EXPECT_THROW(runtime::BatchingExecutor(backend, make_affine, {}, chrono::microseconds(0)),
+                 runtime_error);
+    EXPECT_THROW(runtime::BatchingExecutor(backend, make_affine, {0}, chrono::microseconds(0)),
+                 runtime_error);
+}
+
+namespace
+{
+    // Records the functions the executor removes from the backend
+    class RecordingBackend : public runtime::interpreter::INTBackend
+    {
+    public:
+        void remove_compiled_function(shared_ptr<Function> func) override
+        {
+            m_removed.insert(func);
+            INTBackend::remove_compiled_function(func);
+        }
+
+        set<shared_ptr<Function>> m_removed;
+    };
+}
+
+TEST(batching_executor, invalid_function_cleanup)
+{
+    auto backend = make_shared<RecordingBackend>();
+    vector<shared_ptr<Function>> made;
+    auto make_function = [&made](size_t batch_size) {
+        // The function for batch size 4 has no batch axis
+        auto A = make_shared<op::Parameter>(element::f32,
+                                            batch_size == 4 ? Shape{2} : Shape{batch_size, 2});
+        auto f = make_shared<Function>(-A, op::ParameterVector{A});
+        made.push_back(f);
+        return f;
+    };
+    EXPECT_THROW(
+        runtime::BatchingExecutor(backend, make_function, {1, 2, 4}, chrono::microseconds(0)),
+        runtime_error);
+    ASSERT_EQ(made.size(), 3);
+    EXPECT_EQ(backend->m_removed, (set<shared_ptr<Function>>{made[0], made[1]}));
+}
@@ -22,6 +22,7 @@
 #include "util/test_tools.hpp"
 
 #include <memory>
+#include <thread>
 using namespace std;
 using namespace ngraph;
 
@@ -132,3 +133,45 @@ TEST(build_graph, function_undeclared_parameters)
         FAIL() << "Function construction failed for unexpected reason";
     }
 }
+
+TEST(build_graph, ordered_ops_cache)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto sum = make_shared<op::Add>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Negative>(sum), op::ParameterVector{A, B});
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(5, ordered.size());
+
+    // Concurrent callers share the cache
+    vector<thread> threads;
+    vector<char> passed(4, true);
+    for (size_t t = 0; t < passed.size(); t++)
+    {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < 1000; i++)
+            {
+                if (f->get_ordered_ops() != ordered)
+                {
+                    passed[t] = false;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < passed.size(); t++)
+    {
+        EXPECT_TRUE(passed[t]) << "thread " << t;
+    }
+
+    // A replaced op is not kept alive by the cache
+    weak_ptr<Node> weak_sum = sum;
+    replace_node(sum, make_shared<op::Subtract>(A, B));
+    sum.reset();
+    ordered.clear();
+    EXPECT_TRUE(weak_sum.expired());
+    EXPECT_EQ(5, f->get_ordered_ops().size());
+}
@@ -22,6 +22,8 @@
 
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -111,3 +113,101 @@ TEST(DISABLED_codegen, include)
     int result = func(20, 2);
     EXPECT_EQ(400, result);
 }
+
+TEST(codegen, module_cache)
+{
+    // Pulling in Eigen makes the cold compile expensive enough to dwarf loading the bitcode
+    constexpr auto source =
+        R"(
+        #include <Eigen/Dense>
+        extern "C" int test(int a, int b)
+        {
+            Eigen::Matrix2i m;
+            m << a, b, b, a;
+            return (m * m).sum();
+        }
+    )";
+
+    string cache_dir = file_util::make_temp_directory();
+
+    stopwatch cold_timer;
+    codegen::Compiler cold_compiler;
+    cold_compiler.set_cache_directory(cache_dir);
+    cold_timer.start();
+    auto cold_module = cold_compiler.compile(source);
+    cold_timer.stop();
+    ASSERT_NE(nullptr, cold_module);
+    EXPECT_EQ(0, cold_compiler.get_cache_hits());
+
+    size_t cache_files = 0;
+    file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) { cache_files++; });
+    EXPECT_EQ(1, cache_files);
+
+    stopwatch warm_timer;
+    codegen::Compiler warm_compiler;
+    warm_compiler.set_cache_directory(cache_dir);
+    warm_timer.start();
+    auto warm_module = warm_compiler.compile(source);
+    warm_timer.stop();
+    ASSERT_NE(nullptr, warm_module);
+    EXPECT_EQ(1, warm_compiler.get_cache_hits());
+
+    cout << "cold compile " << cold_timer.get_milliseconds() << "ms, warm compile "
+         << warm_timer.get_milliseconds() << "ms" << endl;
+    EXPECT_LT(warm_timer.get_microseconds(), cold_timer.get_microseconds());
+
+    codegen::ExecutionEngine execution_engine;
+    execution_engine.add_module(warm_module);
+    execution_engine.finalize();
+    auto func = execution_engine.find_function<int(int, int)>("test");
+    ASSERT_NE(nullptr, func);
+    EXPECT_EQ(18, func(1, 2));
+
+    // A size limit of zero keeps only the most recently stored module
+    codegen::Compiler other_compiler;
+    other_compiler.set_cache_directory(cache_dir);
+    other_compiler.set_cache_size_limit(0);
+    ASSERT_NE(nullptr, other_compiler.compile(R"(extern "C" int test() { return 7; })"));
+    cache_files = 0;
+    file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) { cache_files++; });
+    EXPECT_EQ(1, cache_files);
+
+    file_util::remove_directory(cache_dir);
+}
+
+TEST(codegen, compile_modules)
+{
+    vector<string> sources{
+        R"(extern "C" int square(int a) { return a * a; })",
+        R"(
+        extern "C" int square(int a);
+        extern "C" int sum_of_squares(int a, int b) { return square(a) + square(b); }
+        )",
+        R"(
+        #include <Eigen/Dense>
+        extern "C" int sum_of_squares(int a, int b);
+        extern "C" int test(int a, int b)
+        {
+            Eigen::Matrix2i m;
+            m << a, b, b, a;
+            return (m * m).sum() + sum_of_squares(a, b);
+        }
+        )"};
+
+    codegen::Compiler compiler;
+    compiler.set_thread_count(2);
+    auto modules = compiler.compile_modules(sources);
+    ASSERT_EQ(sources.size(), modules.size());
+
+    // Symbols are resolved across all modules added to the engine
+    codegen::ExecutionEngine execution_engine;
+    for (auto& module : modules)
+    {
+        ASSERT_NE(nullptr, module);
+        execution_engine.add_module(module);
+    }
+    execution_engine.finalize();
+    auto func = execution_engine.find_function<int(int, int)>("test");
+    ASSERT_NE(nullptr, func);
+    EXPECT_EQ(23, func(1, 2));
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+template <typename T>
+static vector<T> folded_value(const shared_ptr<Function>& f)
+{
+    auto constant = dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    EXPECT_TRUE(constant);
+    return constant ? constant->get_vector<T>() : vector<T>{};
+}
+
+TEST(constant_folding, reshape)
+{
+    auto A = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto f = make_shared<Function>(make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{3, 2}),
+                                   op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+    EXPECT_EQ((vector<float>{1, 4, 2, 5, 3, 6}), folded_value<float>(f));
+}
+
+TEST(constant_folding, chain)
+{
+    Shape shape{4};
+    auto A = op::Constant::create(element::i32, shape, {1, 2, 3, 4});
+    auto B = op::Constant::create(element::i32, shape, {10, 20, 30, 40});
+    auto sliced = make_shared<op::Slice>(make_shared<op::Add>(A, -B), Coordinate{1}, Coordinate{3});
+    auto converted = make_shared<op::Convert>(sliced, element::f32);
+    auto f = make_shared<Function>(converted, op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Slice>(f), 0);
+    EXPECT_EQ((vector<float>{-18, -27}), folded_value<float>(f));
+}
+
+TEST(constant_folding, non_constant_argument)
+{
+    Shape shape{2};
+    auto A = op::Constant::create(element::f32, shape, {1, 2});
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(-A, B), op::ParameterVector{B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 1);
+}
+
+TEST(constant_folding, expansion_threshold)
+{
+    auto make_function = [] {
+        auto A = op::Constant::create(element::f32, Shape{}, {3});
+        auto padding = op::Constant::create(element::f32, Shape{}, {0});
+        auto broadcast = make_shared<op::Broadcast>(A, Shape{4}, AxisSet{0});
+        auto pad = make_shared<op::Pad>(broadcast, padding, Shape{1}, Shape{1}, Shape{0});
+        return make_shared<Function>(pad, op::ParameterVector{});
+    };
+
+    auto f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Pad>(f), 1);
+
+    auto g = make_function();
+    pass::Manager expanding_pass_manager;
+    expanding_pass_manager.register_pass<pass::ConstantFolding>(64);
+    expanding_pass_manager.run_passes(g);
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(g), 0);
+    EXPECT_EQ(count_ops_of_type<op::Pad>(g), 0);
+    EXPECT_EQ((vector<float>{0, 3, 3, 3, 3, 0}), folded_value<float>(g));
+}
+
+TEST(constant_folding, integer_division_by_zero)
+{
+    Shape shape{2};
+    auto A = op::Constant::create(element::i32, shape, {4, 6});
+    auto B = op::Constant::create(element::i32, shape, {2, 0});
+    auto f = make_shared<Function>(make_shared<op::Divide>(A, B), op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 1);
+}
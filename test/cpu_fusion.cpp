@@ -49,6 +49,7 @@
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
@@ -56,6 +57,7 @@
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -2197,3 +2199,63 @@ TEST(cpu_fusion, fuse_batch_dot_forward)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
     }
 }
+
+TEST(cpu_fusion, loop_kernel_fusion)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    // A * B is used twice, so it stays a separate op rather than being computed in both kernels
+    auto mul = A * B;
+    auto exp_node = make_shared<op::Exp>(mul + C);
+    auto tanh_node = make_shared<op::Tanh>(mul - C);
+    auto func =
+        make_shared<Function>(NodeVector{exp_node, tanh_node}, op::ParameterVector{A, B, C});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::LoopKernel>(func), 2);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::Add>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::Subtract>(func), 0);
+
+    // The kernel neither writes nor reads back the two intermediates
+    runtime::cpu::pass::CPULoopKernelFusion fusion;
+    fusion.run_on_function(make_shared<Function>(
+        make_shared<op::Exp>(make_shared<op::Relu>(A + B)), op::ParameterVector{A, B}));
+    EXPECT_EQ(4 * shape_size(shape) * sizeof(float), fusion.get_bytes_saved());
+}
+
+TEST(cpu_fusion, loop_kernel_n2c3)
+{
+    auto make_function = []() {
+        Shape shape{2, 3};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto mul = A * B;
+        auto sigmoid = make_shared<op::Sigmoid>(make_shared<op::Maximum>(mul, C));
+        auto exp_node = make_shared<op::Exp>(mul + C);
+        return make_shared<Function>(NodeVector{exp_node / (sigmoid + A), mul},
+                                     op::ParameterVector{A, B, C});
+    };
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < int_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
@@ -15,10 +15,19 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -31,6 +40,13 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_task_graph.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -61,3 +77,668 @@ TEST(cpu_test, unhandled_op)
     auto backend = runtime::Backend::create("CPU");
     ASSERT_THROW(backend->compile(f), ngraph_error);
 }
+
+TEST(cpu_test, concurrent_calls)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    cpu_backend->set_max_concurrent_calls(f, 4);
+    backend->compile(f);
+    EXPECT_THROW(cpu_backend->set_max_concurrent_calls(f, 2), runtime_error);
+
+    const size_t num_threads = 8;
+    const size_t num_iterations = 50;
+    vector<thread> threads;
+    vector<char> passed(num_threads, true);
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto c = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                float v = static_cast<float>(t * num_iterations + i);
+                copy_data(a, vector<float>{v, 1, 2, 3});
+                copy_data(b, vector<float>{1, v, 3, 4});
+                copy_data(c, vector<float>{2, 2, v, 1});
+                backend->call(f, {result}, {a, b, c});
+                vector<float> expected{(v + 1) * 2, (1 + v) * 2, 5 * v, 7};
+                if (read_vector<float>(result) != expected)
+                {
+                    passed[t] = false;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_TRUE(passed[t]) << "thread " << t;
+    }
+}
+
+TEST(cpu_test, concurrent_mkldnn_calls)
+{
+    Shape shape_a{1, 2, 8, 8};
+    Shape shape_b{4, 2, 3, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto conv = make_shared<op::Convolution>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Relu>(conv), op::ParameterVector{A, B});
+    Shape shape_r = conv->get_shape();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> inputs;
+    vector<vector<float>> expected;
+    auto ref_backend = runtime::Backend::create("INTERPRETER");
+    for (size_t t = 0; t < 4; t++)
+    {
+        auto a = ref_backend->create_tensor(element::f32, shape_a);
+        auto b = ref_backend->create_tensor(element::f32, shape_b);
+        auto result = ref_backend->create_tensor(element::f32, shape_r);
+        rng.initialize(a);
+        rng.initialize(b);
+        ref_backend->call(f, {result}, {a, b});
+        inputs.push_back(read_vector<float>(a));
+        inputs.push_back(read_vector<float>(b));
+        expected.push_back(read_vector<float>(result));
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    static_pointer_cast<runtime::cpu::CPU_Backend>(backend)->set_max_concurrent_calls(f, 4);
+    backend->compile(f);
+
+    vector<thread> threads;
+    vector<char> passed(expected.size(), true);
+    for (size_t t = 0; t < expected.size(); t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape_a);
+            auto b = backend->create_tensor(element::f32, shape_b);
+            auto result = backend->create_tensor(element::f32, shape_r);
+            copy_data(a, inputs[2 * t]);
+            copy_data(b, inputs[2 * t + 1]);
+            for (size_t i = 0; i < 20; i++)
+            {
+                backend->call(f, {result}, {a, b});
+                if (!test::all_close(expected[t], read_vector<float>(result)))
+                {
+                    passed[t] = false;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < expected.size(); t++)
+    {
+        EXPECT_TRUE(passed[t]) << "thread " << t;
+    }
+}
+
+TEST(cpu_test, executors)
+{
+    Shape shape{64, 64};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Dot>(A, B) + A, op::ParameterVector{A, B});
+    };
+    auto f = make_function();
+    auto g = make_function();
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto executor = make_shared<runtime::cpu::CPUExecutor>(2);
+    cpu_backend->set_executor(f, make_shared<runtime::cpu::CPUExecutor>(1));
+    cpu_backend->set_executor(executor);
+    backend->compile(f);
+    EXPECT_THROW(cpu_backend->set_executor(f, executor), runtime_error);
+
+    // Each function runs on its own executor while the other one is called concurrently
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto a = rng.initialize(backend->create_tensor(element::f32, shape));
+    auto b = rng.initialize(backend->create_tensor(element::f32, shape));
+    auto expected = backend->create_tensor(element::f32, shape);
+    backend->call(make_function(), {expected}, {a, b});
+
+    vector<char> passed(4, true);
+    vector<thread> threads;
+    for (size_t t = 0; t < passed.size(); t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto result = backend->create_tensor(element::f32, shape);
+            for (size_t i = 0; i < 20; i++)
+            {
+                backend->call(t % 2 == 0 ? f : g, {result}, {a, b});
+                if (!test::all_close(read_vector<float>(expected), read_vector<float>(result)))
+                {
+                    passed[t] = false;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+    for (size_t t = 0; t < passed.size(); t++)
+    {
+        EXPECT_TRUE(passed[t]) << "thread " << t;
+    }
+}
+
+TEST(cpu_test, executor_scope)
+{
+    runtime::cpu::CPUExecutor executor(3);
+    EXPECT_EQ(&runtime::cpu::CPUExecutor::get_default(),
+              &runtime::cpu::CPUExecutor::get_current());
+    executor.execute([&]() {
+        EXPECT_EQ(&executor, &runtime::cpu::CPUExecutor::get_current());
+        EXPECT_EQ(3, runtime::cpu::eigen::get_thread_pool_device().numThreads());
+    });
+    EXPECT_EQ(&runtime::cpu::CPUExecutor::get_default(),
+              &runtime::cpu::CPUExecutor::get_current());
+    EXPECT_THROW(runtime::cpu::CPUExecutor(0), ngraph_error);
+}
+
+#ifdef __linux__
+TEST(cpu_test, executor_affinity)
+{
+    runtime::cpu::CPUExecutor executor(2, {0});
+    thread::id caller = this_thread::get_id();
+    atomic<size_t> pool_tasks(0);
+    atomic<size_t> unpinned_tasks(0);
+    executor.execute([&]() {
+        runtime::cpu::eigen::parallel_for(1 << 16, 4096, 4096, [&](size_t first, size_t last) {
+            // Eigen runs part of the range on the calling thread, which isn't pinned
+            if (this_thread::get_id() == caller)
+            {
+                return;
+            }
+            cpu_set_t set;
+            pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+            pool_tasks++;
+            if (CPU_COUNT(&set) != 1 || !CPU_ISSET(0, &set))
+            {
+                unpinned_tasks++;
+            }
+        });
+    });
+    EXPECT_GT(pool_tasks, 0);
+    EXPECT_EQ(0, unpinned_tasks);
+}
+#endif
+
+TEST(cpu_test, numa_topology)
+{
+    const auto& nodes = runtime::cpu::numa::get_nodes();
+    ASSERT_FALSE(nodes.empty());
+    for (const auto& node : nodes)
+    {
+        EXPECT_FALSE(node.m_cpus.empty());
+        EXPECT_EQ(&node, &runtime::cpu::numa::get_node(node.m_id));
+    }
+    EXPECT_THROW(runtime::cpu::numa::get_node(nodes.back().m_id + 1), ngraph_error);
+}
+
+TEST(cpu_test, numa_placement)
+{
+    Shape shape{1 << 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 2));
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    size_t node_id = runtime::cpu::numa::get_nodes().back().m_id;
+    auto executor = runtime::cpu::CPUExecutor::create_for_numa_node(node_id);
+    EXPECT_EQ(static_cast<int>(node_id), executor->get_numa_node());
+    EXPECT_EQ(runtime::cpu::numa::get_node(node_id).m_cpus, executor->get_affinity());
+    cpu_backend->set_executor(f, executor);
+
+    auto a = cpu_backend->create_tensor_on_node(element::f32, shape, node_id);
+    auto b = cpu_backend->create_tensor_on_node(element::f32, shape, node_id);
+    auto result = cpu_backend->create_tensor_on_node(element::f32, shape, node_id);
+    copy_data(a, vector<float>(shape_size(shape), 1));
+    copy_data(b, vector<float>(shape_size(shape), 3));
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(vector<float>(shape_size(shape), 8), read_vector<float>(result));
+    EXPECT_THROW(cpu_backend->create_tensor_on_node(element::f32, shape, node_id + 1),
+                 ngraph_error);
+}
+
+TEST(cpu_test, task_graph)
+{
+    // Random edges between tasks added in order, each task checking its predecessors ran
+    runtime::cpu::TaskGraph graph;
+    const size_t task_count = 200;
+    vector<vector<size_t>> predecessors(task_count);
+    for (size_t task = 0; task < task_count; task++)
+    {
+        graph.add_task(task % 7 == 0 ? runtime::cpu::TaskGraph::s_serial_cost : task);
+        for (size_t from = (task > 8 ? task - 8 : 0); from < task; from++)
+        {
+            if ((from * 31 + task * 17) % 5 == 0)
+            {
+                graph.add_edge(from, task);
+                predecessors[task].push_back(from);
+            }
+        }
+    }
+    EXPECT_THROW(graph.add_edge(3, 3), ngraph_error);
+    EXPECT_THROW(graph.add_edge(0, task_count), ngraph_error);
+
+    for (size_t thread_count : {1, 4})
+    {
+        runtime::cpu::CPUExecutor executor(thread_count);
+        for (size_t i = 0; i < 10; i++)
+        {
+            unique_ptr<atomic<bool>[]> done(new atomic<bool>[task_count]);
+            for (size_t task = 0; task < task_count; task++)
+            {
+                done[task] = false;
+            }
+            atomic<bool> ordered(true);
+            graph.run(executor, [&](size_t task) {
+                for (size_t predecessor : predecessors[task])
+                {
+                    if (!done[predecessor])
+                    {
+                        ordered = false;
+                    }
+                }
+                done[task] = true;
+            });
+            EXPECT_TRUE(ordered);
+            for (size_t task = 0; task < task_count; task++)
+            {
+                EXPECT_TRUE(done[task]) << "task " << task;
+            }
+        }
+
+        // The tasks that haven't started when one throws are skipped
+        atomic<size_t> run_count(0);
+        EXPECT_THROW(graph.run(executor,
+                               [&](size_t task) {
+                                   run_count++;
+                                   if (task == 100)
+                                   {
+                                       throw ngraph_error("task failed");
+                                   }
+                               }),
+                     ngraph_error);
+        EXPECT_LT(run_count, task_count);
+    }
+}
+
+TEST(cpu_test, task_graph_thread_budget)
+{
+    const size_t thread_count = 4;
+    runtime::cpu::CPUExecutor executor(thread_count);
+    auto get_thread_count = []() {
+        return static_cast<size_t>(runtime::cpu::eigen::get_thread_pool_device().numThreads());
+    };
+
+    // A lone expensive task gets every thread and a cheap one runs serially
+    runtime::cpu::TaskGraph chain;
+    chain.add_task(runtime::cpu::TaskGraph::s_serial_cost * 100);
+    chain.add_task(1);
+    chain.add_edge(0, 1);
+    vector<size_t> chain_thread_counts(2);
+    chain.run(executor, [&](size_t task) { chain_thread_counts[task] = get_thread_count(); });
+    EXPECT_EQ((vector<size_t>{thread_count, 1}), chain_thread_counts);
+
+    // Equally expensive independent tasks run at once with a thread each
+    runtime::cpu::TaskGraph wide;
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        wide.add_task(runtime::cpu::TaskGraph::s_serial_cost * 100);
+    }
+    atomic<size_t> started(0);
+    vector<size_t> wide_thread_counts(thread_count);
+    wide.run(executor, [&](size_t task) {
+        wide_thread_counts[task] = get_thread_count();
+        started++;
+        auto deadline = chrono::steady_clock::now() + chrono::seconds(10);
+        while (started < thread_count && chrono::steady_clock::now() < deadline)
+        {
+            this_thread::yield();
+        }
+    });
+    EXPECT_EQ(thread_count, started);
+    EXPECT_EQ(vector<size_t>(thread_count, 1), wide_thread_counts);
+}
+
+TEST(cpu_test, task_graph_cost)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{16, 4});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto add = make_shared<op::Add>(A, A);
+    // 2 * 8 * 4 * 16 operations, and reading 8 * 16 + 16 * 4 and writing 8 * 4 floats
+    EXPECT_EQ(1024 + 4 * 224, runtime::cpu::TaskGraph::estimate_cost(*dot));
+    EXPECT_EQ(128 + 4 * 384, runtime::cpu::TaskGraph::estimate_cost(*add));
+}
+
+// Independent branches joined at the end, run as a task graph in both execution modes
+TEST(cpu_test, task_graph_function)
+{
+    Shape shape{32, 32};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        NodeVector branches;
+        for (size_t i = 0; i < 4; i++)
+        {
+            shared_ptr<Node> branch = make_shared<op::Dot>(i % 2 == 0 ? A : B, A);
+            for (size_t j = 0; j < i; j++)
+            {
+                branch = make_shared<op::Tanh>(branch) + B;
+            }
+            branches.push_back(branch);
+        }
+        return make_shared<Function>((branches[0] + branches[1]) * (branches[2] - branches[3]),
+                                     op::ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto a = rng.initialize(backend->create_tensor(element::f32, shape));
+    auto b = rng.initialize(backend->create_tensor(element::f32, shape));
+    auto expected = backend->create_tensor(element::f32, shape);
+    backend->call(make_function(), {expected}, {a, b});
+
+    ScopedEnvironmentVariable task_graph("NGRAPH_CPU_USE_TASK_GRAPH", "1");
+    for (bool dex : {false, true})
+    {
+        ScopedEnvironmentVariable execution_mode("NGRAPH_DEX", dex ? "1" : nullptr);
+        auto f = make_function();
+        cpu_backend->set_executor(f, make_shared<runtime::cpu::CPUExecutor>(4));
+        backend->compile(f);
+
+        auto result = backend->create_tensor(element::f32, shape);
+        for (size_t i = 0; i < 3; i++)
+        {
+            backend->call(f, {result}, {a, b});
+            EXPECT_TRUE(test::all_close(read_vector<float>(expected), read_vector<float>(result)))
+                << (dex ? "direct execution" : "codegen");
+        }
+    }
+}
+
+// Temporaries share pool buffers, so work skipped because an input is unchanged must not
+// rely on a buffer that has since been reused.
+TEST(cpu_test, memory_sharing_unchanged_inputs)
+{
+    Shape shape{4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+
+    // Chains of dots only depending on B, then on A, with plenty of dead temporaries
+    shared_ptr<Node> w = B;
+    for (size_t i = 0; i < 4; i++)
+    {
+        w = make_shared<op::Dot>(w, B);
+    }
+    shared_ptr<Node> x = A;
+    for (size_t i = 0; i < 4; i++)
+    {
+        x = make_shared<op::Dot>(x, w);
+    }
+    auto f = make_shared<Function>(x, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    vector<float> identity{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    vector<float> values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    copy_data(a, values);
+    copy_data(b, identity);
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(values, read_vector<float>(result));
+
+    // Only A changes, B is reported unchanged
+    vector<float> doubled;
+    for (float v : values)
+    {
+        doubled.push_back(2 * v);
+    }
+    copy_data(a, doubled);
+    b->set_stale(false);
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(doubled, read_vector<float>(result));
+}
+
+TEST(cpu_test, codegen_cache)
+{
+    string cache_dir = file_util::make_temp_directory();
+    ScopedEnvironmentVariable cache_dir_variable("NGRAPH_CODEGEN_CACHE_DIR", cache_dir.c_str());
+
+    // Constant addresses are bound at load time, so a cached module must still see the data
+    Shape shape{2, 2};
+    auto make_function = [&shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+        return make_shared<Function>(A * B, op::ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{2, 2, 2, 2});
+
+    // The same graph built again generates the same source, even with other graphs built in
+    // between, so the second compile is served from the module the first one stored
+    for (size_t expected_hits : {0, 1})
+    {
+        if (expected_hits > 0)
+        {
+            auto C = make_shared<op::Parameter>(element::f32, shape);
+            make_shared<Function>(make_shared<op::Negative>(C), op::ParameterVector{C});
+        }
+        auto f = make_function();
+        auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f, false);
+        auto result = backend->create_tensor(element::f32, shape);
+        external_function->make_call_frame()->call({result}, {a});
+        EXPECT_EQ((vector<float>{2, 4, 6, 8}), read_vector<float>(result));
+
+        // Direct execution does not go through codegen
+        if (!external_function->is_direct_execution())
+        {
+            EXPECT_EQ(expected_hits, external_function->get_codegen_cache_hits());
+            size_t cache_files = 0;
+            file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) {
+                if (file_util::get_file_ext(file) == ".bc")
+                {
+                    cache_files++;
+                }
+            });
+            EXPECT_EQ(1, cache_files);
+        }
+    }
+
+    file_util::remove_directory(cache_dir);
+}
+
+TEST(cpu_test, codegen_split_modules)
+{
+    ScopedEnvironmentVariable threads("NGRAPH_CODEGEN_THREADS", "4");
+
+    // Enough ops for the function to be compiled as a main module plus four op modules
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> sum = A;
+    for (size_t i = 0; i < 64; i++)
+    {
+        sum = sum + A;
+    }
+    auto f = make_shared<Function>(sum, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{65, 130, 195, 260}), read_vector<float>(result));
+
+    // Direct execution does not go through codegen
+    if (getenv("NGRAPH_DEX") == nullptr)
+    {
+        EXPECT_TRUE(file_util::exists(
+            file_util::path_join("cpu_codegen", f->get_name() + "_codegen_3.cpp")));
+    }
+}
+
+// Runs a function for each family of direct execution builders both ways and checks that
+// they agree. unit-test-check-dex also runs the backend tests with direct execution.
+TEST(cpu_test, dex_matches_codegen)
+{
+    using FunctionMaker = std::function<shared_ptr<Function>()>;
+    vector<pair<string, FunctionMaker>> families;
+
+    families.emplace_back("elementwise", []() {
+        Shape shape{4, 5};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto x = make_shared<op::Tanh>(A * B - C) / (make_shared<op::Exp>(B) + A * A + C * C);
+        auto y = make_shared<op::Select>(make_shared<op::Greater>(A, B),
+                                         make_shared<op::Maximum>(x, -C),
+                                         make_shared<op::Sqrt>(make_shared<op::Abs>(B)));
+        return make_shared<Function>(NodeVector{x, y}, op::ParameterVector{A, B, C});
+    });
+    families.emplace_back("reductions", []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{3, 4, 5});
+        return make_shared<Function>(NodeVector{make_shared<op::Sum>(A, AxisSet{0, 2}),
+                                                make_shared<op::Max>(A, AxisSet{1}),
+                                                make_shared<op::Min>(A, AxisSet{2}),
+                                                make_shared<op::Product>(A, AxisSet{0})},
+                                     op::ParameterVector{A});
+    });
+    families.emplace_back("data movement", []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+        auto reshaped = make_shared<op::Reshape>(A, AxisVector{2, 0, 1}, Shape{4, 2, 3});
+        auto sliced = make_shared<op::Slice>(A, Coordinate{0, 1, 1}, Coordinate{2, 3, 4});
+        auto broadcast = make_shared<op::Broadcast>(B, Shape{2, 3, 4}, AxisSet{1});
+        auto concat = make_shared<op::Concat>(NodeVector{A, broadcast}, 1);
+        auto replaced = make_shared<op::ReplaceSlice>(A,
+                                                      make_shared<op::Reverse>(sliced, AxisSet{2}),
+                                                      Coordinate{0, 0, 0},
+                                                      Coordinate{2, 2, 3});
+        auto padded = make_shared<op::Pad>(B,
+                                           op::Constant::create(element::f32, Shape{}, {0.5}),
+                                           Shape{1, 0},
+                                           Shape{0, 2},
+                                           Shape{0, 1});
+        auto converted = make_shared<op::Convert>(make_shared<op::Convert>(A, element::f64),
+                                                  element::f32);
+        return make_shared<Function>(NodeVector{reshaped, concat, replaced, padded, converted},
+                                     op::ParameterVector{A, B});
+    });
+    families.emplace_back("dot", []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{6, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{8, 5});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{6, 5});
+        auto v = make_shared<op::Parameter>(element::f32, Shape{8});
+        return make_shared<Function>(NodeVector{make_shared<op::Dot>(A, B) + C,
+                                                make_shared<op::Dot>(A, v)},
+                                     op::ParameterVector{A, B, C, v});
+    });
+    // Convolutions and pools, which CPU fusion combines with their bias and relu, and whose
+    // backprop ops come from differentiating the function
+    auto make_convolution = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto convolution = make_shared<op::Convolution>(data, filters);
+        auto biased =
+            convolution + make_shared<op::Broadcast>(bias, Shape{2, 4, 6, 6}, AxisSet{0, 2, 3});
+        auto relu = make_shared<op::Relu>(biased);
+        auto max_pool = make_shared<op::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+        auto avg_pool = make_shared<op::AvgPool>(relu, Shape{3, 3}, Strides{1, 1});
+        auto sigmoid = make_shared<op::Sigmoid>(make_shared<op::Sum>(avg_pool, AxisSet{2, 3}));
+        auto softmax = make_shared<op::Softmax>(
+            make_shared<op::Reshape>(max_pool, AxisVector{0, 1, 2, 3}, Shape{2, 36}), AxisSet{1});
+        return make_shared<Function>(NodeVector{sigmoid, softmax},
+                                     op::ParameterVector{data, filters, bias});
+    };
+    families.emplace_back("convolution", make_convolution);
+    families.emplace_back("convolution backprop", [&make_convolution]() {
+        auto f = make_convolution();
+        auto g = make_shared<Function>(f->get_output_op(1)->get_argument(0),
+                                       f->get_parameters());
+        return autodiff::backprop_function(g);
+    });
+    families.emplace_back("batch norm", []() {
+        Shape shape{2, 3, 4, 4};
+        auto input = make_shared<op::Parameter>(element::f32, shape);
+        auto gamma = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto beta = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto mean = make_shared<op::Parameter>(element::f32, Shape{3});
+        auto variance = make_shared<op::Parameter>(element::f32, Shape{3});
+        double eps = 0.001;
+        auto training = make_shared<op::BatchNorm>(eps, gamma, beta, input);
+        auto inference = make_shared<op::BatchNorm>(
+            eps, gamma, beta, input, mean, make_shared<op::Exp>(variance));
+        return make_shared<Function>(
+            NodeVector{make_shared<op::GetOutputElement>(training, 0),
+                       make_shared<op::GetOutputElement>(training, 1),
+                       make_shared<op::GetOutputElement>(training, 2),
+                       make_shared<op::Relu>(inference)},
+            op::ParameterVector{input, gamma, beta, mean, variance});
+    });
+
+    auto backend = runtime::Backend::create("CPU");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (auto& family : families)
+    {
+        vector<shared_ptr<runtime::TensorView>> args;
+        auto parameters = family.second()->get_parameters();
+        for (shared_ptr<op::Parameter> param : parameters)
+        {
+            args.push_back(
+                rng.initialize(backend->create_tensor(element::f32, param->get_shape())));
+        }
+
+        vector<vector<vector<float>>> results;
+        for (bool dex : {false, true})
+        {
+            ScopedEnvironmentVariable execution_mode("NGRAPH_DEX", dex ? "1" : nullptr);
+            auto f = family.second();
+            vector<shared_ptr<runtime::TensorView>> outputs;
+            for (shared_ptr<Node> out : f->get_results())
+            {
+                outputs.push_back(backend->create_tensor(element::f32, out->get_shape()));
+            }
+            backend->call(f, outputs, args);
+            results.emplace_back();
+            for (auto& output : outputs)
+            {
+                results.back().push_back(read_vector<float>(output));
+            }
+        }
+        for (size_t i = 0; i < results[0].size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(results[0][i], results[1][i]))
+                << family.first << " output " << i;
+        }
+    }
+}
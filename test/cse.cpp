@@ -32,6 +32,7 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/serializer.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -188,3 +189,81 @@ TEST(CSE, abs_add_abs_add_negative)
     ASSERT_EQ(oadd4->get_argument(1), D);
     ASSERT_EQ(oadd3->get_argument(0), oadd4->get_argument(0));
 }
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape zero_shape{0};
+    auto A = std::make_shared<op::Parameter>(element::i32, zero_shape);
+    auto B = std::make_shared<op::Parameter>(element::i32, zero_shape);
+    auto sub1 = std::make_shared<op::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::Subtract>(B, A);
+    auto f = std::make_shared<Function>(NodeVector{sub1, sub2}, op::ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), sub1);
+    ASSERT_EQ(f->get_results().at(1)->get_argument(0), sub2);
+}
+
+TEST(CSE, constants)
+{
+    Shape shape{2, 2};
+    auto c1 = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto c2 = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto c3 = op::Constant::create(element::f32, shape, {1, 2, 3, 5});
+    auto c4 = op::Constant::create(element::i32, shape, {1, 2, 3, 4});
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto add1 = std::make_shared<op::Add>(A, c1);
+    auto add2 = std::make_shared<op::Add>(A, c2);
+    auto add3 = std::make_shared<op::Add>(A, c3);
+    auto f = std::make_shared<Function>(NodeVector{add1, add2, add3, c4}, op::ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(add3->get_argument(1), c3);
+    ASSERT_EQ(f->get_results().at(3)->get_argument(0), c4);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 3);
+}
+
+TEST(CSE, attributed_ops)
+{
+    Shape shape{2, 3};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto reshape1 = std::make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{3, 2});
+    auto reshape2 = std::make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{3, 2});
+    auto reshape3 = std::make_shared<op::Reshape>(A, AxisVector{0, 1}, Shape{3, 2});
+    auto broadcast1 = std::make_shared<op::Broadcast>(A, Shape{2, 3, 4}, AxisSet{2});
+    auto broadcast2 = std::make_shared<op::Broadcast>(A, Shape{2, 3, 4}, AxisSet{2});
+    auto broadcast3 = std::make_shared<op::Broadcast>(A, Shape{2, 3, 5}, AxisSet{2});
+    auto sum1 = std::make_shared<op::Sum>(A, AxisSet{0});
+    auto sum2 = std::make_shared<op::Sum>(A, AxisSet{0});
+    auto sum3 = std::make_shared<op::Sum>(A, AxisSet{1});
+    NodeVector results{
+        reshape1, reshape2, reshape3, broadcast1, broadcast2, broadcast3, sum1, sum2, sum3};
+    auto f = std::make_shared<Function>(results, op::ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(f), 2);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(3)->get_argument(0), f->get_results().at(4)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(6)->get_argument(0), f->get_results().at(7)->get_argument(0));
+}
+
+TEST(CSE, 10_bucket_lstm)
+{
+    const string json_path = file_util::path_join(SERIALIZED_ZOO, "mxnet/10_bucket_LSTM.json");
+    auto f = deserialize(file_util::read_file_to_string(json_path));
+    size_t before = f->get_ops().size();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_LT(f->get_ops().size(), before);
+}
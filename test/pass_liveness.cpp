@@ -27,6 +27,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/result_copy_elimination.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 
 #include "util/test_tools.hpp"
@@ -65,6 +66,44 @@ TEST(liveness, constant)
     EXPECT_EQ(1, sorted[2]->liveness_free_list.size());
 }
 
+TEST(liveness, result_without_copy)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(A);
+    auto f = make_shared<Function>(neg, op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ResultCopyElimination>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(f);
+
+    // op::Negative is computed straight into the output and never becomes a temporary
+    for (shared_ptr<Node> node : f->get_ordered_ops())
+    {
+        EXPECT_EQ(0, node->liveness_new_list.size());
+        EXPECT_EQ(0, node->liveness_free_list.size());
+    }
+}
+
+TEST(liveness, view_of_parameter)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto reshape = make_shared<op::Reshape>(A, AxisVector{0, 1}, Shape{6});
+    auto op_annotations = make_shared<op::util::OpAnnotations>();
+    op_annotations->add_in_place_oi_pair({0, 0, false});
+    reshape->set_op_annotations(op_annotations);
+    auto neg = make_shared<op::Negative>(reshape);
+    auto f = make_shared<Function>(neg, op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(0, reshape->liveness_new_list.size());
+    EXPECT_EQ(0, neg->liveness_free_list.count(&reshape->get_output_tensor()));
+}
+
 TEST(liveness, liveness)
 {
     string image = "liveness.png";
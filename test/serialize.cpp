@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include <fstream>
+#include <malloc.h>
+#include <numeric>
 #include <sstream>
 
 #include "gtest/gtest.h"
@@ -120,6 +122,59 @@ TEST(serialize, existing_models)
     }
 }
 
+// Every Constant read from the models in the corpus must hold the same bytes as one built
+// from its json literals by the Constant constructor that takes strings.
+TEST(serialize, existing_models_constants)
+{
+    vector<string> models = get_serialized_models();
+    ASSERT_FALSE(models.empty());
+
+    size_t checked = 0;
+    for (const string& model : models)
+    {
+        const string json_string = file_util::read_file_to_string(model);
+        shared_ptr<Function> f = ngraph::deserialize(json_string);
+        ASSERT_NE(f, nullptr) << model;
+
+        // Nodes are built in the order they appear in the json, and are renamed on the way.
+        map<size_t, shared_ptr<op::Constant>> by_instance_id;
+        traverse_functions(f, [&](shared_ptr<Function> g) {
+            for (shared_ptr<Node> node : g->get_ops())
+            {
+                if (auto c = dynamic_pointer_cast<op::Constant>(node))
+                {
+                    by_instance_id[c->get_instance_id()] = c;
+                }
+            }
+        });
+        auto actual_it = by_instance_id.begin();
+
+        for (const json& func : json::parse(json_string))
+        {
+            for (const json& node_js : func.at("ops"))
+            {
+                if (node_js.at("op") != "Constant")
+                {
+                    continue;
+                }
+                ASSERT_NE(actual_it, by_instance_id.end()) << model;
+                shared_ptr<op::Constant> actual = (actual_it++)->second;
+                const element::Type& et = actual->get_element_type();
+                const Shape& shape = actual->get_shape();
+                op::Constant expected(et, shape, node_js.at("value").get<vector<string>>());
+                EXPECT_EQ(memcmp(expected.get_data_ptr(),
+                                 actual->get_data_ptr(),
+                                 shape_size(shape) * et.size()),
+                          0)
+                    << model << " " << node_js.at("name").get<string>();
+                checked++;
+            }
+        }
+        EXPECT_EQ(actual_it, by_instance_id.end()) << model;
+    }
+    EXPECT_GT(checked, 0);
+}
+
 TEST(serialize, default_value)
 {
     json j = {{"test1", 1}, {"test2", 2}};
@@ -158,6 +213,133 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, mappable_constant)
+{
+    const string tmp_file = "serialize_mappable_constant.ngm";
+    Shape shape{2, 2, 2};
+    auto A = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto B = op::Constant::create(element::i8, Shape{3}, {9, 10, 11});
+    auto C = op::Constant::create(element::f64, Shape{2}, {12, 13});
+    auto f = make_shared<Function>(NodeVector{A, B, C}, op::ParameterVector{});
+    serialize_mappable(tmp_file, f);
+
+    // Both mapped and read through a stream
+    for (auto g : {deserialize_mapped(tmp_file), deserialize(tmp_file)})
+    {
+        ASSERT_NE(g, nullptr);
+        size_t found = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            shared_ptr<op::Constant> c = dynamic_pointer_cast<op::Constant>(node);
+            if (c)
+            {
+                found++;
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(c->get_data_ptr()) % 64, 0);
+                if (c->get_element_type() == element::f32)
+                {
+                    EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6, 7, 8}), c->get_vector<float>());
+                }
+                else if (c->get_element_type() == element::i8)
+                {
+                    EXPECT_EQ((vector<int8_t>{9, 10, 11}), c->get_vector<int8_t>());
+                }
+                else
+                {
+                    EXPECT_EQ((vector<double>{12, 13}), c->get_vector<double>());
+                }
+            }
+        }
+        EXPECT_EQ(found, 3);
+    }
+
+    // Constants keep the mapping alive after the Function is gone
+    shared_ptr<Node> copy;
+    {
+        auto g = deserialize_mapped(tmp_file);
+        copy = g->get_results().at(0)->get_argument(0)->copy_with_new_args(NodeVector{});
+    }
+    file_util::remove_file(tmp_file);
+    EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6, 7, 8}),
+              dynamic_pointer_cast<op::Constant>(copy)->get_vector<float>());
+}
+
+TEST(serialize, mappable_no_constants)
+{
+    const string tmp_file = "serialize_mappable_no_constants.ngm";
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), op::ParameterVector{A});
+    serialize_mappable(tmp_file, f);
+
+    for (auto g : {deserialize_mapped(tmp_file), deserialize(tmp_file)})
+    {
+        ASSERT_NE(g, nullptr);
+        EXPECT_EQ(g->get_parameters().size(), 1);
+        EXPECT_EQ(g->get_results().at(0)->get_argument(0)->description(), "Negative");
+    }
+    file_util::remove_file(tmp_file);
+
+    EXPECT_THROW(serialize_mappable("no_such_directory/model.ngm", f), ngraph_error);
+}
+
+TEST(benchmark, serialize_constant_formats)
+{
+    const size_t constant_count = 8;
+    const Shape shape{1024, 1024};
+    NodeVector constants;
+    for (size_t i = 0; i < constant_count; i++)
+    {
+        vector<float> values(shape_size(shape));
+        iota(values.begin(), values.end(), static_cast<float>(i));
+        constants.push_back(make_shared<op::Constant>(element::f32, shape, values));
+    }
+    auto f = make_shared<Function>(constants, op::ParameterVector{});
+
+    const string json_file = "benchmark_constants.json";
+    const string cpio_file = "benchmark_constants.cpio";
+    const string mappable_file = "benchmark_constants.ngm";
+    {
+        ofstream out(json_file);
+        out << serialize(f);
+    }
+    serialize(cpio_file, f);
+    serialize_mappable(mappable_file, f);
+    f = nullptr;
+    constants.clear();
+
+    // Loads the model, then reads every constant so that all of its data is resident.
+    auto measure = [](const string& name, function<shared_ptr<Function>()> load) {
+        // Hand memory freed by earlier loads back so that it is not silently reused
+        malloc_trim(0);
+        long rss_before = get_rss_kb("VmRSS");
+        long anon_before = get_rss_kb("RssAnon");
+        stopwatch timer;
+        timer.start();
+        shared_ptr<Function> g = load();
+        timer.stop();
+        float sum = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                const float* p = c->get_data_ptr<float>();
+                sum = accumulate(p, p + shape_size(c->get_shape()), sum);
+            }
+        }
+        cout << name << ": load " << timer.get_milliseconds() << "ms, RSS +"
+             << (get_rss_kb("VmRSS") - rss_before) / 1024 << "MiB, private RSS +"
+             << (get_rss_kb("RssAnon") - anon_before) / 1024 << "MiB (checksum " << sum << ")\n";
+    };
+
+    measure("mapped", [&]() { return deserialize_mapped(mappable_file); });
+    measure("mappable stream", [&]() { return deserialize(mappable_file); });
+    measure("cpio", [&]() { return deserialize(cpio_file); });
+    measure("json", [&]() { return deserialize(json_file); });
+
+    file_util::remove_file(json_file);
+    file_util::remove_file(cpio_file);
+    file_util::remove_file(mappable_file);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
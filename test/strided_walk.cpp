@@ -0,0 +1,199 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/strided_walk.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Collects the offsets of every element visited by walk, for buffer i.
+template <size_t N>
+static vector<ptrdiff_t> visited(const StridedWalk<N>& walk, size_t i)
+{
+    vector<ptrdiff_t> result;
+    walk.for_each([&](const typename StridedWalk<N>::Offsets& offsets) {
+        result.push_back(offsets[i]);
+    });
+    return result;
+}
+
+TEST(strided_walk, dense_is_one_run)
+{
+    Shape shape{2, 3, 4};
+    StridedWalk<2> walk(shape, {{row_major_steps(shape), row_major_steps(shape)}});
+
+    size_t runs = 0;
+    walk.for_each_run([&](const StridedWalk<2>::Offsets& offsets, size_t length) {
+        EXPECT_EQ(offsets[0], 0);
+        EXPECT_EQ(offsets[1], 0);
+        EXPECT_EQ(length, 24);
+        runs++;
+    });
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(walk.get_inner_step(0), 1);
+}
+
+TEST(strided_walk, matches_coordinate_transform)
+{
+    Shape source_shape{5, 7, 6};
+    CoordinateTransform transform(
+        source_shape, Coordinate{1, 0, 2}, Coordinate{5, 7, 6}, Strides{2, 3, 1});
+    StridedWalk<1> walk(transform.get_target_shape(),
+                        {{transform.get_source_steps()}},
+                        {{transform.get_source_origin()}});
+
+    vector<ptrdiff_t> expected;
+    for (const Coordinate& coord : transform)
+    {
+        expected.push_back(transform.index(coord));
+    }
+    EXPECT_EQ(visited(walk, 0), expected);
+}
+
+TEST(strided_walk, negative_steps)
+{
+    Shape shape{2, 3};
+    StridedWalk<1> walk(shape, {{{-3, -1}}}, {{5}});
+    EXPECT_EQ(visited(walk, 0), (vector<ptrdiff_t>{5, 4, 3, 2, 1, 0}));
+}
+
+TEST(strided_walk, projected_steps)
+{
+    Shape shape{2, 3};
+    StridedWalk<2> walk(shape, {{row_major_steps(shape), projected_steps(shape, AxisSet{1})}});
+    EXPECT_EQ(visited(walk, 0), (vector<ptrdiff_t>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(visited(walk, 1), (vector<ptrdiff_t>{0, 0, 0, 1, 1, 1}));
+}
+
+TEST(strided_walk, runs_break_on_outer_axes)
+{
+    // Every other column of a 3x5 buffer: the rows do not line up end to end.
+    Shape shape{3, 2};
+    StridedWalk<1> walk(shape, {{{5, 2}}});
+
+    vector<ptrdiff_t> starts;
+    walk.for_each_run([&](const StridedWalk<1>::Offsets& offsets, size_t length) {
+        EXPECT_EQ(length, 2);
+        starts.push_back(offsets[0]);
+    });
+    EXPECT_EQ(starts, (vector<ptrdiff_t>{0, 5, 10}));
+    EXPECT_EQ(walk.get_inner_step(0), 2);
+}
+
+TEST(strided_walk, scalar_and_empty)
+{
+    StridedWalk<1> scalar(Shape{}, {{{}}}, {{3}});
+    EXPECT_EQ(visited(scalar, 0), (vector<ptrdiff_t>{3}));
+
+    Shape empty{4, 0, 2};
+    StridedWalk<1> walk(empty, {{row_major_steps(empty)}});
+    EXPECT_TRUE(visited(walk, 0).empty());
+}
+
+// Reports elements per second for the same offset computations done by iterating a
+// CoordinateTransform and calling index(), and by StridedWalk.
+TEST(benchmark, strided_walk_vs_coordinate_transform)
+{
+    Shape shape{64, 64, 64};
+    size_t n = shape_size(shape);
+    vector<float> in(n, 1.0f);
+    vector<float> out(n);
+
+    auto rate = [n](const chrono::steady_clock::time_point& start) {
+        auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return n / elapsed;
+    };
+
+    // Row-major copy.
+    {
+        CoordinateTransform transform(shape);
+        auto start = chrono::steady_clock::now();
+        for (const Coordinate& coord : transform)
+        {
+            size_t i = transform.index(coord);
+            out[i] = in[i];
+        }
+        double before = rate(start);
+
+        StridedWalk<1> walk(shape, {{row_major_steps(shape)}});
+        start = chrono::steady_clock::now();
+        walk.for_each([&](const StridedWalk<1>::Offsets& offsets) {
+            out[offsets[0]] = in[offsets[0]];
+        });
+        double after = rate(start);
+        NGRAPH_INFO << "copy: " << before << " -> " << after << " elements/s";
+    }
+
+    // Reversal of every axis.
+    {
+        CoordinateTransform transform(shape);
+        auto start = chrono::steady_clock::now();
+        for (const Coordinate& coord : transform)
+        {
+            Coordinate source(coord.size());
+            for (size_t i = 0; i < coord.size(); i++)
+            {
+                source[i] = shape[i] - coord[i] - 1;
+            }
+            out[transform.index(coord)] = in[transform.index(source)];
+        }
+        double before = rate(start);
+
+        vector<ptrdiff_t> steps = row_major_steps(shape);
+        vector<ptrdiff_t> reversed_steps;
+        for (ptrdiff_t step : steps)
+        {
+            reversed_steps.push_back(-step);
+        }
+        StridedWalk<2> walk(
+            shape, {{steps, reversed_steps}}, {{0, static_cast<ptrdiff_t>(n) - 1}});
+        start = chrono::steady_clock::now();
+        walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+            out[offsets[0]] = in[offsets[1]];
+        });
+        double after = rate(start);
+        NGRAPH_INFO << "reverse: " << before << " -> " << after << " elements/s";
+    }
+
+    // Sum over the middle axis.
+    {
+        AxisSet axes{1};
+        Shape out_shape = project(shape, axes);
+        CoordinateTransform transform(shape);
+        CoordinateTransform out_transform(out_shape);
+        auto start = chrono::steady_clock::now();
+        for (const Coordinate& coord : transform)
+        {
+            out[out_transform.index(project(coord, axes))] += in[transform.index(coord)];
+        }
+        double before = rate(start);
+
+        StridedWalk<2> walk(shape, {{row_major_steps(shape), projected_steps(shape, axes)}});
+        start = chrono::steady_clock::now();
+        walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+            out[offsets[1]] += in[offsets[0]];
+        });
+        double after = rate(start);
+        NGRAPH_INFO << "sum: " << before << " -> " << after << " elements/s";
+    }
+}
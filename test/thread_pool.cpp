@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(thread_pool, covers_range)
+{
+    runtime::ThreadPool pool(4);
+    EXPECT_EQ(pool.get_thread_count(), 4);
+
+    for (size_t count : {0, 1, 3, 4, 1000})
+    {
+        vector<atomic<int>> visits(count);
+        for (auto& visit : visits)
+        {
+            visit = 0;
+        }
+        atomic<size_t> calls(0);
+        pool.parallel_for(count, [&](size_t begin, size_t end) {
+            EXPECT_LT(begin, end);
+            calls++;
+            for (size_t i = begin; i < end; i++)
+            {
+                visits[i]++;
+            }
+        });
+        EXPECT_LE(calls, min<size_t>(count, 4));
+        for (auto& visit : visits)
+        {
+            EXPECT_EQ(visit, 1);
+        }
+    }
+}
+
+TEST(thread_pool, nested_call_runs_serially)
+{
+    runtime::ThreadPool pool(3);
+    atomic<size_t> inner_calls(0);
+    pool.parallel_for(3, [&](size_t, size_t) {
+        pool.parallel_for(10, [&](size_t begin, size_t end) {
+            EXPECT_EQ(begin, 0);
+            EXPECT_EQ(end, 10);
+            inner_calls++;
+        });
+    });
+    EXPECT_EQ(inner_calls, 3);
+}
+
+TEST(thread_pool, exception)
+{
+    runtime::ThreadPool pool(2);
+    EXPECT_THROW(pool.parallel_for(2,
+                                   [](size_t begin, size_t) {
+                                       if (begin > 0)
+                                       {
+                                           throw runtime_error("chunk failed");
+                                       }
+                                   }),
+                 runtime_error);
+
+    // The pool is usable after an exception
+    atomic<size_t> calls(0);
+    pool.parallel_for(2, [&](size_t, size_t) { calls++; });
+    EXPECT_EQ(calls, 2);
+}
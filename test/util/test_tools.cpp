@@ -15,8 +15,12 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <random>
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/util.hpp"
 #include "test_tools.hpp"
 
@@ -147,3 +151,98 @@ shared_ptr<Function> make_test_graph()
 
     return f0;
 }
+
+vector<string> get_serialized_models()
+{
+    vector<string> models;
+    file_util::iterate_files(SERIALIZED_ZOO,
+                             [&](const string& file, bool is_dir) {
+                                 if (!is_dir && file_util::get_file_ext(file) == ".json")
+                                 {
+                                     models.push_back(file);
+                                 }
+                             },
+                             true);
+    sort(models.begin(), models.end());
+    return models;
+}
+
+long get_rss_kb(const string& field)
+{
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, field.size() + 1, field + ":") == 0)
+        {
+            return stol(line.substr(field.size() + 1));
+        }
+    }
+    return 0;
+}
+
+ScopedEnvironmentVariable::ScopedEnvironmentVariable(const string& name, const char* value)
+    : m_name(name)
+    , m_was_set(getenv(name.c_str()) != nullptr)
+    , m_previous_value(m_was_set ? getenv(name.c_str()) : "")
+{
+    if (value != nullptr)
+    {
+        setenv(m_name.c_str(), value, 1);
+    }
+    else
+    {
+        unsetenv(m_name.c_str());
+    }
+}
+
+ScopedEnvironmentVariable::~ScopedEnvironmentVariable()
+{
+    if (m_was_set)
+    {
+        setenv(m_name.c_str(), m_previous_value.c_str(), 1);
+    }
+    else
+    {
+        unsetenv(m_name.c_str());
+    }
+}
+
+vector<BufferLifetime> make_buffer_lifetimes(size_t count, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<size_t> size_dist(1, 1 << 16);
+    geometric_distribution<size_t> short_dist(0.2);
+    uniform_int_distribution<size_t> long_dist(0, count / 20);
+    uniform_int_distribution<int> percent(0, 99);
+    vector<BufferLifetime> lifetimes;
+    for (size_t step = 0; step < count; step++)
+    {
+        size_t length = percent(rng) < 5 ? long_dist(rng) : short_dist(rng);
+        lifetimes.push_back({size_dist(rng), step, min(step + length, count - 1)});
+    }
+    return lifetimes;
+}
+
+size_t plan_buffers_online(const vector<BufferLifetime>& lifetimes, size_t alignment)
+{
+    pass::MemoryManager mm(alignment);
+    vector<vector<size_t>> frees(lifetimes.size());
+    vector<size_t> offsets(lifetimes.size());
+    for (size_t i = 0; i < lifetimes.size(); i++)
+    {
+        frees[lifetimes[i].end].push_back(i);
+    }
+    for (size_t step = 0, next = 0; step < lifetimes.size(); step++)
+    {
+        for (; next < lifetimes.size() && lifetimes[next].begin == step; next++)
+        {
+            offsets[next] = mm.allocate(lifetimes[next].size);
+        }
+        for (size_t i : frees[step])
+        {
+            mm.free(offsets[i]);
+        }
+    }
+    return mm.max_allocated();
+}
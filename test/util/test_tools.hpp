@@ -19,6 +19,8 @@
 #include <exception>
 #include <list>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "ngraph/descriptor/layout/tensor_view_layout.hpp"
 #include "ngraph/file_util.hpp"
@@ -36,6 +38,45 @@ namespace ngraph
 bool validate_list(const std::list<std::shared_ptr<ngraph::Node>>& nodes);
 std::shared_ptr<ngraph::Function> make_test_graph();
 
+/// \brief Paths of the serialized models under SERIALIZED_ZOO, in sorted order
+std::vector<std::string> get_serialized_models();
+
+/// \brief Resident set size of this process from /proc, in KiB. field is VmRSS or RssAnon.
+long get_rss_kb(const std::string& field);
+
+/// \brief Sets an environment variable, or unsets it if value is null, and restores the
+///        previous state when destroyed
+class ScopedEnvironmentVariable
+{
+public:
+    ScopedEnvironmentVariable(const std::string& name, const char* value);
+    ~ScopedEnvironmentVariable();
+
+    ScopedEnvironmentVariable(const ScopedEnvironmentVariable&) = delete;
+    ScopedEnvironmentVariable& operator=(const ScopedEnvironmentVariable&) = delete;
+
+private:
+    std::string m_name;
+    bool m_was_set;
+    std::string m_previous_value;
+};
+
+/// \brief Size and first and last step of a buffer to be placed by a memory planner
+struct BufferLifetime
+{
+    size_t size;
+    size_t begin;
+    size_t end;
+};
+
+/// \brief One buffer created per step, most of them short lived and a few living across much
+///        of the graph, like activations kept for the backward pass
+std::vector<BufferLifetime> make_buffer_lifetimes(size_t count, unsigned seed);
+
+/// \brief Replays the lifetimes through MemoryManager the way MemoryLayout's online scheme
+///        does and returns the peak allocation
+size_t plan_buffers_online(const std::vector<BufferLifetime>& lifetimes, size_t alignment);
+
 template <typename T>
 void copy_data(std::shared_ptr<ngraph::runtime::TensorView> tv, const std::vector<T>& data)
 {